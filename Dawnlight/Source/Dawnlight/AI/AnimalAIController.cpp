@@ -2,13 +2,17 @@
 
 #include "AnimalAIController.h"
 #include "Dawnlight.h"
+#include "DawnlightStats.h"
+#include "Subsystems/DawnlightAISignificanceManager.h"
+#include "Subsystems/PlayerContextSubsystem.h"
+#include "Subsystems/AnimalHerdSubsystem.h"
+#include "Characters/AnimalCharacter.h"
 #include "BehaviorTree/BehaviorTree.h"
 #include "BehaviorTree/BehaviorTreeComponent.h"
 #include "BehaviorTree/BlackboardComponent.h"
 #include "Perception/AIPerceptionComponent.h"
 #include "Perception/AISenseConfig_Sight.h"
 #include "NavigationSystem.h"
-#include "Kismet/GameplayStatics.h"
 
 AAnimalAIController::AAnimalAIController()
 {
@@ -33,6 +37,7 @@ AAnimalAIController::AAnimalAIController()
 	MoveDestinationKey = TEXT("MoveDestination");
 	ThreatActorKey = TEXT("ThreatActor");
 	HasThreatKey = TEXT("HasThreat");
+	MoveDestinationTolerance = 100.0f;
 
 	CurrentState = EAnimalAIState::Idle;
 	bHasDetectedThreat = false;
@@ -45,6 +50,8 @@ void AAnimalAIController::OnPossess(APawn* InPawn)
 	// スポーン位置を記録
 	SpawnLocation = InPawn->GetActorLocation();
 
+	HerdSubsystem = GetWorld()->GetSubsystem<UAnimalHerdSubsystem>();
+
 	// Perceptionをセットアップ
 	SetupPerception();
 
@@ -59,12 +66,24 @@ void AAnimalAIController::OnPossess(APawn* InPawn)
 		UE_LOG(LogDawnlight, Warning, TEXT("[AnimalAI] Behavior Treeが設定されていません: %s"), *GetNameSafe(InPawn));
 	}
 
+	// Blackboardのキーを解決（Behavior Tree開始後）
+	ResolveBlackboardKeys();
+
 	// 初期状態は徘徊
 	SetState(EAnimalAIState::Wandering);
+
+	// 距離・画面内かどうかで更新頻度を調整
+	UDawnlightAISignificanceManager::RegisterWithWorld(this);
 }
 
 void AAnimalAIController::OnUnPossess()
 {
+	UE_LOG(LogDawnlight, Verbose, TEXT("[AnimalAI] Blackboard書き込み: %d回（抑制: %d回）"),
+		BlackboardWriter.GetWritesIssued(), BlackboardWriter.GetWritesSuppressed());
+
+	// 重要度評価から外す（更新頻度は元に戻る）
+	UDawnlightAISignificanceManager::UnregisterFromWorld(this);
+
 	// Behavior Treeを停止
 	if (BehaviorTreeComponent)
 	{
@@ -78,6 +97,12 @@ void AAnimalAIController::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 
+	// 群れシミュレーション中は UAnimalHerdSubsystem が ApplyHerdSteering で更新する
+	if (GetHerdManagedAnimal())
+	{
+		return;
+	}
+
 	// 逃走中の場合、安全距離まで離れたかチェック
 	if (CurrentState == EAnimalAIState::Fleeing && bHasDetectedThreat)
 	{
@@ -115,6 +140,16 @@ FVector AAnimalAIController::GetFleeDestination() const
 		return FVector::ZeroVector;
 	}
 
+	// 群れシミュレーションが計算済みの逃走先（ナビメッシュのサンプル点）
+	if (const AAnimalCharacter* Animal = GetHerdManagedAnimal())
+	{
+		FVector HerdDestination;
+		if (HerdSubsystem->GetFleeDestination(Animal, HerdDestination))
+		{
+			return HerdDestination;
+		}
+	}
+
 	// 逃走方向を計算
 	FVector FleeDirection = CalculateFleeDirection();
 
@@ -143,6 +178,16 @@ FVector AAnimalAIController::GetRandomWanderLocation() const
 		return SpawnLocation;
 	}
 
+	// 群れシミュレーションが選んだ徘徊先
+	if (const AAnimalCharacter* Animal = GetHerdManagedAnimal())
+	{
+		FVector HerdTarget;
+		if (HerdSubsystem->GetWanderTarget(Animal, HerdTarget))
+		{
+			return HerdTarget;
+		}
+	}
+
 	UNavigationSystemV1* NavSystem = UNavigationSystemV1::GetCurrent(GetWorld());
 	if (!NavSystem)
 	{
@@ -180,8 +225,13 @@ void AAnimalAIController::OnTargetPerceptionUpdated(AActor* Actor, FAIStimulus S
 	}
 
 	// プレイヤーかどうかチェック
-	APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(GetWorld(), 0);
-	if (Actor != PlayerPawn)
+	if (!UPlayerContextSubsystem::IsPlayerActorInWorld(this, Actor))
+	{
+		return;
+	}
+
+	// 群れシミュレーション中は距離で逃走を判定する
+	if (GetHerdManagedAnimal())
 	{
 		return;
 	}
@@ -209,16 +259,16 @@ void AAnimalAIController::SetState(EAnimalAIState NewState)
 	// Blackboardに状態を設定
 	if (Blackboard)
 	{
-		Blackboard->SetValueAsEnum(AIStateKey, static_cast<uint8>(NewState));
+		BlackboardWriter.SetEnum(AIStateKeyID, static_cast<uint8>(NewState));
 
 		// 状態に応じた移動先を設定
 		switch (NewState)
 		{
 		case EAnimalAIState::Wandering:
-			Blackboard->SetValueAsVector(MoveDestinationKey, GetRandomWanderLocation());
+			BlackboardWriter.SetVector(MoveDestinationKeyID, GetRandomWanderLocation());
 			break;
 		case EAnimalAIState::Fleeing:
-			Blackboard->SetValueAsVector(MoveDestinationKey, GetFleeDestination());
+			BlackboardWriter.SetVector(MoveDestinationKeyID, GetFleeDestination());
 			break;
 		default:
 			break;
@@ -231,22 +281,55 @@ void AAnimalAIController::SetState(EAnimalAIState NewState)
 
 void AAnimalAIController::UpdateBlackboard()
 {
+	DAWNLIGHT_SCOPE_CYCLE_COUNTER(STAT_DawnlightAnimalBlackboard);
+
 	if (!Blackboard)
 	{
 		return;
 	}
 
 	// 脅威情報を更新
-	Blackboard->SetValueAsBool(HasThreatKey, bHasDetectedThreat);
-	Blackboard->SetValueAsObject(ThreatActorKey, ThreatActor.Get());
+	BlackboardWriter.SetBool(HasThreatKeyID, bHasDetectedThreat);
+	BlackboardWriter.SetObject(ThreatActorKeyID, ThreatActor.Get());
 
-	// 逃走中は移動先を更新
+	// 逃走中は移動先を更新（少し変わっただけでは書き込まない）
 	if (CurrentState == EAnimalAIState::Fleeing && bHasDetectedThreat)
 	{
-		Blackboard->SetValueAsVector(MoveDestinationKey, GetFleeDestination());
+		BlackboardWriter.SetVector(MoveDestinationKeyID, GetFleeDestination(), MoveDestinationTolerance);
 	}
 }
 
+void AAnimalAIController::ApplyHerdSteering(const AAnimalCharacter& Animal, const FVector& MoveDestination)
+{
+	DAWNLIGHT_SCOPE_CYCLE_COUNTER(STAT_DawnlightAnimalBlackboard);
+
+	SyncStateFromHerd(Animal);
+
+	if (!Blackboard)
+	{
+		return;
+	}
+
+	BlackboardWriter.SetBool(HasThreatKeyID, bHasDetectedThreat);
+	BlackboardWriter.SetObject(ThreatActorKeyID, ThreatActor.Get());
+
+	// 分離・結束を反映した移動先（少し変わっただけでは書き込まない）
+	if (CurrentState == EAnimalAIState::Wandering || CurrentState == EAnimalAIState::Fleeing)
+	{
+		BlackboardWriter.SetVector(MoveDestinationKeyID, MoveDestination, MoveDestinationTolerance);
+	}
+}
+
+void AAnimalAIController::ResolveBlackboardKeys()
+{
+	BlackboardWriter.Reset(Blackboard);
+
+	AIStateKeyID = BlackboardWriter.ResolveKey(AIStateKey);
+	MoveDestinationKeyID = BlackboardWriter.ResolveKey(MoveDestinationKey);
+	ThreatActorKeyID = BlackboardWriter.ResolveKey(ThreatActorKey);
+	HasThreatKeyID = BlackboardWriter.ResolveKey(HasThreatKey);
+}
+
 void AAnimalAIController::SetupPerception()
 {
 	if (!AIPerceptionComponent)
@@ -300,3 +383,31 @@ FVector AAnimalAIController::CalculateFleeDirection() const
 	FleeDirection.Z = 0.0f; // 2D平面上
 	return FleeDirection.GetSafeNormal();
 }
+
+const AAnimalCharacter* AAnimalAIController::GetHerdManagedAnimal() const
+{
+	const AAnimalCharacter* Animal = Cast<AAnimalCharacter>(GetPawn());
+	const UAnimalHerdSubsystem* Herd = HerdSubsystem.Get();
+	return (Animal && Herd && Herd->IsAnimalRegistered(Animal)) ? Animal : nullptr;
+}
+
+void AAnimalAIController::SyncStateFromHerd(const AAnimalCharacter& Animal)
+{
+	const bool bFleeing = Animal.BehaviorState == EAnimalBehaviorState::Fleeing;
+	if (bFleeing == bHasDetectedThreat && (CurrentState == EAnimalAIState::Fleeing) == bFleeing)
+	{
+		return;
+	}
+
+	bHasDetectedThreat = bFleeing;
+	if (bFleeing)
+	{
+		ThreatActor = UPlayerContextSubsystem::GetPlayerPawnInWorld(this);
+	}
+	else
+	{
+		ThreatActor.Reset();
+	}
+
+	SetState(bFleeing ? EAnimalAIState::Fleeing : EAnimalAIState::Wandering);
+}
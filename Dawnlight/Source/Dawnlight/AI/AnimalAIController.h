@@ -5,12 +5,15 @@
 #include "CoreMinimal.h"
 #include "AIController.h"
 #include "Perception/AIPerceptionTypes.h"
+#include "BlackboardWriteCache.h"
 #include "AnimalAIController.generated.h"
 
 class UBehaviorTreeComponent;
 class UBlackboardComponent;
 class UAIPerceptionComponent;
 class UAISenseConfig_Sight;
+class UAnimalHerdSubsystem;
+class AAnimalCharacter;
 
 /**
  * 動物AI状態
@@ -31,6 +34,7 @@ enum class EAnimalAIState : uint8
  * - ランダムに徘徊
  * - プレイヤーを検知すると逃走
  * - Behavior Treeで行動制御
+ * - UAnimalHerdSubsystem に登録された動物は、群れが ApplyHerdSteering で書き込む状態・移動先に従う（Tickでは更新しない）
  */
 UCLASS()
 class DAWNLIGHT_API AAnimalAIController : public AAIController
@@ -72,6 +76,12 @@ public:
 	UFUNCTION(BlueprintPure, Category = "AI")
 	float GetDistanceToThreat() const;
 
+	/**
+	 * 群れシミュレーションの結果を反映（UAnimalHerdSubsystem から毎フレーム呼ばれる）
+	 * 状態とBlackboardの移動先のみ更新し、移動自体はBehavior TreeのMoveToが行う
+	 */
+	void ApplyHerdSteering(const AAnimalCharacter& Animal, const FVector& MoveDestination);
+
 	// ========================================================================
 	// Blackboard キー名
 	// ========================================================================
@@ -92,6 +102,10 @@ public:
 	UPROPERTY(EditDefaultsOnly, Category = "AI|Blackboard")
 	FName HasThreatKey;
 
+	/** 逃走先がこの距離以上変わった場合のみBlackboardを更新 */
+	UPROPERTY(EditDefaultsOnly, Category = "AI|Blackboard", meta = (ClampMin = "0"))
+	float MoveDestinationTolerance;
+
 protected:
 	// ========================================================================
 	// コンポーネント
@@ -154,6 +168,18 @@ protected:
 	/** スポーン位置（徘徊の中心） */
 	FVector SpawnLocation;
 
+	/** Blackboardへの書き込み（値が変わった場合のみ） */
+	FBlackboardWriteCache BlackboardWriter;
+
+	/** 解決済みのキーID */
+	FBlackboard::FKey AIStateKeyID = FBlackboard::InvalidKey;
+	FBlackboard::FKey MoveDestinationKeyID = FBlackboard::InvalidKey;
+	FBlackboard::FKey ThreatActorKeyID = FBlackboard::InvalidKey;
+	FBlackboard::FKey HasThreatKeyID = FBlackboard::InvalidKey;
+
+	/** 群れシミュレーション（OnPossess で取得） */
+	TWeakObjectPtr<UAnimalHerdSubsystem> HerdSubsystem;
+
 	// ========================================================================
 	// 内部処理
 	// ========================================================================
@@ -168,9 +194,18 @@ protected:
 	/** Blackboardを更新 */
 	void UpdateBlackboard();
 
+	/** Blackboardのキー名をキーIDに解決 */
+	void ResolveBlackboardKeys();
+
 	/** Perceptionを設定 */
 	void SetupPerception();
 
 	/** 逃走方向を計算 */
 	FVector CalculateFleeDirection() const;
+
+	/** 群れシミュレーションに登録された動物（未登録なら null） */
+	const AAnimalCharacter* GetHerdManagedAnimal() const;
+
+	/** 群れシミュレーションの結果から状態を更新 */
+	void SyncStateFromHerd(const AAnimalCharacter& Animal);
 };
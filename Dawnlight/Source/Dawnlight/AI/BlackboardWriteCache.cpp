@@ -0,0 +1,163 @@
+// Soul Reaper - Dawnlight Project
+// Copyright (c) 2025. All Rights Reserved.
+
+#include "BlackboardWriteCache.h"
+#include "DawnlightStats.h"
+#include "BehaviorTree/BlackboardComponent.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Bool.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Enum.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Object.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Vector.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Blackboard Writes Issued"), STAT_DawnlightBlackboardWritesIssued, STATGROUP_DawnlightAI);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Blackboard Writes Suppressed"), STAT_DawnlightBlackboardWritesSuppressed, STATGROUP_DawnlightAI);
+
+void FBlackboardWriteCache::Reset(UBlackboardComponent* InBlackboard)
+{
+	Blackboard = InBlackboard;
+	WritesIssued = 0;
+	WritesSuppressed = 0;
+}
+
+FBlackboard::FKey FBlackboardWriteCache::ResolveKey(const FName& KeyName) const
+{
+	const UBlackboardComponent* BlackboardComponent = Blackboard.Get();
+	if (!BlackboardComponent || KeyName.IsNone())
+	{
+		return FBlackboard::InvalidKey;
+	}
+
+	return BlackboardComponent->GetKeyID(KeyName);
+}
+
+// ========================================================================
+// 書き込み
+// ========================================================================
+
+bool FBlackboardWriteCache::SetVector(FBlackboard::FKey Key, const FVector& Value, float Tolerance)
+{
+	UBlackboardComponent* BlackboardComponent = GetBlackboardForKey(Key);
+	if (!BlackboardComponent)
+	{
+		return false;
+	}
+
+	// 未設定の場合は InvalidLocation が返るため必ず書き込まれる
+	const FVector Current = BlackboardComponent->GetValue<UBlackboardKeyType_Vector>(Key);
+	if (FVector::DistSquared(Current, Value) <= FMath::Square(Tolerance))
+	{
+		RecordSuppressed();
+		return false;
+	}
+
+	BlackboardComponent->SetValue<UBlackboardKeyType_Vector>(Key, Value);
+	RecordWrite();
+	return true;
+}
+
+bool FBlackboardWriteCache::SetBool(FBlackboard::FKey Key, bool bValue)
+{
+	UBlackboardComponent* BlackboardComponent = GetBlackboardForKey(Key);
+	if (!BlackboardComponent)
+	{
+		return false;
+	}
+
+	if (BlackboardComponent->GetValue<UBlackboardKeyType_Bool>(Key) == bValue)
+	{
+		RecordSuppressed();
+		return false;
+	}
+
+	BlackboardComponent->SetValue<UBlackboardKeyType_Bool>(Key, bValue);
+	RecordWrite();
+	return true;
+}
+
+bool FBlackboardWriteCache::SetObject(FBlackboard::FKey Key, UObject* Value)
+{
+	UBlackboardComponent* BlackboardComponent = GetBlackboardForKey(Key);
+	if (!BlackboardComponent)
+	{
+		return false;
+	}
+
+	if (BlackboardComponent->GetValue<UBlackboardKeyType_Object>(Key) == Value)
+	{
+		RecordSuppressed();
+		return false;
+	}
+
+	BlackboardComponent->SetValue<UBlackboardKeyType_Object>(Key, Value);
+	RecordWrite();
+	return true;
+}
+
+bool FBlackboardWriteCache::SetEnum(FBlackboard::FKey Key, uint8 Value)
+{
+	UBlackboardComponent* BlackboardComponent = GetBlackboardForKey(Key);
+	if (!BlackboardComponent)
+	{
+		return false;
+	}
+
+	if (BlackboardComponent->GetValue<UBlackboardKeyType_Enum>(Key) == Value)
+	{
+		RecordSuppressed();
+		return false;
+	}
+
+	BlackboardComponent->SetValue<UBlackboardKeyType_Enum>(Key, Value);
+	RecordWrite();
+	return true;
+}
+
+bool FBlackboardWriteCache::ClearValue(FBlackboard::FKey Key)
+{
+	UBlackboardComponent* BlackboardComponent = GetBlackboardForKey(Key);
+	if (!BlackboardComponent)
+	{
+		return false;
+	}
+
+	// ベクターとオブジェクトは未設定かどうかを判定できる（その他の型は常にクリアする）
+	const bool bAlreadyCleared =
+		(BlackboardComponent->IsKeyOfType<UBlackboardKeyType_Vector>(Key) && !BlackboardComponent->IsVectorValueSet(Key)) ||
+		(BlackboardComponent->IsKeyOfType<UBlackboardKeyType_Object>(Key) && BlackboardComponent->GetValue<UBlackboardKeyType_Object>(Key) == nullptr);
+
+	if (bAlreadyCleared)
+	{
+		RecordSuppressed();
+		return false;
+	}
+
+	BlackboardComponent->ClearValue(Key);
+	RecordWrite();
+	return true;
+}
+
+// ========================================================================
+// 内部処理
+// ========================================================================
+
+UBlackboardComponent* FBlackboardWriteCache::GetBlackboardForKey(FBlackboard::FKey Key) const
+{
+	if (Key == FBlackboard::InvalidKey)
+	{
+		return nullptr;
+	}
+
+	return Blackboard.Get();
+}
+
+void FBlackboardWriteCache::RecordWrite()
+{
+	++WritesIssued;
+	INC_DWORD_STAT(STAT_DawnlightBlackboardWritesIssued);
+}
+
+void FBlackboardWriteCache::RecordSuppressed()
+{
+	++WritesSuppressed;
+	INC_DWORD_STAT(STAT_DawnlightBlackboardWritesSuppressed);
+}
@@ -0,0 +1,76 @@
+// Soul Reaper - Dawnlight Project
+// Copyright (c) 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BehaviorTree/BehaviorTreeTypes.h"
+
+class UBlackboardComponent;
+
+/**
+ * 変更があった場合だけBlackboardに書き込むヘルパー
+ *
+ * Blackboardへの書き込みはオブザーバー通知とデコレーターの再評価を引き起こすため、
+ * 毎フレーム同じ値を書き込むとエージェント数に比例してBehavior Treeの負荷が増える
+ * - キー名は OnPossess 時に一度だけキーIDへ解決する
+ * - 現在の値と比較し、許容誤差内なら書き込まない（Behavior Tree側の書き込みも考慮される）
+ * - 書き込み回数と抑制回数を記録
+ */
+class DAWNLIGHT_API FBlackboardWriteCache
+{
+public:
+	/** 対象のBlackboardを設定（カウンターもリセット） */
+	void Reset(UBlackboardComponent* InBlackboard);
+
+	/** キー名をキーIDに解決（見つからない場合は FBlackboard::InvalidKey） */
+	FBlackboard::FKey ResolveKey(const FName& KeyName) const;
+
+	// ========================================================================
+	// 書き込み（書き込んだ場合は true）
+	// ========================================================================
+
+	/** ベクターを書き込む（現在値との距離が Tolerance 以下なら抑制） */
+	bool SetVector(FBlackboard::FKey Key, const FVector& Value, float Tolerance = 0.0f);
+
+	/** ブール値を書き込む */
+	bool SetBool(FBlackboard::FKey Key, bool bValue);
+
+	/** オブジェクトを書き込む */
+	bool SetObject(FBlackboard::FKey Key, UObject* Value);
+
+	/** 列挙値を書き込む */
+	bool SetEnum(FBlackboard::FKey Key, uint8 Value);
+
+	/** 値をクリア（既に未設定なら抑制） */
+	bool ClearValue(FBlackboard::FKey Key);
+
+	// ========================================================================
+	// 統計
+	// ========================================================================
+
+	/** 実際に書き込んだ回数 */
+	int32 GetWritesIssued() const { return WritesIssued; }
+
+	/** 値が変わらず書き込みを省いた回数 */
+	int32 GetWritesSuppressed() const { return WritesSuppressed; }
+
+private:
+	/** 書き込み可能なBlackboardを取得（キーが無効な場合は nullptr） */
+	UBlackboardComponent* GetBlackboardForKey(FBlackboard::FKey Key) const;
+
+	/** 書き込みを記録 */
+	void RecordWrite();
+
+	/** 抑制を記録 */
+	void RecordSuppressed();
+
+	/** 対象のBlackboard */
+	TWeakObjectPtr<UBlackboardComponent> Blackboard;
+
+	/** 実際に書き込んだ回数 */
+	int32 WritesIssued = 0;
+
+	/** 書き込みを省いた回数 */
+	int32 WritesSuppressed = 0;
+};
@@ -2,12 +2,14 @@
 
 #include "EnemyAIController.h"
 #include "Dawnlight.h"
+#include "DawnlightStats.h"
+#include "Subsystems/DawnlightAISignificanceManager.h"
+#include "Subsystems/PlayerContextSubsystem.h"
 #include "BehaviorTree/BehaviorTree.h"
 #include "BehaviorTree/BehaviorTreeComponent.h"
 #include "BehaviorTree/BlackboardComponent.h"
 #include "Perception/AIPerceptionComponent.h"
 #include "Perception/AISenseConfig_Sight.h"
-#include "Kismet/GameplayStatics.h"
 
 AEnemyAIController::AEnemyAIController()
 {
@@ -34,6 +36,7 @@ AEnemyAIController::AEnemyAIController()
 	TargetLocationKey = TEXT("TargetLocation");
 	InAttackRangeKey = TEXT("InAttackRange");
 	HasDetectedPlayerKey = TEXT("HasDetectedPlayer");
+	TargetLocationTolerance = 50.0f;
 
 	bHasDetectedPlayer = false;
 }
@@ -56,15 +59,27 @@ void AEnemyAIController::OnPossess(APawn* InPawn)
 		UE_LOG(LogDawnlight, Warning, TEXT("[EnemyAI] Behavior Treeが設定されていません: %s"), *GetNameSafe(InPawn));
 	}
 
+	// Blackboardのキーを解決（Behavior Tree開始後）
+	ResolveBlackboardKeys();
+
 	// 初期ターゲットとしてプレイヤーを設定
 	if (AActor* Player = FindPlayer())
 	{
 		SetTargetActor(Player);
 	}
+
+	// 距離・画面内かどうかで更新頻度を調整
+	UDawnlightAISignificanceManager::RegisterWithWorld(this);
 }
 
 void AEnemyAIController::OnUnPossess()
 {
+	UE_LOG(LogDawnlight, Verbose, TEXT("[EnemyAI] Blackboard書き込み: %d回（抑制: %d回）"),
+		BlackboardWriter.GetWritesIssued(), BlackboardWriter.GetWritesSuppressed());
+
+	// 重要度評価から外す（更新頻度は元に戻る）
+	UDawnlightAISignificanceManager::UnregisterFromWorld(this);
+
 	// Behavior Treeを停止
 	if (BehaviorTreeComponent)
 	{
@@ -86,14 +101,10 @@ void AEnemyAIController::SetTargetActor(AActor* NewTarget)
 {
 	CurrentTarget = NewTarget;
 
-	if (Blackboard)
+	BlackboardWriter.SetObject(TargetActorKeyID, NewTarget);
+	if (NewTarget)
 	{
-		Blackboard->SetValueAsObject(TargetActorKey, NewTarget);
-
-		if (NewTarget)
-		{
-			Blackboard->SetValueAsVector(TargetLocationKey, NewTarget->GetActorLocation());
-		}
+		BlackboardWriter.SetVector(TargetLocationKeyID, NewTarget->GetActorLocation());
 	}
 
 	if (NewTarget)
@@ -112,11 +123,8 @@ void AEnemyAIController::ClearTarget()
 {
 	CurrentTarget.Reset();
 
-	if (Blackboard)
-	{
-		Blackboard->ClearValue(TargetActorKey);
-		Blackboard->ClearValue(TargetLocationKey);
-	}
+	BlackboardWriter.ClearValue(TargetActorKeyID);
+	BlackboardWriter.ClearValue(TargetLocationKeyID);
 }
 
 bool AEnemyAIController::IsInAttackRange() const
@@ -145,8 +153,7 @@ void AEnemyAIController::OnTargetPerceptionUpdated(AActor* Actor, FAIStimulus St
 	}
 
 	// プレイヤーかどうかチェック
-	APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(GetWorld(), 0);
-	if (Actor != PlayerPawn)
+	if (!UPlayerContextSubsystem::IsPlayerActorInWorld(this, Actor))
 	{
 		return;
 	}
@@ -161,16 +168,15 @@ void AEnemyAIController::OnTargetPerceptionUpdated(AActor* Actor, FAIStimulus St
 	{
 		// プレイヤーを見失った（ただしすぐにはターゲットをクリアしない）
 		// 最後に見た位置は保持
-		if (Blackboard && Actor)
-		{
-			Blackboard->SetValueAsVector(TargetLocationKey, Actor->GetActorLocation());
-		}
+		BlackboardWriter.SetVector(TargetLocationKeyID, Actor->GetActorLocation());
 		UE_LOG(LogDawnlight, Log, TEXT("[EnemyAI] プレイヤーを見失った"));
 	}
 }
 
 void AEnemyAIController::UpdateBlackboard()
 {
+	DAWNLIGHT_SCOPE_CYCLE_COUNTER(STAT_DawnlightEnemyBlackboard);
+
 	if (!Blackboard)
 	{
 		return;
@@ -178,22 +184,32 @@ void AEnemyAIController::UpdateBlackboard()
 
 	AActor* Target = CurrentTarget.Get();
 
-	// ターゲット位置を更新
+	// ターゲット位置を更新（少し動いただけでは書き込まない）
 	if (Target)
 	{
-		Blackboard->SetValueAsVector(TargetLocationKey, Target->GetActorLocation());
+		BlackboardWriter.SetVector(TargetLocationKeyID, Target->GetActorLocation(), TargetLocationTolerance);
 	}
 
 	// 攻撃距離フラグを更新
-	Blackboard->SetValueAsBool(InAttackRangeKey, IsInAttackRange());
+	BlackboardWriter.SetBool(InAttackRangeKeyID, IsInAttackRange());
 
 	// 検知フラグを更新
-	Blackboard->SetValueAsBool(HasDetectedPlayerKey, bHasDetectedPlayer);
+	BlackboardWriter.SetBool(HasDetectedPlayerKeyID, bHasDetectedPlayer);
+}
+
+void AEnemyAIController::ResolveBlackboardKeys()
+{
+	BlackboardWriter.Reset(Blackboard);
+
+	TargetActorKeyID = BlackboardWriter.ResolveKey(TargetActorKey);
+	TargetLocationKeyID = BlackboardWriter.ResolveKey(TargetLocationKey);
+	InAttackRangeKeyID = BlackboardWriter.ResolveKey(InAttackRangeKey);
+	HasDetectedPlayerKeyID = BlackboardWriter.ResolveKey(HasDetectedPlayerKey);
 }
 
 AActor* AEnemyAIController::FindPlayer() const
 {
-	return UGameplayStatics::GetPlayerPawn(GetWorld(), 0);
+	return UPlayerContextSubsystem::GetPlayerPawnInWorld(this);
 }
 
 void AEnemyAIController::SetupPerception()
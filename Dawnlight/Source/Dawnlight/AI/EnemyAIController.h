@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "AIController.h"
 #include "Perception/AIPerceptionTypes.h"
+#include "BlackboardWriteCache.h"
 #include "EnemyAIController.generated.h"
 
 class UBehaviorTreeComponent;
@@ -84,6 +85,10 @@ public:
 	UPROPERTY(EditDefaultsOnly, Category = "AI|Blackboard")
 	FName HasDetectedPlayerKey;
 
+	/** ターゲット位置がこの距離以上動いた場合のみBlackboardを更新 */
+	UPROPERTY(EditDefaultsOnly, Category = "AI|Blackboard", meta = (ClampMin = "0"))
+	float TargetLocationTolerance;
+
 protected:
 	// ========================================================================
 	// コンポーネント
@@ -136,6 +141,15 @@ protected:
 	UPROPERTY()
 	TWeakObjectPtr<AActor> CurrentTarget;
 
+	/** Blackboardへの書き込み（値が変わった場合のみ） */
+	FBlackboardWriteCache BlackboardWriter;
+
+	/** 解決済みのキーID */
+	FBlackboard::FKey TargetActorKeyID = FBlackboard::InvalidKey;
+	FBlackboard::FKey TargetLocationKeyID = FBlackboard::InvalidKey;
+	FBlackboard::FKey InAttackRangeKeyID = FBlackboard::InvalidKey;
+	FBlackboard::FKey HasDetectedPlayerKeyID = FBlackboard::InvalidKey;
+
 	// ========================================================================
 	// 内部処理
 	// ========================================================================
@@ -147,6 +161,9 @@ protected:
 	/** Blackboardを更新 */
 	void UpdateBlackboard();
 
+	/** Blackboardのキー名をキーIDに解決 */
+	void ResolveBlackboardKeys();
+
 	/** プレイヤーを検索 */
 	AActor* FindPlayer() const;
 
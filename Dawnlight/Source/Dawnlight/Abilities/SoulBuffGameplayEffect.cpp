@@ -2,6 +2,7 @@
 
 #include "SoulBuffGameplayEffect.h"
 #include "DawnlightAttributeSet.h"
+#include "DawnlightTags.h"
 #include "GameplayEffectComponents/TargetTagsGameplayEffectComponent.h"
 
 // ============================================================================
@@ -24,6 +25,20 @@ USoulBuffGameplayEffect::USoulBuffGameplayEffect()
 	StackPeriodResetPolicy = EGameplayEffectStackingPeriodPolicy::ResetOnSuccessfulApplication;
 }
 
+void USoulBuffGameplayEffect::AddSoulBuffModifier(const FGameplayAttribute& Attribute)
+{
+	// 効果量は魂データから SetByCaller で渡される（スタック数倍で集計される）
+	FSetByCallerFloat SetByCaller;
+	SetByCaller.DataTag = SoulReaperTags::Data_SoulBuff;
+
+	FGameplayModifierInfo ModifierInfo;
+	ModifierInfo.Attribute = Attribute;
+	ModifierInfo.ModifierOp = EGameplayModOp::Additive;
+	ModifierInfo.ModifierMagnitude = FGameplayEffectModifierMagnitude(SetByCaller);
+
+	Modifiers.Add(ModifierInfo);
+}
+
 // ============================================================================
 // USoulBuff_Power（攻撃力UP）
 // ============================================================================
@@ -34,12 +49,7 @@ USoulBuff_Power::USoulBuff_Power()
 	EffectPerSoul = 5.0f; // 1個あたり5%
 
 	// DamageMultiplier を加算
-	FGameplayModifierInfo ModifierInfo;
-	ModifierInfo.Attribute = UDawnlightAttributeSet::GetDamageMultiplierAttribute();
-	ModifierInfo.ModifierOp = EGameplayModOp::Additive;
-	ModifierInfo.ModifierMagnitude = FGameplayEffectModifierMagnitude(FScalableFloat(0.05f)); // 5%
-
-	Modifiers.Add(ModifierInfo);
+	AddSoulBuffModifier(UDawnlightAttributeSet::GetDamageMultiplierAttribute());
 }
 
 // ============================================================================
@@ -52,12 +62,7 @@ USoulBuff_Speed::USoulBuff_Speed()
 	EffectPerSoul = 5.0f;
 
 	// SpeedMultiplier を加算
-	FGameplayModifierInfo ModifierInfo;
-	ModifierInfo.Attribute = UDawnlightAttributeSet::GetSpeedMultiplierAttribute();
-	ModifierInfo.ModifierOp = EGameplayModOp::Additive;
-	ModifierInfo.ModifierMagnitude = FGameplayEffectModifierMagnitude(FScalableFloat(0.05f));
-
-	Modifiers.Add(ModifierInfo);
+	AddSoulBuffModifier(UDawnlightAttributeSet::GetSpeedMultiplierAttribute());
 }
 
 // ============================================================================
@@ -70,12 +75,20 @@ USoulBuff_Guard::USoulBuff_Guard()
 	EffectPerSoul = 5.0f;
 
 	// DefenseBonus を加算
-	FGameplayModifierInfo ModifierInfo;
-	ModifierInfo.Attribute = UDawnlightAttributeSet::GetDefenseBonusAttribute();
-	ModifierInfo.ModifierOp = EGameplayModOp::Additive;
-	ModifierInfo.ModifierMagnitude = FGameplayEffectModifierMagnitude(FScalableFloat(5.0f)); // 5%ダメージ軽減
+	AddSoulBuffModifier(UDawnlightAttributeSet::GetDefenseBonusAttribute());
+}
 
-	Modifiers.Add(ModifierInfo);
+// ============================================================================
+// USoulBuff_Cooldown（クールダウン短縮）
+// ============================================================================
+
+USoulBuff_Cooldown::USoulBuff_Cooldown()
+{
+	BuffType = ESoulBuffType::Cooldown;
+	EffectPerSoul = 5.0f; // 1個あたり5%短縮
+
+	// CooldownReduction を加算
+	AddSoulBuffModifier(UDawnlightAttributeSet::GetCooldownReductionAttribute());
 }
 
 // ============================================================================
@@ -88,12 +101,7 @@ USoulBuff_Luck::USoulBuff_Luck()
 	EffectPerSoul = 3.0f; // 1個あたり3%クリティカル率
 
 	// Luck を加算
-	FGameplayModifierInfo ModifierInfo;
-	ModifierInfo.Attribute = UDawnlightAttributeSet::GetLuckAttribute();
-	ModifierInfo.ModifierOp = EGameplayModOp::Additive;
-	ModifierInfo.ModifierMagnitude = FGameplayEffectModifierMagnitude(FScalableFloat(3.0f));
-
-	Modifiers.Add(ModifierInfo);
+	AddSoulBuffModifier(UDawnlightAttributeSet::GetLuckAttribute());
 }
 
 // ============================================================================
@@ -156,8 +164,10 @@ UDamageGameplayEffect::UDamageGameplayEffect()
 	ModifierInfo.ModifierOp = EGameplayModOp::Additive;
 
 	// SetByCallerで実際のダメージ値を設定
-	// 使用時: EffectContext->SetMagnitude() または SetByCallerTagMagnitudes
-	ModifierInfo.ModifierMagnitude = FGameplayEffectModifierMagnitude(FScalableFloat(10.0f)); // デフォルト10ダメージ
+	// 使用時: Spec.SetSetByCallerMagnitude(SoulReaperTags::Data_Damage, Damage)
+	FSetByCallerFloat SetByCaller;
+	SetByCaller.DataTag = SoulReaperTags::Data_Damage;
+	ModifierInfo.ModifierMagnitude = FGameplayEffectModifierMagnitude(SetByCaller);
 
 	Modifiers.Add(ModifierInfo);
 }
@@ -14,6 +14,7 @@
  * 魂収集で得られるバフ効果のベースクラス
  * - 各魂タイプに対応したAttribute修正
  * - スタック可能（収集数に応じて効果増加）
+ * - 1スタックあたりの効果量は SetByCaller（Data.SoulBuff）で指定（USoulCollectionSubsystem から適用）
  */
 UCLASS(Abstract, Blueprintable)
 class DAWNLIGHT_API USoulBuffGameplayEffect : public UGameplayEffect
@@ -38,6 +39,10 @@ public:
 	/** 最大スタック数 */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "魂バフ", meta = (ClampMin = "1"))
 	int32 MaxStacks;
+
+protected:
+	/** 1スタックあたり Data.SoulBuff の値を加算するModifierを追加 */
+	void AddSoulBuffModifier(const FGameplayAttribute& Attribute);
 };
 
 /**
@@ -76,6 +81,18 @@ public:
 	USoulBuff_Guard();
 };
 
+/**
+ * クールダウンバフ（クールダウン短縮）
+ */
+UCLASS()
+class DAWNLIGHT_API USoulBuff_Cooldown : public USoulBuffGameplayEffect
+{
+	GENERATED_BODY()
+
+public:
+	USoulBuff_Cooldown();
+};
+
 /**
  * ラックバフ（クリティカル率UP）
  */
@@ -120,6 +137,7 @@ public:
  * ダメージGameplayEffect
  *
  * ダメージ適用用のGameplayEffect
+ * ダメージ量は SetByCaller（Data.Damage）で指定する（UDamagePipelineSubsystem から適用）
  */
 UCLASS()
 class DAWNLIGHT_API UDamageGameplayEffect : public UGameplayEffect
@@ -5,6 +5,7 @@
 #include "Core/DawnlightGameMode.h"
 #include "Data/EnemyDataAsset.h"
 #include "Data/SoulDataAsset.h"
+#include "Data/WaveScheduleDataAsset.h"
 #include "Subsystems/AnimalSpawnerSubsystem.h"
 #include "Subsystems/WaveSpawnerSubsystem.h"
 #include "Subsystems/SoulCollectionSubsystem.h"
@@ -64,8 +65,15 @@ void ASoulReaperLevelSetup::SetupSubsystems()
 	WaveSpawner = World->GetSubsystem<UWaveSpawnerSubsystem>();
 	if (WaveSpawner.IsValid())
 	{
-		// ウェーブ設定を渡す
-		WaveSpawner->InitializeWaveSystem(WaveConfigs);
+		// ウェーブ設定を渡す（スケジュールがあればベイク済みタイムラインを使用）
+		if (WaveSchedule)
+		{
+			WaveSpawner->InitializeWaveSchedule(WaveSchedule);
+		}
+		else
+		{
+			WaveSpawner->InitializeWaveSystem(WaveConfigs);
+		}
 
 		// デフォルト敵データを設定
 		if (DefaultEnemyData)
@@ -146,39 +154,11 @@ void ASoulReaperLevelSetup::StartDawnPhase()
 
 void ASoulReaperLevelSetup::GenerateDefaultWaveConfigs()
 {
-	WaveConfigs.Empty();
-
-	// Wave 1: 導入（簡単）
-	FWaveConfig Wave1;
-	Wave1.WaveNumber = 1;
-	Wave1.TotalEnemies = 5;
-	Wave1.MaxConcurrentEnemies = 2;
-	Wave1.SpawnInterval = 3.0f;
-	Wave1.HealthMultiplier = 1.0f;
-	Wave1.DamageMultiplier = 1.0f;
-	WaveConfigs.Add(Wave1);
-
-	// Wave 2: 中盤（通常）
-	FWaveConfig Wave2;
-	Wave2.WaveNumber = 2;
-	Wave2.TotalEnemies = 8;
-	Wave2.MaxConcurrentEnemies = 3;
-	Wave2.SpawnInterval = 2.5f;
-	Wave2.HealthMultiplier = 1.2f;
-	Wave2.DamageMultiplier = 1.1f;
-	WaveConfigs.Add(Wave2);
-
-	// Wave 3: クライマックス（難しい）
-	FWaveConfig Wave3;
-	Wave3.WaveNumber = 3;
-	Wave3.TotalEnemies = 12;
-	Wave3.MaxConcurrentEnemies = 4;
-	Wave3.SpawnInterval = 2.0f;
-	Wave3.HealthMultiplier = 1.5f;
-	Wave3.DamageMultiplier = 1.3f;
-	WaveConfigs.Add(Wave3);
-
-	UE_LOG(LogDawnlight, Log, TEXT("[SoulReaperLevelSetup] デフォルトウェーブ設定を生成: 3ウェーブ"));
+	// ウェーブスケジュール（未設定ならアセットのひな形: 導入 → 中盤 → クライマックス）からコピー
+	const UWaveScheduleDataAsset* Schedule = WaveSchedule ? WaveSchedule.Get() : GetDefault<UWaveScheduleDataAsset>();
+	WaveConfigs = Schedule->GetWaveConfigs(0);
+
+	UE_LOG(LogDawnlight, Log, TEXT("[SoulReaperLevelSetup] デフォルトウェーブ設定を生成: %dウェーブ"), WaveConfigs.Num());
 }
 
 void ASoulReaperLevelSetup::OnNightPhaseEnd()
@@ -10,6 +10,7 @@
 
 class USoulDataAsset;
 class UEnemyDataAsset;
+class UWaveScheduleDataAsset;
 class UBoxComponent;
 
 /**
@@ -59,6 +60,10 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dawn Phase|ウェーブ")
 	TArray<FWaveConfig> WaveConfigs;
 
+	/** ウェーブスケジュール（設定時はベイク済みタイムラインでスポーンし、ウェーブ設定リストより優先） */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dawn Phase|ウェーブ")
+	TObjectPtr<UWaveScheduleDataAsset> WaveSchedule;
+
 	/** デフォルト敵データ */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dawn Phase|敵")
 	TObjectPtr<UEnemyDataAsset> DefaultEnemyData;
@@ -116,7 +121,7 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "ゲームフロー")
 	void StartDawnPhase();
 
-	/** デフォルトのウェーブ設定を生成 */
+	/** デフォルトのウェーブ設定を生成（ウェーブスケジュール、未設定ならそのひな形からコピー） */
 	UFUNCTION(BlueprintCallable, Category = "設定")
 	void GenerateDefaultWaveConfigs();
 
@@ -3,10 +3,12 @@
 #include "AnimalCharacter.h"
 #include "Dawnlight.h"
 #include "Data/SoulDataAsset.h"
-#include "Subsystems/SoulCollectionSubsystem.h"
+#include "Subsystems/SoulPickupManager.h"
+#include "Subsystems/SpatialGridSubsystem.h"
+#include "Subsystems/AnimalHerdSubsystem.h"
+#include "Subsystems/DawnlightVFXManager.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Kismet/GameplayStatics.h"
-#include "NiagaraFunctionLibrary.h"
 #include "NiagaraSystem.h"
 
 AAnimalCharacter::AAnimalCharacter()
@@ -41,33 +43,118 @@ void AAnimalCharacter::BeginPlay()
 {
 	Super::BeginPlay();
 
+	// プリウォーム時はSoulDataがないため、最初のプール取得時に初期化する
+	if (bPrewarmSpawn)
+	{
+		bPrewarmSpawn = false;
+		return;
+	}
+
+	InitializeSpawnState();
+}
+
+void AAnimalCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UnregisterFromSubsystems();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void AAnimalCharacter::InitializeSpawnState()
+{
 	// スポーン位置を記録
 	SpawnLocation = GetActorLocation();
 
+	// HPをリセット（SoulDataがない場合はクラスのデフォルト値）
+	CurrentHealth = GetClass()->GetDefaultObject<AAnimalCharacter>()->CurrentHealth;
+
 	// SoulDataからパラメータを初期化
 	InitializeFromSoulData();
 
 	// プレイヤーをキャッシュ
 	CachedPlayer = UGameplayStatics::GetPlayerPawn(this, 0);
 
-	// 最初の徘徊目的地を設定
+	// 最初の徘徊目的地を設定（SetNewWanderTargetは死亡/逃走中は何もしないため先に状態を戻す）
+	BehaviorState = EAnimalBehaviorState::Idle;
 	SetNewWanderTarget();
 
-	// 徘徊タイマーを開始
-	GetWorld()->GetTimerManager().SetTimer(
-		WanderTimerHandle,
-		this,
-		&AAnimalCharacter::SetNewWanderTarget,
-		WanderInterval,
-		true
-	);
-
 	// 徘徊状態で開始
 	BehaviorState = EAnimalBehaviorState::Wandering;
 
+	// 群れサブシステムでまとめて更新（サブシステムがない場合は個別Tickと徘徊タイマー）
+	if (UAnimalHerdSubsystem* Herd = GetWorld()->GetSubsystem<UAnimalHerdSubsystem>())
+	{
+		Herd->RegisterAnimal(this);
+	}
+	else
+	{
+		GetWorld()->GetTimerManager().SetTimer(
+			WanderTimerHandle,
+			this,
+			&AAnimalCharacter::SetNewWanderTarget,
+			WanderInterval,
+			true
+		);
+	}
+
+	// 近接クエリ用に空間グリッドへ登録
+	USpatialGridSubsystem::RegisterWithWorld(this, EDawnlightSpatialCategory::Animal);
+
 	UE_LOG(LogDawnlight, Log, TEXT("[AnimalCharacter] %s がスポーン HP: %.0f"), *GetName(), CurrentHealth);
 }
 
+void AAnimalCharacter::OnAcquiredFromPool()
+{
+	// Die()で無効化した移動を復帰
+	if (UCharacterMovementComponent* Movement = GetCharacterMovement())
+	{
+		Movement->SetComponentTickEnabled(true);
+		Movement->SetDefaultMovementMode();
+	}
+
+	InitializeSpawnState();
+}
+
+void AAnimalCharacter::OnReleasedToPool()
+{
+	BehaviorState = EAnimalBehaviorState::Dead;
+	UnregisterFromSubsystems();
+	CachedPlayer.Reset();
+
+	if (UCharacterMovementComponent* Movement = GetCharacterMovement())
+	{
+		Movement->StopMovementImmediately();
+		Movement->DisableMovement();
+		Movement->SetComponentTickEnabled(false);
+	}
+}
+
+void AAnimalCharacter::ReturnToPool()
+{
+	if (UWorld* World = GetWorld())
+	{
+		if (UActorPoolSubsystem* Pool = World->GetSubsystem<UActorPoolSubsystem>())
+		{
+			Pool->ReleaseActor(this);
+			return;
+		}
+	}
+
+	Destroy();
+}
+
+void AAnimalCharacter::UnregisterFromSubsystems()
+{
+	if (UWorld* World = GetWorld())
+	{
+		if (UAnimalHerdSubsystem* Herd = World->GetSubsystem<UAnimalHerdSubsystem>())
+		{
+			Herd->UnregisterAnimal(this);
+		}
+	}
+	USpatialGridSubsystem::UnregisterFromWorld(this);
+}
+
 void AAnimalCharacter::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
@@ -126,45 +213,70 @@ void AAnimalCharacter::InitializeFromSoulData()
 
 void AAnimalCharacter::UpdateBehaviorState()
 {
-	if (BehaviorState == EAnimalBehaviorState::Dead || BehaviorState == EAnimalBehaviorState::Stunned)
+	const float DistanceToPlayer = GetDistanceToPlayer();
+	SetBehaviorState(EvaluateBehaviorState(
+		BehaviorState,
+		DistanceToPlayer == MAX_FLT ? MAX_FLT : FMath::Square(DistanceToPlayer),
+		FMath::Square(FleeRadius),
+		FMath::Square(DetectionRadius)));
+}
+
+EAnimalBehaviorState AAnimalCharacter::EvaluateBehaviorState(EAnimalBehaviorState CurrentState, float DistanceToPlayerSq, float FleeRadiusSq, float DetectionRadiusSq)
+{
+	if (CurrentState == EAnimalBehaviorState::Dead || CurrentState == EAnimalBehaviorState::Stunned)
 	{
-		return;
+		return CurrentState;
 	}
 
-	const float DistanceToPlayer = GetDistanceToPlayer();
-
 	// プレイヤーが逃走距離内にいる場合
-	if (DistanceToPlayer <= FleeRadius)
+	if (DistanceToPlayerSq <= FleeRadiusSq)
 	{
-		if (BehaviorState != EAnimalBehaviorState::Fleeing)
-		{
-			BehaviorState = EAnimalBehaviorState::Fleeing;
+		return EAnimalBehaviorState::Fleeing;
+	}
+
+	// プレイヤーが検知距離外に出た場合、徘徊に戻る
+	if (CurrentState == EAnimalBehaviorState::Fleeing && DistanceToPlayerSq > DetectionRadiusSq)
+	{
+		return EAnimalBehaviorState::Wandering;
+	}
 
-			// 逃走速度に変更
-			if (UCharacterMovementComponent* Movement = GetCharacterMovement())
-			{
-				Movement->MaxWalkSpeed = FleeSpeed;
-			}
+	return CurrentState;
+}
 
-			OnStartFleeing();
-			UE_LOG(LogDawnlight, Verbose, TEXT("[AnimalCharacter] %s: 逃走開始"), *GetName());
-		}
+void AAnimalCharacter::SetBehaviorState(EAnimalBehaviorState NewState)
+{
+	if (BehaviorState == NewState)
+	{
+		return;
 	}
-	// プレイヤーが検知距離外に出た場合、徘徊に戻る
-	else if (DistanceToPlayer > DetectionRadius)
+
+	BehaviorState = NewState;
+
+	switch (NewState)
 	{
-		if (BehaviorState == EAnimalBehaviorState::Fleeing)
+	case EAnimalBehaviorState::Fleeing:
+		// 逃走速度に変更
+		if (UCharacterMovementComponent* Movement = GetCharacterMovement())
 		{
-			BehaviorState = EAnimalBehaviorState::Wandering;
+			Movement->MaxWalkSpeed = FleeSpeed;
+		}
 
-			// 徘徊速度に戻す
-			if (UCharacterMovementComponent* Movement = GetCharacterMovement())
-			{
-				Movement->MaxWalkSpeed = WanderSpeed;
-			}
+		OnStartFleeing();
+		UE_LOG(LogDawnlight, Verbose, TEXT("[AnimalCharacter] %s: 逃走開始"), *GetName());
+		break;
 
-			UE_LOG(LogDawnlight, Verbose, TEXT("[AnimalCharacter] %s: 徘徊に戻る"), *GetName());
+	case EAnimalBehaviorState::Wandering:
+		// 徘徊速度に戻す
+		if (UCharacterMovementComponent* Movement = GetCharacterMovement())
+		{
+			Movement->MaxWalkSpeed = WanderSpeed;
 		}
+
+		UE_LOG(LogDawnlight, Verbose, TEXT("[AnimalCharacter] %s: 徘徊に戻る"), *GetName());
+		break;
+
+	default:
+		break;
 	}
 }
 
@@ -264,17 +376,7 @@ void AAnimalCharacter::TakeDamageFromPlayer(float DamageAmount, AActor* DamageCa
 	else
 	{
 		// ダメージを受けたら即座に逃走
-		if (BehaviorState != EAnimalBehaviorState::Fleeing)
-		{
-			BehaviorState = EAnimalBehaviorState::Fleeing;
-
-			if (UCharacterMovementComponent* Movement = GetCharacterMovement())
-			{
-				Movement->MaxWalkSpeed = FleeSpeed;
-			}
-
-			OnStartFleeing();
-		}
+		SetBehaviorState(EAnimalBehaviorState::Fleeing);
 	}
 }
 
@@ -286,6 +388,7 @@ void AAnimalCharacter::Die()
 	}
 
 	BehaviorState = EAnimalBehaviorState::Dead;
+	UnregisterFromSubsystems();
 
 	UE_LOG(LogDawnlight, Log, TEXT("[AnimalCharacter] %s が死亡"), *GetName());
 
@@ -302,9 +405,10 @@ void AAnimalCharacter::Die()
 	// 死亡エフェクト
 	if (DeathEffect)
 	{
-		UNiagaraFunctionLibrary::SpawnSystemAtLocation(
+		UDawnlightVFXManager::SpawnAtLocationInWorld(
 			this,
 			DeathEffect,
+			EDawnlightVFXCategory::Death,
 			GetActorLocation(),
 			GetActorRotation()
 		);
@@ -316,8 +420,14 @@ void AAnimalCharacter::Die()
 	// 死亡イベント（Blueprint実装可能）
 	OnDeath();
 
-	// 少し待ってから削除
-	SetLifeSpan(2.0f);
+	// 少し待ってからプールに返却
+	GetWorld()->GetTimerManager().SetTimer(
+		DespawnTimerHandle,
+		this,
+		&AAnimalCharacter::ReturnToPool,
+		FMath::Max(DespawnDelay, KINDA_SMALL_NUMBER),
+		false
+	);
 }
 
 void AAnimalCharacter::DropSoul()
@@ -328,26 +438,23 @@ void AAnimalCharacter::DropSoul()
 		return;
 	}
 
-	// SoulCollectionSubsystemに魂を追加
-	if (UWorld* World = GetWorld())
+	const FVector DropLocation = GetActorLocation() + FVector(0.0f, 0.0f, 50.0f);
+
+	// 魂ピックアップをドロップ（プレイヤーが近づくと吸い寄せられて収集される）
+	if (USoulPickupManager::DropSoulInWorld(this, SoulData, DropLocation, true))
 	{
-		if (USoulCollectionSubsystem* SoulSystem = World->GetSubsystem<USoulCollectionSubsystem>())
+		UE_LOG(LogDawnlight, Log, TEXT("[AnimalCharacter] %s: 魂 '%s' をドロップ"),
+			*GetName(), *SoulData->DisplayName.ToString());
+
+		// 魂放出エフェクト
+		if (SoulReleaseEffect)
 		{
-			SoulSystem->CollectSoul(SoulData->SoulTag, GetActorLocation());
-
-			UE_LOG(LogDawnlight, Log, TEXT("[AnimalCharacter] %s: 魂 '%s' をドロップ"),
-				*GetName(), *SoulData->DisplayName.ToString());
-
-			// 魂放出エフェクト
-			if (SoulReleaseEffect)
-			{
-				UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-					this,
-					SoulReleaseEffect,
-					GetActorLocation() + FVector(0.0f, 0.0f, 50.0f),
-					FRotator::ZeroRotator
-				);
-			}
+			UDawnlightVFXManager::SpawnAtLocationInWorld(
+				this,
+				SoulReleaseEffect,
+				EDawnlightVFXCategory::SoulCollect,
+				DropLocation
+			);
 		}
 	}
 }
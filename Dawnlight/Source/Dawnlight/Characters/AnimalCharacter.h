@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Character.h"
 #include "GameplayTagContainer.h"
+#include "Subsystems/ActorPoolSubsystem.h"
 #include "AnimalCharacter.generated.h"
 
 class USoulDataAsset;
@@ -32,7 +33,7 @@ enum class EAnimalBehaviorState : uint8
  * - 倒されると魂をドロップ
  */
 UCLASS(Blueprintable)
-class DAWNLIGHT_API AAnimalCharacter : public ACharacter
+class DAWNLIGHT_API AAnimalCharacter : public ACharacter, public IDawnlightPoolableActor
 {
 	GENERATED_BODY()
 
@@ -41,9 +42,18 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void Tick(float DeltaTime) override;
 
 public:
+	// ========================================================================
+	// IDawnlightPoolableActor インターフェース
+	// ========================================================================
+
+	virtual void OnAcquiredFromPool() override;
+	virtual void OnReleasedToPool() override;
+	virtual void MarkAsPrewarmSpawn() override { bPrewarmSpawn = true; }
+
 	// ========================================================================
 	// 設定
 	// ========================================================================
@@ -112,6 +122,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "動物")
 	void Die();
 
+	/** プールに返却（プールがない場合は破棄） */
+	UFUNCTION(BlueprintCallable, Category = "動物")
+	void ReturnToPool();
+
 	/** HPの割合を取得 */
 	UFUNCTION(BlueprintPure, Category = "動物")
 	float GetHealthPercent() const;
@@ -120,6 +134,22 @@ public:
 	UFUNCTION(BlueprintPure, Category = "動物")
 	bool IsAlive() const { return BehaviorState != EAnimalBehaviorState::Dead; }
 
+	// ========================================================================
+	// 群れシミュレーション（UAnimalHerdSubsystem から使用）
+	// ========================================================================
+
+	/**
+	 * プレイヤーとの距離から次の行動状態を求める
+	 * スレッドセーフ（アクターにアクセスしない）
+	 */
+	static EAnimalBehaviorState EvaluateBehaviorState(EAnimalBehaviorState CurrentState, float DistanceToPlayerSq, float FleeRadiusSq, float DetectionRadiusSq);
+
+	/** 行動状態を変更（移動速度の切り替えと逃走開始イベント） */
+	void SetBehaviorState(EAnimalBehaviorState NewState);
+
+	/** 徘徊の中心（スポーン位置） */
+	const FVector& GetHomeLocation() const { return SpawnLocation; }
+
 	// ========================================================================
 	// イベント
 	// ========================================================================
@@ -150,10 +180,20 @@ protected:
 	/** 徘徊タイマー */
 	FTimerHandle WanderTimerHandle;
 
+	/** 死亡後のプール返却タイマー */
+	FTimerHandle DespawnTimerHandle;
+
+	/** 死亡からプール返却までの時間（秒） */
+	UPROPERTY(EditDefaultsOnly, Category = "動物|設定", meta = (ClampMin = "0.0"))
+	float DespawnDelay = 2.0f;
+
 	/** プレイヤーへの参照（キャッシュ） */
 	UPROPERTY()
 	TWeakObjectPtr<AActor> CachedPlayer;
 
+	/** 群れ・空間グリッドから登録解除 */
+	void UnregisterFromSubsystems();
+
 	/** 行動状態を更新 */
 	void UpdateBehaviorState();
 
@@ -172,9 +212,15 @@ protected:
 	/** プレイヤーから離れる方向を取得 */
 	FVector GetFleeDirection() const;
 
-	/** ソウルをドロップ */
+	/** ソウルをドロップ（USoulPickupManager のピックアップとして出現） */
 	void DropSoul();
 
 	/** SoulDataからパラメータを初期化 */
 	void InitializeFromSoulData();
+
+	/** スポーン時の状態を初期化（BeginPlay/プール取得時） */
+	void InitializeSpawnState();
+
+	/** プリウォームでスポーンされたか（BeginPlay でSoulDataに依存する初期化を省略する） */
+	bool bPrewarmSpawn = false;
 };
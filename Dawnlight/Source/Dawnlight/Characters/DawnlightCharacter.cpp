@@ -6,7 +6,9 @@
 #include "DawnlightTags.h"
 #include "DawnlightAttributeSet.h"
 #include "Components/ReaperModeComponent.h"
+#include "Subsystems/SpatialGridSubsystem.h"
 #include "AbilitySystemComponent.h"
+#include "GameplayEffectTypes.h"
 #include "GameFramework/SpringArmComponent.h"
 #include "Camera/CameraComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
@@ -107,12 +109,31 @@ void ADawnlightCharacter::BeginPlay()
 	// HPを最大値にリセット
 	CurrentHealth = MaxHealth;
 
+	// HPの実体は AttributeSet（GameplayEffect のダメージを CurrentHealth に反映）
+	if (AbilitySystemComponent && AttributeSet)
+	{
+		AbilitySystemComponent->SetNumericAttributeBase(UDawnlightAttributeSet::GetMaxHealthAttribute(), MaxHealth);
+		AbilitySystemComponent->SetNumericAttributeBase(UDawnlightAttributeSet::GetHealthAttribute(), MaxHealth);
+		AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(UDawnlightAttributeSet::GetHealthAttribute())
+			.AddUObject(this, &ADawnlightCharacter::OnHealthAttributeChanged);
+	}
+
 	// リーパーモードコンポーネントのイベントをバインド
 	BindReaperModeEvents();
 
+	// 敵の攻撃範囲判定・近接攻撃のヒット判定の対象として空間グリッドに登録
+	USpatialGridSubsystem::RegisterWithWorld(this, EDawnlightSpatialCategory::Player);
+
 	UE_LOG(LogDawnlight, Log, TEXT("SoulReaper: BeginPlay - HP: %f/%f"), CurrentHealth, MaxHealth);
 }
 
+void ADawnlightCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	USpatialGridSubsystem::UnregisterFromWorld(this);
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void ADawnlightCharacter::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
@@ -360,6 +381,16 @@ void ADawnlightCharacter::TakeDamageAmount(float DamageAmount)
 		return;
 	}
 
+	// AttributeSet を更新（OnHealthAttributeChanged で CurrentHealth に反映）
+	if (AbilitySystemComponent && AttributeSet)
+	{
+		AbilitySystemComponent->SetNumericAttributeBase(
+			UDawnlightAttributeSet::GetHealthAttribute(),
+			FMath::Max(0.0f, CurrentHealth - DamageAmount)
+		);
+		return;
+	}
+
 	CurrentHealth = FMath::Max(0.0f, CurrentHealth - DamageAmount);
 
 	UE_LOG(LogDawnlight, Log, TEXT("SoulReaper: Took %f damage. HP: %f/%f"), DamageAmount, CurrentHealth, MaxHealth);
@@ -370,6 +401,23 @@ void ADawnlightCharacter::TakeDamageAmount(float DamageAmount)
 	}
 }
 
+void ADawnlightCharacter::OnHealthAttributeChanged(const FOnAttributeChangeData& Data)
+{
+	if (bIsDead)
+	{
+		return;
+	}
+
+	CurrentHealth = FMath::Max(0.0f, Data.NewValue);
+
+	UE_LOG(LogDawnlight, Log, TEXT("SoulReaper: HP changed %f -> %f (Max: %f)"), Data.OldValue, CurrentHealth, MaxHealth);
+
+	if (CurrentHealth <= 0.0f)
+	{
+		HandleDeath();
+	}
+}
+
 bool ADawnlightCharacter::IsDead() const
 {
 	return bIsDead;
@@ -11,6 +11,7 @@
 
 class UAbilitySystemComponent;
 class UDawnlightAttributeSet;
+struct FOnAttributeChangeData;
 class USpringArmComponent;
 class UCameraComponent;
 class UReaperModeComponent;
@@ -41,6 +42,10 @@ public:
 	UFUNCTION(BlueprintPure, Category = "アビリティ")
 	UDawnlightAttributeSet* GetDawnlightAttributeSet() const { return AttributeSet; }
 
+	/** リーパーモードコンポーネントを取得 */
+	UFUNCTION(BlueprintPure, Category = "リーパー")
+	UReaperModeComponent* GetReaperModeComponent() const { return ReaperModeComponent; }
+
 	// ========================================================================
 	// 移動
 	// ========================================================================
@@ -101,7 +106,7 @@ public:
 	// ダメージ
 	// ========================================================================
 
-	/** ダメージを受ける */
+	/** ダメージを受ける（防御力を無視して直接HPを減らす。通常の攻撃は UDamagePipelineSubsystem 経由） */
 	UFUNCTION(BlueprintCallable, Category = "ダメージ")
 	void TakeDamageAmount(float DamageAmount);
 
@@ -134,6 +139,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void Tick(float DeltaTime) override;
 	virtual void PossessedBy(AController* NewController) override;
 
@@ -265,6 +271,9 @@ private:
 	/** 死亡処理 */
 	void HandleDeath();
 
+	/** AttributeSet の Health 変更時（CurrentHealth に反映して死亡判定） */
+	void OnHealthAttributeChanged(const FOnAttributeChangeData& Data);
+
 	/** 攻撃終了処理（タイマーコールバック用） */
 	void EndAttack();
 
@@ -2,11 +2,16 @@
 
 #include "EnemyCharacter.h"
 #include "Dawnlight.h"
+#include "DawnlightTags.h"
 #include "Data/EnemyDataAsset.h"
 #include "Characters/DawnlightCharacter.h"
+#include "Subsystems/DamagePipelineSubsystem.h"
+#include "Subsystems/EnemyCrowdSubsystem.h"
+#include "Subsystems/PlayerFlowFieldSubsystem.h"
+#include "Subsystems/SpatialGridSubsystem.h"
+#include "Subsystems/DawnlightVFXManager.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Kismet/GameplayStatics.h"
-#include "NiagaraFunctionLibrary.h"
 #include "NiagaraSystem.h"
 
 AEnemyCharacter::AEnemyCharacter()
@@ -51,6 +56,29 @@ void AEnemyCharacter::BeginPlay()
 {
 	Super::BeginPlay();
 
+	// プリウォーム時はEnemyDataがないため、最初のプール取得時に初期化する
+	if (bPrewarmSpawn)
+	{
+		bPrewarmSpawn = false;
+		return;
+	}
+
+	InitializeSpawnState();
+}
+
+void AEnemyCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UnregisterFromSubsystems();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void AEnemyCharacter::InitializeSpawnState()
+{
+	// HPをリセット（EnemyDataがない場合はクラスのデフォルト値）
+	MaxHealth = GetClass()->GetDefaultObject<AEnemyCharacter>()->MaxHealth;
+	CurrentHealth = MaxHealth;
+
 	// EnemyDataからパラメータを初期化
 	InitializeFromEnemyData();
 
@@ -60,16 +88,85 @@ void AEnemyCharacter::BeginPlay()
 		InitializeDefaultPhaseThresholds();
 	}
 
+	// クールダウン・ボスフェーズをリセット
+	bIsAttackOnCooldown = false;
+	bIsSpecialAttackOnCooldown = false;
+	CurrentBossPhase = 1;
+
 	// プレイヤーをキャッシュ
 	CachedPlayer = UGameplayStatics::GetPlayerPawn(this, 0);
 
 	// 追跡状態で開始
 	BehaviorState = EEnemyBehaviorState::Chasing;
 
+	// 群衆サブシステムでまとめて更新（サブシステムがない場合は個別Tick）
+	if (UEnemyCrowdSubsystem* Crowd = GetWorld()->GetSubsystem<UEnemyCrowdSubsystem>())
+	{
+		Crowd->RegisterEnemy(this);
+	}
+
+	// 近接クエリ用に空間グリッドへ登録
+	USpatialGridSubsystem::RegisterWithWorld(this, EDawnlightSpatialCategory::Enemy);
+
 	UE_LOG(LogDawnlight, Log, TEXT("[EnemyCharacter] %s がスポーン HP: %.0f %s"),
 		*GetName(), CurrentHealth, bIsBoss ? TEXT("[BOSS]") : TEXT(""));
 }
 
+void AEnemyCharacter::OnAcquiredFromPool()
+{
+	// Die()で無効化した移動を復帰
+	if (UCharacterMovementComponent* Movement = GetCharacterMovement())
+	{
+		Movement->SetComponentTickEnabled(true);
+		Movement->SetDefaultMovementMode();
+	}
+
+	InitializeSpawnState();
+}
+
+void AEnemyCharacter::OnReleasedToPool()
+{
+	BehaviorState = EEnemyBehaviorState::Dead;
+	UnregisterFromSubsystems();
+	CachedPlayer.Reset();
+
+	// 前回のスポーン元のバインドを解除
+	OnEnemyDeathDelegate.Clear();
+
+	if (UCharacterMovementComponent* Movement = GetCharacterMovement())
+	{
+		Movement->StopMovementImmediately();
+		Movement->DisableMovement();
+		Movement->SetComponentTickEnabled(false);
+	}
+}
+
+void AEnemyCharacter::ReturnToPool()
+{
+	if (UWorld* World = GetWorld())
+	{
+		if (UActorPoolSubsystem* Pool = World->GetSubsystem<UActorPoolSubsystem>())
+		{
+			Pool->ReleaseActor(this);
+			return;
+		}
+	}
+
+	Destroy();
+}
+
+void AEnemyCharacter::UnregisterFromSubsystems()
+{
+	if (UWorld* World = GetWorld())
+	{
+		if (UEnemyCrowdSubsystem* Crowd = World->GetSubsystem<UEnemyCrowdSubsystem>())
+		{
+			Crowd->UnregisterEnemy(this);
+		}
+	}
+	USpatialGridSubsystem::UnregisterFromWorld(this);
+}
+
 void AEnemyCharacter::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
@@ -145,37 +242,81 @@ void AEnemyCharacter::UpdateBehaviorState()
 		return;
 	}
 
-	const float DistanceToPlayer = GetDistanceToPlayer();
+	// 攻撃範囲内のプレイヤーを空間グリッドから探す（グリッドに登録されていない場合は直接距離を測る）
+	float DistanceToPlayerSq = MAX_FLT;
+	const USpatialGridSubsystem* SpatialGrid = GetWorld()->GetSubsystem<USpatialGridSubsystem>();
+	if (SpatialGrid && CachedPlayer.IsValid() && SpatialGrid->GetGrid().Contains(CachedPlayer.Get()))
+	{
+		SpatialGrid->GetGrid().FindNearest(GetActorLocation(), AttackRange,
+			static_cast<uint8>(EDawnlightSpatialCategory::Player), &DistanceToPlayerSq);
+	}
+	else
+	{
+		const float DistanceToPlayer = GetDistanceToPlayer();
+		DistanceToPlayerSq = DistanceToPlayer == MAX_FLT ? MAX_FLT : FMath::Square(DistanceToPlayer);
+	}
+
+	const EEnemyBehaviorState NewState = EvaluateBehaviorState(BehaviorState, DistanceToPlayerSq, FMath::Square(AttackRange));
+
+	if (NewState != BehaviorState)
+	{
+		BehaviorState = NewState;
+		UE_LOG(LogDawnlight, Verbose, TEXT("[EnemyCharacter] %s: %s状態に移行"), *GetName(),
+			NewState == EEnemyBehaviorState::Attacking ? TEXT("攻撃") : TEXT("追跡"));
+	}
+}
+
+EEnemyBehaviorState AEnemyCharacter::EvaluateBehaviorState(EEnemyBehaviorState CurrentState, float DistanceToPlayerSq, float AttackRangeSq)
+{
+	if (CurrentState == EEnemyBehaviorState::Dead || CurrentState == EEnemyBehaviorState::Stunned)
+	{
+		return CurrentState;
+	}
 
 	// 攻撃範囲内にいる場合
-	if (DistanceToPlayer <= AttackRange)
+	if (DistanceToPlayerSq <= AttackRangeSq)
 	{
-		if (BehaviorState != EEnemyBehaviorState::Attacking)
-		{
-			BehaviorState = EEnemyBehaviorState::Attacking;
-			UE_LOG(LogDawnlight, Verbose, TEXT("[EnemyCharacter] %s: 攻撃状態に移行"), *GetName());
-		}
+		return EEnemyBehaviorState::Attacking;
+	}
+
+	// Dawn Phaseでは検知範囲外でも常にプレイヤーを追跡する
+	return EEnemyBehaviorState::Chasing;
+}
+
+float AEnemyCharacter::GetAttackMoveScale() const
+{
+	// 攻撃中は速度半減
+	return (EnemyData && !EnemyData->bStopWhileAttacking) ? 0.5f : 0.0f;
+}
+
+void AEnemyCharacter::ProcessCrowdActions(float DeltaTime)
+{
+	if (!IsAlive())
+	{
+		return;
 	}
-	// 検知範囲内の場合は追跡
-	else if (DistanceToPlayer <= DetectionRadius)
+
+	if (BehaviorState == EEnemyBehaviorState::Attacking && CanAttack())
 	{
-		if (BehaviorState != EEnemyBehaviorState::Chasing)
-		{
-			BehaviorState = EEnemyBehaviorState::Chasing;
-			UE_LOG(LogDawnlight, Verbose, TEXT("[EnemyCharacter] %s: 追跡状態に移行"), *GetName());
-		}
+		PerformAttack();
 	}
-	// 検知範囲外の場合は待機（ただし通常は常に追跡）
-	else
+
+	// ボス専用処理
+	if (bIsBoss)
 	{
-		// Dawn Phaseでは常にプレイヤーを追跡するため、実質的にはここには来ない
-		BehaviorState = EEnemyBehaviorState::Chasing;
+		ProcessBossLogic(DeltaTime);
 	}
 }
 
 void AEnemyCharacter::ProcessChasing(float DeltaTime)
 {
-	const FVector Direction = GetDirectionToPlayer();
+	// 共有フローフィールドがあれば壁を回り込む方向に進む
+	FVector Direction;
+	const UPlayerFlowFieldSubsystem* FlowField = GetWorld()->GetSubsystem<UPlayerFlowFieldSubsystem>();
+	if (!FlowField || !FlowField->GetFlowDirection(GetActorLocation(), Direction))
+	{
+		Direction = GetDirectionToPlayer();
+	}
 
 	if (!Direction.IsNearlyZero())
 	{
@@ -192,12 +333,13 @@ void AEnemyCharacter::ProcessAttacking(float DeltaTime)
 	}
 
 	// 攻撃中でも追跡を続ける（設定による）
-	if (EnemyData && !EnemyData->bStopWhileAttacking)
+	const float MoveScale = GetAttackMoveScale();
+	if (MoveScale > 0.0f)
 	{
 		const FVector Direction = GetDirectionToPlayer();
 		if (!Direction.IsNearlyZero())
 		{
-			AddMovementInput(Direction, 0.5f);  // 攻撃中は速度半減
+			AddMovementInput(Direction, MoveScale);
 		}
 	}
 }
@@ -258,8 +400,13 @@ void AEnemyCharacter::PerformAttack()
 			// プレイヤーがまだ攻撃範囲内にいるか確認
 			if (GetDistanceToPlayer() <= AttackRange * 1.2f)  // 少し余裕を持たせる
 			{
-				// プレイヤーにダメージを与える
-				PlayerChar->TakeDamageAmount(AttackDamage);
+				// プレイヤーにダメージを与える（フレーム末にまとめて適用）
+				FDawnlightDamageRequest Request;
+				Request.Source = this;
+				Request.Target = PlayerChar;
+				Request.Amount = AttackDamage;
+				Request.Tags.AddTag(SoulReaperTags::Damage_Type_Melee);
+				UDamagePipelineSubsystem::QueueDamageInWorld(Request);
 				UE_LOG(LogDawnlight, Log, TEXT("[EnemyCharacter] %s: プレイヤーに %.0f ダメージを与えた"), *GetName(), AttackDamage);
 			}
 		}
@@ -289,11 +436,11 @@ void AEnemyCharacter::TakeDamageFromPlayer(float DamageAmount, AActor* DamageCau
 	// ヒットエフェクト
 	if (HitEffect)
 	{
-		UNiagaraFunctionLibrary::SpawnSystemAtLocation(
+		UDawnlightVFXManager::SpawnAtLocationInWorld(
 			this,
 			HitEffect,
-			GetActorLocation() + FVector(0.0f, 0.0f, 50.0f),
-			FRotator::ZeroRotator
+			EDawnlightVFXCategory::Hit,
+			GetActorLocation() + FVector(0.0f, 0.0f, 50.0f)
 		);
 	}
 
@@ -321,6 +468,7 @@ void AEnemyCharacter::Die()
 	}
 
 	BehaviorState = EEnemyBehaviorState::Dead;
+	UnregisterFromSubsystems();
 
 	UE_LOG(LogDawnlight, Log, TEXT("[EnemyCharacter] %s が死亡"), *GetName());
 
@@ -337,9 +485,10 @@ void AEnemyCharacter::Die()
 	// 死亡エフェクト
 	if (DeathEffect)
 	{
-		UNiagaraFunctionLibrary::SpawnSystemAtLocation(
+		UDawnlightVFXManager::SpawnAtLocationInWorld(
 			this,
 			DeathEffect,
+			EDawnlightVFXCategory::Death,
 			GetActorLocation(),
 			GetActorRotation()
 		);
@@ -351,8 +500,14 @@ void AEnemyCharacter::Die()
 	// 死亡イベント（Blueprint実装可能）
 	OnDeath();
 
-	// 少し待ってから削除
-	SetLifeSpan(2.0f);
+	// 少し待ってからプールに返却
+	GetWorld()->GetTimerManager().SetTimer(
+		DespawnTimerHandle,
+		this,
+		&AEnemyCharacter::ReturnToPool,
+		FMath::Max(DespawnDelay, KINDA_SMALL_NUMBER),
+		false
+	);
 }
 
 float AEnemyCharacter::GetHealthPercent() const
@@ -412,7 +567,12 @@ void AEnemyCharacter::PerformAreaAttack(FVector CenterLocation, float Radius, fl
 	{
 		if (ADawnlightCharacter* PlayerChar = Cast<ADawnlightCharacter>(CachedPlayer.Get()))
 		{
-			PlayerChar->TakeDamageAmount(Damage);
+			FDawnlightDamageRequest Request;
+			Request.Source = this;
+			Request.Target = PlayerChar;
+			Request.Amount = Damage;
+			Request.Tags.AddTag(SoulReaperTags::Damage_Type_Area);
+			UDamagePipelineSubsystem::QueueDamageInWorld(Request);
 			UE_LOG(LogDawnlight, Log, TEXT("[EnemyCharacter] %s: 範囲攻撃がプレイヤーにヒット (Damage: %.0f)"),
 				*GetName(), Damage);
 		}
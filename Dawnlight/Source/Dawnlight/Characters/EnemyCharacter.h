@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Character.h"
 #include "GameplayTagContainer.h"
+#include "Subsystems/ActorPoolSubsystem.h"
 #include "EnemyCharacter.generated.h"
 
 class UEnemyDataAsset;
@@ -36,7 +37,7 @@ enum class EEnemyBehaviorState : uint8
  * - 倒されると経験値/アイテムをドロップ
  */
 UCLASS(Blueprintable)
-class DAWNLIGHT_API AEnemyCharacter : public ACharacter
+class DAWNLIGHT_API AEnemyCharacter : public ACharacter, public IDawnlightPoolableActor
 {
 	GENERATED_BODY()
 
@@ -45,9 +46,18 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void Tick(float DeltaTime) override;
 
 public:
+	// ========================================================================
+	// IDawnlightPoolableActor インターフェース
+	// ========================================================================
+
+	virtual void OnAcquiredFromPool() override;
+	virtual void OnReleasedToPool() override;
+	virtual void MarkAsPrewarmSpawn() override { bPrewarmSpawn = true; }
+
 	// ========================================================================
 	// 設定
 	// ========================================================================
@@ -148,6 +158,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "敵")
 	void Die();
 
+	/** プールに返却（プールがない場合は破棄） */
+	UFUNCTION(BlueprintCallable, Category = "敵")
+	void ReturnToPool();
+
 	/** HPの割合を取得 */
 	UFUNCTION(BlueprintPure, Category = "敵")
 	float GetHealthPercent() const;
@@ -164,6 +178,22 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "敵")
 	void PerformAttack();
 
+	// ========================================================================
+	// 群衆シミュレーション（UEnemyCrowdSubsystem から使用）
+	// ========================================================================
+
+	/**
+	 * プレイヤーとの距離から次の行動状態を求める
+	 * スレッドセーフ（アクターにアクセスしない）
+	 */
+	static EEnemyBehaviorState EvaluateBehaviorState(EEnemyBehaviorState CurrentState, float DistanceToPlayerSq, float AttackRangeSq);
+
+	/** 攻撃中の移動入力スケール（立ち止まる設定なら0） */
+	float GetAttackMoveScale() const;
+
+	/** 攻撃・ボス処理を実行（移動入力は群衆サブシステムが書き込む） */
+	void ProcessCrowdActions(float DeltaTime);
+
 	// ========================================================================
 	// イベント
 	// ========================================================================
@@ -223,6 +253,13 @@ protected:
 	/** 攻撃タイマー */
 	FTimerHandle AttackCooldownTimerHandle;
 
+	/** 死亡後のプール返却タイマー */
+	FTimerHandle DespawnTimerHandle;
+
+	/** 死亡からプール返却までの時間（秒） */
+	UPROPERTY(EditDefaultsOnly, Category = "敵|設定", meta = (ClampMin = "0.0"))
+	float DespawnDelay = 2.0f;
+
 	/** 行動状態を更新 */
 	void UpdateBehaviorState();
 
@@ -244,6 +281,15 @@ protected:
 	/** EnemyDataからパラメータを初期化 */
 	void InitializeFromEnemyData();
 
+	/** スポーン時の状態を初期化（BeginPlay/プール取得時） */
+	void InitializeSpawnState();
+
+	/** プリウォームでスポーンされたか（BeginPlay でEnemyDataに依存する初期化を省略する） */
+	bool bPrewarmSpawn = false;
+
+	/** 群衆サブシステム・空間グリッドへの登録を解除（死亡/プール返却/破棄時） */
+	void UnregisterFromSubsystems();
+
 	// ========================================================================
 	// ボス内部処理
 	// ========================================================================
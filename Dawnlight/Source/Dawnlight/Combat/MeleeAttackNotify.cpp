@@ -2,12 +2,8 @@
 
 #include "MeleeAttackNotify.h"
 #include "Dawnlight.h"
-#include "AbilitySystemComponent.h"
-#include "AbilitySystemBlueprintLibrary.h"
-#include "GameFramework/Character.h"
-#include "Kismet/KismetSystemLibrary.h"
-#include "Abilities/DawnlightAttributeSet.h"
-#include "Engine/DamageEvents.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/World.h"
 
 UMeleeAttackNotify::UMeleeAttackNotify()
 {
@@ -24,196 +20,71 @@ void UMeleeAttackNotify::NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequ
 {
 	Super::NotifyBegin(MeshComp, Animation, TotalDuration, EventReference);
 
-	// ヒットリストをクリア
-	HitActors.Empty();
-
-	UE_LOG(LogDawnlight, Verbose, TEXT("[MeleeAttack] 攻撃判定開始 - Radius: %.0f, Damage: %.0f x %.1f"),
-		AttackRadius, BaseDamage, DamageMultiplier);
-}
-
-void UMeleeAttackNotify::NotifyTick(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float FrameDeltaTime, const FAnimNotifyEventReference& EventReference)
-{
-	Super::NotifyTick(MeshComp, Animation, FrameDeltaTime, EventReference);
-
-	if (!MeshComp)
+	if (!MeshComp || !MeshComp->GetOwner())
 	{
 		return;
 	}
 
-	AActor* Owner = MeshComp->GetOwner();
-	if (!Owner)
+	UWorld* World = MeshComp->GetWorld();
+	UMeleeHitQuerySubsystem* HitQuery = World ? World->GetSubsystem<UMeleeHitQuerySubsystem>() : nullptr;
+	if (!HitQuery)
 	{
+		// プレビュー等のゲーム外ワールドでは判定しない
 		return;
 	}
 
-	// 攻撃判定を実行
-	PerformAttackTrace(Owner);
-}
-
-void UMeleeAttackNotify::NotifyEnd(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference)
-{
-	Super::NotifyEnd(MeshComp, Animation, EventReference);
-
-	UE_LOG(LogDawnlight, Verbose, TEXT("[MeleeAttack] 攻撃判定終了 - ヒット数: %d"), HitActors.Num());
-
-	// ヒットリストをクリア
-	HitActors.Empty();
-}
-
-FString UMeleeAttackNotify::GetNotifyName_Implementation() const
-{
-	return FString::Printf(TEXT("Melee Attack (%.0f dmg)"), BaseDamage * DamageMultiplier);
-}
-
-void UMeleeAttackNotify::PerformAttackTrace(AActor* Attacker)
-{
-	if (!Attacker)
+	// NotifyEnd が呼ばれないままメッシュが破棄されたエントリを除去（振り自体はサブシステム側で終了済み）
+	for (auto It = ActiveSwings.CreateIterator(); It; ++It)
 	{
-		return;
-	}
-
-	UWorld* World = Attacker->GetWorld();
-	if (!World)
-	{
-		return;
-	}
-
-	// 攻撃位置を計算（キャラクター前方）
-	FVector AttackerLocation = Attacker->GetActorLocation();
-	FVector ForwardVector = Attacker->GetActorForwardVector();
-	FVector TraceCenter = AttackerLocation + ForwardVector * ForwardOffset;
-
-	// Sphere Traceでヒット判定
-	TArray<FHitResult> HitResults;
-	TArray<AActor*> ActorsToIgnore;
-	ActorsToIgnore.Add(Attacker);
-
-	// 既にヒットしたアクターも無視
-	for (const TWeakObjectPtr<AActor>& HitActor : HitActors)
-	{
-		if (HitActor.IsValid())
+		if (!It.Key().ResolveObjectPtr())
 		{
-			ActorsToIgnore.Add(HitActor.Get());
+			It.RemoveCurrent();
 		}
 	}
 
-	// トレースチャンネル（Pawnを検出）
-	ETraceTypeQuery TraceChannel = UEngineTypes::ConvertToTraceType(ECC_Pawn);
-
-	bool bHit = UKismetSystemLibrary::SphereTraceMulti(
-		World,
-		TraceCenter,
-		TraceCenter, // 同じ位置（Sweep距離0）
-		AttackRadius,
-		TraceChannel,
-		false, // bTraceComplex
-		ActorsToIgnore,
-		bShowDebug ? EDrawDebugTrace::ForDuration : EDrawDebugTrace::None,
-		HitResults,
-		true, // bIgnoreSelf
-		FLinearColor::Red,
-		FLinearColor::Green,
-		1.0f
-	);
-
-	if (!bHit)
+	// 前の振りが終了していなければ閉じる（モンタージュの中断等）
+	if (FMeleeSwingHandle* PreviousHandle = ActiveSwings.Find(MeshComp))
 	{
-		return;
+		HitQuery->EndSwing(*PreviousHandle);
 	}
 
-	// ヒットしたアクターにダメージを適用
-	for (const FHitResult& HitResult : HitResults)
-	{
-		AActor* HitActor = HitResult.GetActor();
-		if (!HitActor || HitActor == Attacker)
-		{
-			continue;
-		}
-
-		// 重複チェック
-		bool bAlreadyHit = false;
-		for (const TWeakObjectPtr<AActor>& PrevHit : HitActors)
-		{
-			if (PrevHit.Get() == HitActor)
-			{
-				bAlreadyHit = true;
-				break;
-			}
-		}
-
-		if (bAlreadyHit)
-		{
-			continue;
-		}
+	FMeleeSwingParams Params;
+	Params.Owner = MeshComp->GetOwner();
+	Params.Mesh = MeshComp;
+	Params.SocketName = SocketName;
+	Params.ForwardOffset = ForwardOffset;
+	Params.Radius = AttackRadius;
+	Params.Damage = BaseDamage * DamageMultiplier;
+	Params.bApplyKnockback = bApplyKnockback;
+	Params.KnockbackForce = KnockbackForce;
+	Params.bShowDebug = bShowDebug;
 
-		// ヒットリストに追加
-		HitActors.Add(HitActor);
+	ActiveSwings.Add(MeshComp, HitQuery->BeginSwing(Params));
 
-		// ダメージを適用
-		ApplyDamageToTarget(Attacker, HitActor, HitResult);
-
-		UE_LOG(LogDawnlight, Log, TEXT("[MeleeAttack] ヒット: %s"), *HitActor->GetName());
-	}
+	UE_LOG(LogDawnlight, Verbose, TEXT("[MeleeAttack] 攻撃判定開始 - Radius: %.0f, Damage: %.0f x %.1f"),
+		AttackRadius, BaseDamage, DamageMultiplier);
 }
 
-void UMeleeAttackNotify::ApplyDamageToTarget(AActor* Attacker, AActor* Target, const FHitResult& HitResult)
+void UMeleeAttackNotify::NotifyEnd(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference)
 {
-	if (!Attacker || !Target)
-	{
-		return;
-	}
-
-	// 最終ダメージ計算
-	float FinalDamage = BaseDamage * DamageMultiplier;
+	Super::NotifyEnd(MeshComp, Animation, EventReference);
 
-	// 攻撃者のダメージ倍率を取得（GAS）
-	if (UAbilitySystemComponent* AttackerASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(Attacker))
+	FMeleeSwingHandle Handle;
+	if (!ActiveSwings.RemoveAndCopyValue(MeshComp, Handle))
 	{
-		// DamageMultiplier属性を取得
-		bool bFound = false;
-		float AttackerDamageMultiplier = AttackerASC->GetGameplayAttributeValue(
-			UDawnlightAttributeSet::GetDamageMultiplierAttribute(),
-			bFound
-		);
-
-		if (bFound && AttackerDamageMultiplier > 0.0f)
-		{
-			FinalDamage *= AttackerDamageMultiplier;
-		}
+		return;
 	}
 
-	// ターゲットにダメージを適用（GAS経由）
-	if (UAbilitySystemComponent* TargetASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(Target))
+	UWorld* World = MeshComp ? MeshComp->GetWorld() : nullptr;
+	if (UMeleeHitQuerySubsystem* HitQuery = World ? World->GetSubsystem<UMeleeHitQuerySubsystem>() : nullptr)
 	{
-		// IncomingDamage属性に設定
-		TargetASC->SetNumericAttributeBase(
-			UDawnlightAttributeSet::GetIncomingDamageAttribute(),
-			FinalDamage
-		);
+		UE_LOG(LogDawnlight, Verbose, TEXT("[MeleeAttack] 攻撃判定終了 - ヒット数: %d"), HitQuery->GetSwingHitCount(Handle));
 
-		UE_LOG(LogDawnlight, Log, TEXT("[MeleeAttack] GASダメージ適用: %.0f → %s"),
-			FinalDamage, *Target->GetName());
+		HitQuery->EndSwing(Handle);
 	}
-	else
-	{
-		// GASがない場合はUE標準のダメージシステムを使用
-		FDamageEvent DamageEvent;
-		Target->TakeDamage(FinalDamage, DamageEvent, Attacker->GetInstigatorController(), Attacker);
-
-		UE_LOG(LogDawnlight, Log, TEXT("[MeleeAttack] 標準ダメージ適用: %.0f → %s"),
-			FinalDamage, *Target->GetName());
-	}
-
-	// ノックバック
-	if (bApplyKnockback && KnockbackForce > 0.0f)
-	{
-		FVector KnockbackDirection = (Target->GetActorLocation() - Attacker->GetActorLocation()).GetSafeNormal();
-		KnockbackDirection.Z = 0.3f; // 少し上向きに
-		KnockbackDirection.Normalize();
+}
 
-		if (ACharacter* TargetCharacter = Cast<ACharacter>(Target))
-		{
-			TargetCharacter->LaunchCharacter(KnockbackDirection * KnockbackForce, true, true);
-		}
-	}
+FString UMeleeAttackNotify::GetNotifyName_Implementation() const
+{
+	return FString::Printf(TEXT("Melee Attack (%.0f dmg)"), BaseDamage * DamageMultiplier);
 }
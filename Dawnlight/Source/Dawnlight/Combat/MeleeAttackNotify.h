@@ -4,14 +4,16 @@
 
 #include "CoreMinimal.h"
 #include "Animation/AnimNotifies/AnimNotifyState.h"
+#include "UObject/ObjectKey.h"
+#include "Subsystems/MeleeHitQuerySubsystem.h"
 #include "MeleeAttackNotify.generated.h"
 
 /**
  * 近接攻撃判定用AnimNotifyState
  *
  * アニメーション中の特定フレーム間で攻撃判定を行う
- * - Sphere Traceで範囲攻撃判定
- * - 複数ヒット防止のためのヒット済みアクター管理
+ * - 判定は UMeleeHitQuerySubsystem に振りとして登録し、フレームごとにまとめて実行
+ * - ヒット済みアクターは振り（メッシュごと）に管理されるため、複数のキャラクターが同じモンタージュを再生しても干渉しない
  * - GASと連携してダメージ適用
  */
 UCLASS(meta = (DisplayName = "Melee Attack Window"))
@@ -23,7 +25,6 @@ public:
 	UMeleeAttackNotify();
 
 	virtual void NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float TotalDuration, const FAnimNotifyEventReference& EventReference) override;
-	virtual void NotifyTick(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float FrameDeltaTime, const FAnimNotifyEventReference& EventReference) override;
 	virtual void NotifyEnd(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference) override;
 
 	virtual FString GetNotifyName_Implementation() const override;
@@ -33,10 +34,14 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Attack", meta = (ClampMin = "10"))
 	float AttackRadius = 100.0f;
 
-	/** 攻撃範囲のオフセット（キャラクター前方） */
+	/** 攻撃範囲のオフセット（キャラクター前方、ソケット未指定時） */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Attack")
 	float ForwardOffset = 100.0f;
 
+	/** 判定位置に使うソケット（武器の先端など、None の場合はキャラクター前方） */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Attack")
+	FName SocketName = NAME_None;
+
 	/** 基本ダメージ値 */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Attack", meta = (ClampMin = "0"))
 	float BaseDamage = 10.0f;
@@ -58,13 +63,6 @@ protected:
 	bool bShowDebug = false;
 
 private:
-	/** この攻撃でヒットしたアクター（重複ヒット防止） */
-	UPROPERTY()
-	TArray<TWeakObjectPtr<AActor>> HitActors;
-
-	/** 攻撃判定を実行 */
-	void PerformAttackTrace(AActor* Attacker);
-
-	/** ダメージを適用 */
-	void ApplyDamageToTarget(AActor* Attacker, AActor* Target, const FHitResult& HitResult);
+	/** メッシュごとの進行中の振り（Notifyオブジェクトは全メッシュで共有されるため） */
+	TMap<TObjectKey<USkeletalMeshComponent>, FMeleeSwingHandle> ActiveSwings;
 };
@@ -0,0 +1,158 @@
+// Soul Reaper - Dawnlight Project
+// Copyright (c) 2025. All Rights Reserved.
+
+#include "DawnlightCsvSummaryCommandlet.h"
+#include "Dawnlight.h"
+#include "Core/DawnlightGameMode.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+	/** CSV プロファイラーの列名 */
+	const TCHAR* FrameTimeColumn = TEXT("FrameTime");
+	const TCHAR* PhaseColumn = TEXT("Dawnlight/Phase");
+}
+
+UDawnlightCsvSummaryCommandlet::UDawnlightCsvSummaryCommandlet()
+{
+	IsClient = false;
+	IsEditor = false;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UDawnlightCsvSummaryCommandlet::Main(const FString& Params)
+{
+	FString CsvPath;
+	if (!FParse::Value(*Params, TEXT("csv="), CsvPath))
+	{
+		UE_LOG(LogDawnlight, Error, TEXT("[DawnlightCsvSummary] -csv=<path> を指定してください"));
+		return 1;
+	}
+
+	FString OutPath;
+	if (!FParse::Value(*Params, TEXT("out="), OutPath))
+	{
+		OutPath = FPaths::Combine(FPaths::GetPath(CsvPath), FPaths::GetBaseFilename(CsvPath) + TEXT("_Summary.csv"));
+	}
+
+	TArray<FPhaseFrameTimes> Phases;
+	if (!LoadFrameTimes(CsvPath, Phases))
+	{
+		return 1;
+	}
+
+	// 全フレームの集計を末尾に追加
+	FPhaseFrameTimes& AllFrames = Phases.AddDefaulted_GetRef();
+	AllFrames.PhaseName = TEXT("All");
+	for (int32 i = 0; i < Phases.Num() - 1; ++i)
+	{
+		AllFrames.FrameTimesMs.Append(Phases[i].FrameTimesMs);
+	}
+
+	TArray<FString> OutLines;
+	OutLines.Add(TEXT("Phase,Frames,AvgMs,P50Ms,P95Ms,P99Ms,MaxMs"));
+
+	UE_LOG(LogDawnlight, Display, TEXT("[DawnlightCsvSummary] %s"), *CsvPath);
+
+	for (FPhaseFrameTimes& Phase : Phases)
+	{
+		if (Phase.FrameTimesMs.Num() == 0)
+		{
+			continue;
+		}
+
+		Phase.FrameTimesMs.Sort();
+
+		double Total = 0.0;
+		for (const float FrameTime : Phase.FrameTimesMs)
+		{
+			Total += FrameTime;
+		}
+
+		const float Average = static_cast<float>(Total / Phase.FrameTimesMs.Num());
+		const float P50 = GetPercentile(Phase.FrameTimesMs, 50.0f);
+		const float P95 = GetPercentile(Phase.FrameTimesMs, 95.0f);
+		const float P99 = GetPercentile(Phase.FrameTimesMs, 99.0f);
+		const float Max = Phase.FrameTimesMs.Last();
+
+		OutLines.Add(FString::Printf(TEXT("%s,%d,%.3f,%.3f,%.3f,%.3f,%.3f"),
+			*Phase.PhaseName, Phase.FrameTimesMs.Num(), Average, P50, P95, P99, Max));
+
+		UE_LOG(LogDawnlight, Display, TEXT("[DawnlightCsvSummary] %-16s %7d フレーム  平均 %.2fms  p50 %.2fms  p95 %.2fms  p99 %.2fms  最大 %.2fms"),
+			*Phase.PhaseName, Phase.FrameTimesMs.Num(), Average, P50, P95, P99, Max);
+	}
+
+	if (!FFileHelper::SaveStringArrayToFile(OutLines, *OutPath))
+	{
+		UE_LOG(LogDawnlight, Error, TEXT("[DawnlightCsvSummary] サマリーを書き出せません: %s"), *OutPath);
+		return 1;
+	}
+
+	UE_LOG(LogDawnlight, Display, TEXT("[DawnlightCsvSummary] サマリーを書き出しました: %s"), *OutPath);
+	return 0;
+}
+
+bool UDawnlightCsvSummaryCommandlet::LoadFrameTimes(const FString& CsvPath, TArray<FPhaseFrameTimes>& OutPhases)
+{
+	TArray<FString> Lines;
+	if (!FFileHelper::LoadFileToStringArray(Lines, *CsvPath) || Lines.Num() == 0)
+	{
+		UE_LOG(LogDawnlight, Error, TEXT("[DawnlightCsvSummary] CSV を読み込めません: %s"), *CsvPath);
+		return false;
+	}
+
+	TArray<FString> Header;
+	Lines[0].ParseIntoArray(Header, TEXT(","), false);
+
+	const int32 FrameTimeIndex = Header.IndexOfByKey(FString(FrameTimeColumn));
+	const int32 PhaseIndex = Header.IndexOfByKey(FString(PhaseColumn));
+	if (FrameTimeIndex == INDEX_NONE || PhaseIndex == INDEX_NONE)
+	{
+		UE_LOG(LogDawnlight, Error, TEXT("[DawnlightCsvSummary] %s または %s 列がありません（-csvCategories=Dawnlight で記録してください）"),
+			FrameTimeColumn, PhaseColumn);
+		return false;
+	}
+
+	// フェーズの並びは EGamePhase の値順
+	const UEnum* PhaseEnum = StaticEnum<EGamePhase>();
+	const int32 NumPhases = PhaseEnum->NumEnums() - 1;  // _MAX を除く
+	OutPhases.SetNum(NumPhases);
+	for (int32 i = 0; i < NumPhases; ++i)
+	{
+		OutPhases[i].PhaseName = PhaseEnum->GetNameStringByIndex(i);
+	}
+
+	TArray<FString> Cells;
+	for (int32 LineIndex = 1; LineIndex < Lines.Num(); ++LineIndex)
+	{
+		Lines[LineIndex].ParseIntoArray(Cells, TEXT(","), false);
+
+		// 末尾のヘッダー再掲とメタデータ行は数値でないので除外
+		if (!Cells.IsValidIndex(FrameTimeIndex) || !Cells.IsValidIndex(PhaseIndex)
+			|| !Cells[FrameTimeIndex].IsNumeric() || !Cells[PhaseIndex].IsNumeric())
+		{
+			continue;
+		}
+
+		const int32 Phase = FMath::RoundToInt(FCString::Atof(*Cells[PhaseIndex]));
+		if (OutPhases.IsValidIndex(Phase))
+		{
+			OutPhases[Phase].FrameTimesMs.Add(FCString::Atof(*Cells[FrameTimeIndex]));
+		}
+	}
+
+	return true;
+}
+
+float UDawnlightCsvSummaryCommandlet::GetPercentile(const TArray<float>& SortedValues, float Percentile)
+{
+	if (SortedValues.Num() == 0)
+	{
+		return 0.0f;
+	}
+
+	const int32 Rank = FMath::CeilToInt(Percentile / 100.0f * SortedValues.Num()) - 1;
+	return SortedValues[FMath::Clamp(Rank, 0, SortedValues.Num() - 1)];
+}
@@ -0,0 +1,46 @@
+// Soul Reaper - Dawnlight Project
+// Copyright (c) 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "DawnlightCsvSummaryCommandlet.generated.h"
+
+/**
+ * CSV プロファイラーのサマリーコマンドレット
+ *
+ * ソークで記録した CSV（-csvCategories=Dawnlight）をフェーズごとのフレーム時間にまとめる
+ * - Dawnlight/Phase 列でフレームをフェーズ分けし、p50/p95/p99 を出力
+ * - ビルド間で diff できるようにサマリーを CSV に書き出す
+ *
+ * 使い方:
+ *   UnrealEditor-Cmd Dawnlight -run=DawnlightCsvSummary -csv=<入力.csv> [-out=<出力.csv>]
+ */
+UCLASS()
+class DAWNLIGHT_API UDawnlightCsvSummaryCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UDawnlightCsvSummaryCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+private:
+	/** フェーズごとのフレーム時間（ミリ秒） */
+	struct FPhaseFrameTimes
+	{
+		FString PhaseName;
+		TArray<float> FrameTimesMs;
+	};
+
+	/**
+	 * CSV を読み込んでフェーズごとにフレーム時間を集める
+	 * @return 読み込めたら true
+	 */
+	static bool LoadFrameTimes(const FString& CsvPath, TArray<FPhaseFrameTimes>& OutPhases);
+
+	/** ソート済みの配列からパーセンタイルを取得（最近傍順位法） */
+	static float GetPercentile(const TArray<float>& SortedValues, float Percentile);
+};
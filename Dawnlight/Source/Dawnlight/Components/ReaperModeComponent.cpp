@@ -3,11 +3,13 @@
 
 #include "ReaperModeComponent.h"
 #include "Dawnlight.h"
+#include "DawnlightStats.h"
 #include "Abilities/DawnlightAttributeSet.h"
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemBlueprintLibrary.h"
 #include "NiagaraComponent.h"
 #include "NiagaraFunctionLibrary.h"
+#include "Subsystems/DawnlightVFXManager.h"
 #include "GameFramework/Character.h"
 
 UReaperModeComponent::UReaperModeComponent()
@@ -53,11 +55,7 @@ void UReaperModeComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	}
 
 	// エフェクトを停止
-	if (ActiveEffectComponent)
-	{
-		ActiveEffectComponent->DestroyComponent();
-		ActiveEffectComponent = nullptr;
-	}
+	StopActiveEffect();
 
 	Super::EndPlay(EndPlayReason);
 }
@@ -109,9 +107,10 @@ bool UReaperModeComponent::ActivateReaperMode()
 	AActor* Owner = GetOwner();
 	if (ActivationEffect && Owner)
 	{
-		UNiagaraFunctionLibrary::SpawnSystemAtLocation(
+		UDawnlightVFXManager::SpawnAtLocationInWorld(
 			this,
 			ActivationEffect,
+			EDawnlightVFXCategory::ReaperAura,
 			Owner->GetActorLocation(),
 			Owner->GetActorRotation()
 		);
@@ -122,15 +121,22 @@ bool UReaperModeComponent::ActivateReaperMode()
 	{
 		if (USceneComponent* RootComp = Owner->GetRootComponent())
 		{
-			ActiveEffectComponent = UNiagaraFunctionLibrary::SpawnSystemAttached(
-				ActiveEffect,
-				RootComp,
-				NAME_None,
-				FVector::ZeroVector,
-				FRotator::ZeroRotator,
-				EAttachLocation::KeepRelativeOffset,
-				true
-			);
+			if (UDawnlightVFXManager* VFXManager = GetWorld()->GetSubsystem<UDawnlightVFXManager>())
+			{
+				ActiveEffectComponent = VFXManager->SpawnAttached(ActiveEffect, EDawnlightVFXCategory::ReaperAura, RootComp);
+			}
+			else
+			{
+				ActiveEffectComponent = UNiagaraFunctionLibrary::SpawnSystemAttached(
+					ActiveEffect,
+					RootComp,
+					NAME_None,
+					FVector::ZeroVector,
+					FRotator::ZeroRotator,
+					EAttachLocation::KeepRelativeOffset,
+					true
+				);
+			}
 		}
 	}
 
@@ -147,6 +153,7 @@ bool UReaperModeComponent::ActivateReaperMode()
 	}
 
 	// イベント発火
+	CSV_EVENT(Dawnlight, TEXT("ReaperMode"));
 	OnReaperModeActivated.Broadcast();
 
 	return true;
@@ -173,11 +180,7 @@ void UReaperModeComponent::DeactivateReaperMode()
 	RemoveReaperBuffs();
 
 	// エフェクトを停止
-	if (ActiveEffectComponent)
-	{
-		ActiveEffectComponent->DestroyComponent();
-		ActiveEffectComponent = nullptr;
-	}
+	StopActiveEffect();
 
 	// イベント発火
 	OnReaperModeDeactivated.Broadcast();
@@ -188,6 +191,28 @@ void UReaperModeComponent::OnReaperModeDurationEnd()
 	DeactivateReaperMode();
 }
 
+void UReaperModeComponent::StopActiveEffect()
+{
+	if (!ActiveEffectComponent)
+	{
+		return;
+	}
+
+	// VFXマネージャー管理下ならプールに戻し、そうでなければ破棄
+	UWorld* World = GetWorld();
+	UDawnlightVFXManager* VFXManager = World ? World->GetSubsystem<UDawnlightVFXManager>() : nullptr;
+	if (VFXManager)
+	{
+		VFXManager->ReleaseEffect(ActiveEffectComponent);
+	}
+	else
+	{
+		ActiveEffectComponent->DestroyComponent();
+	}
+
+	ActiveEffectComponent = nullptr;
+}
+
 void UReaperModeComponent::ApplyReaperBuffs()
 {
 	UDawnlightAttributeSet* AttributeSet = GetAttributeSet();
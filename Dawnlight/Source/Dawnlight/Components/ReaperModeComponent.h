@@ -162,6 +162,9 @@ private:
 	/** リーパーモード終了処理 */
 	void OnReaperModeDurationEnd();
 
+	/** 常時エフェクトを停止 */
+	void StopActiveEffect();
+
 	/** バフを適用 */
 	void ApplyReaperBuffs();
 
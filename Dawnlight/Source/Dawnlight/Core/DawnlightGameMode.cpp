@@ -4,20 +4,26 @@
 #include "DawnlightGameMode.h"
 #include "Subsystems/AnimalSpawnerSubsystem.h"
 #include "Dawnlight.h"
+#include "DawnlightStats.h"
 #include "Subsystems/NightProgressSubsystem.h"
 #include "Subsystems/SoulCollectionSubsystem.h"
 #include "Subsystems/UpgradeSubsystem.h"
 #include "Subsystems/WaveSpawnerSubsystem.h"
+#include "Subsystems/ActorPoolSubsystem.h"
+#include "Subsystems/DawnlightAssetPreloader.h"
+#include "Subsystems/SoulPickupManager.h"
 #include "Abilities/DawnlightAttributeSet.h"
 #include "Characters/DawnlightCharacter.h"
 #include "Characters/EnemyCharacter.h"
 #include "Data/EnemyDataAsset.h"
+#include "Data/SoulDataAsset.h"
 #include "UI/Widgets/GameplayHUDWidget.h"
 #include "UI/Widgets/GameResultWidget.h"
 #include "UI/Widgets/UpgradeSelectionWidget.h"
 #include "UI/Widgets/SetBonusDisplayWidget.h"
 #include "UI/LevelTransitionSubsystem.h"
 #include "Data/UpgradeDataAsset.h"
+#include "Data/WaveScheduleDataAsset.h"
 #include "Blueprint/UserWidget.h"
 #include "Kismet/GameplayStatics.h"
 #include "Engine/World.h"
@@ -98,6 +104,8 @@ void ADawnlightGameMode::Tick(float DeltaTime)
 			EndNightPhase();
 		}
 	}
+
+	UpdateStatCounters();
 }
 
 void ADawnlightGameMode::InitializeSubsystems()
@@ -139,6 +147,27 @@ void ADawnlightGameMode::InitializeSubsystems()
 		{
 			UE_LOG(LogDawnlight, Log, TEXT("[SoulReaperGameMode] AnimalSpawnerSubsystem を取得"));
 		}
+
+		ActorPoolSubsystem = World->GetSubsystem<UActorPoolSubsystem>();
+		if (ActorPoolSubsystem.IsValid())
+		{
+			UE_LOG(LogDawnlight, Log, TEXT("[SoulReaperGameMode] ActorPoolSubsystem を取得"));
+
+			// ウェーブ補充時のスポーンヒッチを避けるため事前生成
+			ActorPoolSubsystem->PrewarmPools(PoolPrewarmCounts);
+		}
+
+		AssetPreloader = World->GetSubsystem<UDawnlightAssetPreloader>();
+		if (AssetPreloader.IsValid())
+		{
+			UE_LOG(LogDawnlight, Log, TEXT("[SoulReaperGameMode] AssetPreloader を取得"));
+		}
+
+		// 調整値を渡し、AoE撃破で大量にドロップしてもヒッチしないようインスタンスを事前確保
+		if (USoulPickupManager* PickupManager = World->GetSubsystem<USoulPickupManager>())
+		{
+			PickupManager->ConfigurePickups(SoulPickupSettings, SoulPickupMesh, SoulPickupPrewarmCount);
+		}
 	}
 
 	// アップグレードウィジェットを初期化
@@ -176,6 +205,15 @@ void ADawnlightGameMode::StartNightPhase()
 		SoulCollectionSubsystem->ClearSouls();
 	}
 
+	// 前のループのピックアップを削除
+	if (USoulPickupManager* PickupManager = GetWorld()->GetSubsystem<USoulPickupManager>())
+	{
+		PickupManager->ClearAllPickups();
+	}
+
+	// 動物・魂・アップグレードアイコンを事前に非同期ロード
+	PreloadNightPhaseAssets();
+
 	// HUDを表示
 	ShowGameplayHUD();
 
@@ -205,6 +243,12 @@ void ADawnlightGameMode::EndNightPhase()
 	// 動物スポーンタイマーを停止
 	GetWorld()->GetTimerManager().ClearTimer(AnimalSpawnTimerHandle);
 
+	// 拾い残した魂はDawn Phaseのバフ計算前にまとめて収集
+	if (USoulPickupManager* PickupManager = GetWorld()->GetSubsystem<USoulPickupManager>())
+	{
+		PickupManager->CollectAllPickups();
+	}
+
 	// Dawn Transition演出へ
 	StartDawnTransition();
 }
@@ -254,6 +298,9 @@ void ADawnlightGameMode::StartDawnPhase()
 
 	UE_LOG(LogDawnlight, Log, TEXT("[SoulReaperGameMode] Dawn Phase開始（総Wave数: %d）"), TotalWaves);
 
+	// 敵アセットを事前に非同期ロード（Night Phase中に開始済みなら差分のみ）
+	PreloadDawnPhaseAssets();
+
 	// WaveSpawnerSubsystemを初期化
 	if (WaveSpawnerSubsystem.IsValid())
 	{
@@ -264,22 +311,26 @@ void ADawnlightGameMode::StartDawnPhase()
 			UE_LOG(LogDawnlight, Log, TEXT("[SoulReaperGameMode] デフォルト敵データを設定: %s"), *DefaultEnemyData->DisplayName.ToString());
 		}
 
-		// ウェーブ設定を生成
-		TArray<FWaveConfig> WaveConfigsArray;
-		for (int32 i = 0; i < TotalWaves; i++)
+		if (WaveSchedule)
 		{
-			FWaveConfig Config;
-			Config.WaveNumber = i + 1;
-			Config.TotalEnemies = EnemiesPerWave.IsValidIndex(i) ? EnemiesPerWave[i] : 5;
-			Config.MaxConcurrentEnemies = FMath::Min(Config.TotalEnemies, 5);  // 同時に最大5体
-			Config.SpawnInterval = 2.0f;
-			Config.HealthMultiplier = 1.0f + (i * 0.2f);  // ウェーブごとにHP増加
-			Config.DamageMultiplier = 1.0f + (i * 0.1f);  // ウェーブごとにダメージ増加
-
-			WaveConfigsArray.Add(Config);
-		}
+			// ベイク済みスケジュールを使用（Wave数と敵数もスケジュールに合わせる）
+			const TArray<FWaveConfig>& ScheduledWaves = WaveSchedule->GetWaveConfigs(WaveScheduleLoop);
+			TotalWaves = ScheduledWaves.Num();
+			EnemiesPerWave.Reset(ScheduledWaves.Num());
+			for (const FWaveConfig& Config : ScheduledWaves)
+			{
+				EnemiesPerWave.Add(Config.TotalEnemies);
+			}
 
-		WaveSpawnerSubsystem->InitializeWaveSystem(WaveConfigsArray);
+			WaveSpawnerSubsystem->InitializeWaveSchedule(WaveSchedule, WaveScheduleLoop);
+		}
+		else
+		{
+			// スケジュール未設定時は Wave 数と敵数から生成
+			TArray<FWaveConfig> WaveConfigsArray;
+			UWaveScheduleDataAsset::MakeRampedWaveConfigs(TotalWaves, EnemiesPerWave, WaveConfigsArray);
+			WaveSpawnerSubsystem->InitializeWaveSystem(WaveConfigsArray);
+		}
 
 		UE_LOG(LogDawnlight, Log, TEXT("[SoulReaperGameMode] WaveSpawnerSubsystemを初期化（%d ウェーブ）"), TotalWaves);
 	}
@@ -301,6 +352,9 @@ void ADawnlightGameMode::SetPhase(EGamePhase NewPhase)
 	EGamePhase OldPhase = CurrentPhase;
 	CurrentPhase = NewPhase;
 
+	// CSV プロファイラーにフェーズ遷移を記録（フレーム時間のスパイクとの突き合わせ用）
+	CSV_EVENT(Dawnlight, TEXT("Phase/%s"), *StaticEnum<EGamePhase>()->GetNameStringByValue(static_cast<int64>(NewPhase)));
+
 	// デリゲート発火
 	OnPhaseChanged.Broadcast(OldPhase, NewPhase);
 
@@ -429,6 +483,12 @@ void ADawnlightGameMode::OnPlayerDeath()
 	// HUDを非表示
 	HideGameplayHUD();
 
+	// プリロードしたアセットを解放
+	ReleasePreloadedAssets();
+
+	// 魂のバフを除去
+	ClearCollectedSoulBuffs();
+
 	// 敗北画面を表示
 	ShowResultScreen(false);
 
@@ -451,6 +511,12 @@ void ADawnlightGameMode::OnGameCleared()
 	// HUDを非表示
 	HideGameplayHUD();
 
+	// プリロードしたアセットを解放
+	ReleasePreloadedAssets();
+
+	// 魂のバフを除去
+	ClearCollectedSoulBuffs();
+
 	// 勝利画面を表示
 	ShowResultScreen(true);
 
@@ -639,13 +705,13 @@ void ADawnlightGameMode::SpawnAnimal()
 		return;
 	}
 
-	// AnimalSpawnerSubsystemを使用してスポーン
+	// AnimalSpawnerSubsystemを使用してスポーン（実際のスポーンはスポーンスケジューラーで行う）
 	if (AnimalSpawnerSubsystem.IsValid())
 	{
 		if (AnimalSpawnerSubsystem->SpawnRandomAnimal())
 		{
 			CurrentAnimalCount++;
-			UE_LOG(LogDawnlight, Log, TEXT("[SoulReaperGameMode] 動物をスポーン（現在: %d/%d）"), CurrentAnimalCount, MaxAnimalCount);
+			UE_LOG(LogDawnlight, Log, TEXT("[SoulReaperGameMode] 動物のスポーンを要求（現在: %d/%d）"), CurrentAnimalCount, MaxAnimalCount);
 		}
 	}
 	else
@@ -654,6 +720,133 @@ void ADawnlightGameMode::SpawnAnimal()
 	}
 }
 
+// ========================================================================
+// 統計
+// ========================================================================
+
+void ADawnlightGameMode::UpdateStatCounters() const
+{
+#if STATS
+	SET_DWORD_STAT(STAT_DawnlightLiveEnemies, WaveSpawnerSubsystem.IsValid() ? WaveSpawnerSubsystem->GetAliveEnemyCount() : 0);
+	SET_DWORD_STAT(STAT_DawnlightLiveAnimals, AnimalSpawnerSubsystem.IsValid() ? AnimalSpawnerSubsystem->GetAliveAnimalCount() : 0);
+	SET_DWORD_STAT(STAT_DawnlightPooledActors, ActorPoolSubsystem.IsValid() ? ActorPoolSubsystem->GetTotalPooledCount() : 0);
+
+	// ゲーム進行のタイマー（エンジン全体のタイマー数は公開されていない）
+	const FTimerManager& TimerManager = GetWorldTimerManager();
+	int32 ActiveTimers = 0;
+	for (const FTimerHandle* Handle : { &AutoStartTimerHandle, &NightPhaseTimerHandle, &DawnTransitionTimerHandle, &WaveIntervalTimerHandle, &AnimalSpawnTimerHandle })
+	{
+		if (TimerManager.IsTimerActive(*Handle))
+		{
+			++ActiveTimers;
+		}
+	}
+	SET_DWORD_STAT(STAT_DawnlightActiveTimers, ActiveTimers);
+#endif
+
+#if CSV_PROFILER
+	// ソーク用の毎フレーム記録（Phase 列はサマリーコマンドレットがフェーズ分けに使う）
+	CSV_CUSTOM_STAT(Dawnlight, Phase, static_cast<int32>(CurrentPhase), ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(Dawnlight, AliveEnemies, WaveSpawnerSubsystem.IsValid() ? WaveSpawnerSubsystem->GetAliveEnemyCount() : 0, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(Dawnlight, Souls, SoulCollectionSubsystem.IsValid() ? SoulCollectionSubsystem->GetTotalSoulCount() : 0, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(Dawnlight, Combo, SoulCollectionSubsystem.IsValid() ? SoulCollectionSubsystem->GetComboInfo().CurrentCombo : 0, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(Dawnlight, Tension, NightProgressSubsystem.IsValid() ? NightProgressSubsystem->GetTensionLevel() : 0.0f, ECsvCustomStatOp::Set);
+#endif
+}
+
+// ========================================================================
+// アセットプリロード
+// ========================================================================
+
+void ADawnlightGameMode::PreloadNightPhaseAssets()
+{
+	if (!AssetPreloader.IsValid())
+	{
+		return;
+	}
+
+	// 魂データ（動物Blueprintクラス、収集エフェクト、アイコン）
+	TArray<USoulDataAsset*> SoulDataAssets;
+	GetPreloadSoulDataAssets(SoulDataAssets);
+	AssetPreloader->PreloadSoulAssets(SoulDataAssets);
+
+	// Dawn Phaseの敵もNight Phase中に先行ロードしておく
+	PreloadDawnPhaseAssets();
+
+	// アップグレード選択画面のアイコン
+	if (UpgradeSubsystem.IsValid())
+	{
+		AssetPreloader->PreloadUpgradeIcons(UpgradeSubsystem->GetAllUpgrades());
+	}
+}
+
+void ADawnlightGameMode::PreloadDawnPhaseAssets()
+{
+	if (!AssetPreloader.IsValid())
+	{
+		return;
+	}
+
+	TArray<UEnemyDataAsset*> EnemyDataAssets;
+	GetPreloadEnemyDataAssets(EnemyDataAssets);
+	AssetPreloader->PreloadEnemyAssets(EnemyDataAssets);
+}
+
+void ADawnlightGameMode::GetPreloadSoulDataAssets(TArray<USoulDataAsset*>& OutSoulDataAssets) const
+{
+	if (SoulCollectionSubsystem.IsValid())
+	{
+		OutSoulDataAssets = SoulCollectionSubsystem->GetAllSoulData();
+	}
+	if (AnimalSpawnerSubsystem.IsValid())
+	{
+		for (const FAnimalSpawnConfig& Config : AnimalSpawnerSubsystem->GetSpawnConfigs())
+		{
+			if (Config.SoulData)
+			{
+				OutSoulDataAssets.AddUnique(Config.SoulData);
+			}
+		}
+	}
+}
+
+void ADawnlightGameMode::GetPreloadEnemyDataAssets(TArray<UEnemyDataAsset*>& OutEnemyDataAssets) const
+{
+	if (DefaultEnemyData)
+	{
+		OutEnemyDataAssets.Add(DefaultEnemyData);
+	}
+
+	if (WaveSchedule)
+	{
+		WaveSchedule->GetReferencedEnemies(OutEnemyDataAssets);
+	}
+}
+
+void ADawnlightGameMode::GatherLoopAssetPaths(TArray<FSoftObjectPath>& OutPaths) const
+{
+	TArray<USoulDataAsset*> SoulDataAssets;
+	GetPreloadSoulDataAssets(SoulDataAssets);
+	UDawnlightAssetPreloader::GatherSoulAssetPaths(SoulDataAssets, OutPaths);
+
+	TArray<UEnemyDataAsset*> EnemyDataAssets;
+	GetPreloadEnemyDataAssets(EnemyDataAssets);
+	UDawnlightAssetPreloader::GatherEnemyAssetPaths(EnemyDataAssets, OutPaths);
+
+	if (UpgradeSubsystem.IsValid())
+	{
+		UDawnlightAssetPreloader::GatherUpgradeIconPaths(UpgradeSubsystem->GetAllUpgrades(), OutPaths);
+	}
+}
+
+void ADawnlightGameMode::ReleasePreloadedAssets()
+{
+	if (AssetPreloader.IsValid())
+	{
+		AssetPreloader->ReleaseAll();
+	}
+}
+
 // ========================================================================
 // バフ適用
 // ========================================================================
@@ -700,6 +893,23 @@ void ADawnlightGameMode::ApplyCollectedSoulBuffs()
 	UE_LOG(LogDawnlight, Log, TEXT("[SoulReaperGameMode] 収集した魂のバフを適用完了（総魂数: %d）"), TotalSouls);
 }
 
+void ADawnlightGameMode::ClearCollectedSoulBuffs()
+{
+	if (!SoulCollectionSubsystem.IsValid())
+	{
+		return;
+	}
+
+	// バフを適用したASCはサブシステム側で保持している
+	UDawnlightAttributeSet* AttributeSet = nullptr;
+	if (const ADawnlightCharacter* PlayerCharacter = Cast<ADawnlightCharacter>(UGameplayStatics::GetPlayerPawn(this, 0)))
+	{
+		AttributeSet = PlayerCharacter->GetDawnlightAttributeSet();
+	}
+
+	SoulCollectionSubsystem->ClearAppliedBuffs(AttributeSet);
+}
+
 // ========================================================================
 // アップグレード選択
 // ========================================================================
@@ -6,6 +6,7 @@
 #include "CoreMinimal.h"
 #include "GameFramework/GameModeBase.h"
 #include "GameplayTagContainer.h"
+#include "Subsystems/SoulPickupManager.h"
 #include "DawnlightGameMode.generated.h"
 
 class UNightProgressSubsystem;
@@ -13,6 +14,8 @@ class USoulCollectionSubsystem;
 class UUpgradeSubsystem;
 class UWaveSpawnerSubsystem;
 class UAnimalSpawnerSubsystem;
+class UActorPoolSubsystem;
+class UDawnlightAssetPreloader;
 class UGameplayHUDWidget;
 class UGameResultWidget;
 class UUpgradeSelectionWidget;
@@ -21,6 +24,9 @@ class ADawnlightCharacter;
 class UDawnlightAttributeSet;
 class UUpgradeDataAsset;
 class UEnemyDataAsset;
+class USoulDataAsset;
+class UWaveScheduleDataAsset;
+class UStaticMesh;
 
 /**
  * ゲームフェーズ
@@ -74,6 +80,9 @@ public:
 	UFUNCTION(BlueprintPure, Category = "ゲームフロー")
 	bool IsInNightPhase() const { return CurrentPhase == EGamePhase::Night; }
 
+	/** ループで使うアセットのソフトパスを収集（魂データ・敵データ・アップグレードアイコン。レベル遷移中の先読み用） */
+	void GatherLoopAssetPaths(TArray<FSoftObjectPath>& OutPaths) const;
+
 	/** Dawn Phase中かどうか */
 	UFUNCTION(BlueprintPure, Category = "ゲームフロー")
 	bool IsInDawnPhase() const { return CurrentPhase == EGamePhase::Dawn; }
@@ -106,6 +115,10 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Wave")
 	int32 GetRemainingEnemies() const { return RemainingEnemies; }
 
+	/** アップグレード選択ウィジェットを取得 */
+	UFUNCTION(BlueprintPure, Category = "UI")
+	UUpgradeSelectionWidget* GetUpgradeSelectionWidget() const { return UpgradeSelectionWidget; }
+
 	/**
 	 * 敵を倒した時に呼び出す
 	 * @note WaveSpawnerSubsystem経由での敵撃破通知を推奨。
@@ -247,6 +260,14 @@ protected:
 	UPROPERTY(EditDefaultsOnly, Category = "設定|Dawn Phase")
 	TArray<int32> EnemiesPerWave;
 
+	/** ウェーブスケジュール（設定時は総Wave数・各Waveの敵数もこちらを使用） */
+	UPROPERTY(EditDefaultsOnly, Category = "設定|Dawn Phase")
+	TObjectPtr<UWaveScheduleDataAsset> WaveSchedule;
+
+	/** 使用するウェーブスケジュールのループ番号（0始まり） */
+	UPROPERTY(EditDefaultsOnly, Category = "設定|Dawn Phase", meta = (ClampMin = "0", EditCondition = "WaveSchedule != nullptr"))
+	int32 WaveScheduleLoop = 0;
+
 	/** Wave間のインターバル（秒） */
 	UPROPERTY(EditDefaultsOnly, Category = "設定|Dawn Phase")
 	float WaveInterval;
@@ -267,6 +288,22 @@ protected:
 	UPROPERTY(EditDefaultsOnly, Category = "設定")
 	float AutoStartDelay;
 
+	/** アクタープールのクラスごとのプリウォーム数（敵・動物のBlueprintクラスを指定） */
+	UPROPERTY(EditDefaultsOnly, Category = "設定|プール")
+	TMap<TSubclassOf<AActor>, int32> PoolPrewarmCounts;
+
+	/** 魂ピックアップのメッシュ（インスタンス描画、カスタムデータ0-2に魂の色） */
+	UPROPERTY(EditDefaultsOnly, Category = "設定|プール")
+	TObjectPtr<UStaticMesh> SoulPickupMesh;
+
+	/** 魂ピックアップのインスタンスのプリウォーム数 */
+	UPROPERTY(EditDefaultsOnly, Category = "設定|プール", meta = (ClampMin = "0"))
+	int32 SoulPickupPrewarmCount = 64;
+
+	/** 魂ピックアップの浮遊・吸い寄せ・寿命（USoulPickupManager に渡す） */
+	UPROPERTY(EditDefaultsOnly, Category = "設定|魂ピックアップ")
+	FSoulPickupSettings SoulPickupSettings;
+
 	/** ゲームプレイHUDウィジェットクラス */
 	UPROPERTY(EditDefaultsOnly, Category = "UI")
 	TSubclassOf<UGameplayHUDWidget> GameplayHUDWidgetClass;
@@ -309,9 +346,30 @@ private:
 	/** 動物スポーン処理 */
 	void SpawnAnimal();
 
+	/** stat dawnlight の生存数カウンターと CSV プロファイラーの毎フレーム統計を更新 */
+	void UpdateStatCounters() const;
+
 	/** 収集した魂のバフを適用 */
 	void ApplyCollectedSoulBuffs();
 
+	/** 適用した魂のバフを除去（ループ終了時） */
+	void ClearCollectedSoulBuffs();
+
+	/** Night Phaseで使用するアセットをプリロード */
+	void PreloadNightPhaseAssets();
+
+	/** Dawn Phaseで使用するアセットをプリロード */
+	void PreloadDawnPhaseAssets();
+
+	/** ループ終了時にプリロードしたアセットを解放 */
+	void ReleasePreloadedAssets();
+
+	/** プリロード対象の魂データ（収集サブシステム＋動物スポーン設定） */
+	void GetPreloadSoulDataAssets(TArray<USoulDataAsset*>& OutSoulDataAssets) const;
+
+	/** プリロード対象の敵データ（デフォルト＋Waveスケジュール） */
+	void GetPreloadEnemyDataAssets(TArray<UEnemyDataAsset*>& OutEnemyDataAssets) const;
+
 	/** ウィジェット初期化 */
 	void InitializeUpgradeWidgets();
 
@@ -374,6 +432,12 @@ private:
 	UPROPERTY()
 	TWeakObjectPtr<UAnimalSpawnerSubsystem> AnimalSpawnerSubsystem;
 
+	UPROPERTY()
+	TWeakObjectPtr<UActorPoolSubsystem> ActorPoolSubsystem;
+
+	UPROPERTY()
+	TWeakObjectPtr<UDawnlightAssetPreloader> AssetPreloader;
+
 	// ========================================================================
 	// ウィジェット参照
 	// ========================================================================
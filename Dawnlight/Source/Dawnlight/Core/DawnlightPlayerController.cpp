@@ -13,6 +13,7 @@
 #include "UI/Widgets/SettingsWidget.h"
 #include "UI/Widgets/ConfirmationDialogWidget.h"
 #include "UI/LevelTransitionSubsystem.h"
+#include "Subsystems/PlayerContextSubsystem.h"
 
 ADawnlightPlayerController::ADawnlightPlayerController()
 {
@@ -25,6 +26,12 @@ void ADawnlightPlayerController::BeginPlay()
 {
 	Super::BeginPlay();
 
+	// 入力ハンドラーが使うプレイヤーキャッシュに登録
+	if (UPlayerContextSubsystem* PlayerContext = GetWorld()->GetSubsystem<UPlayerContextSubsystem>())
+	{
+		PlayerContext->RegisterPlayerController(this);
+	}
+
 	// デフォルト入力コンテキストを追加
 	if (DefaultMappingContext)
 	{
@@ -90,7 +97,7 @@ void ADawnlightPlayerController::HandleMove(const FInputActionValue& Value)
 	const FVector2D MovementVector = Value.Get<FVector2D>();
 
 	// キャラクターに移動を委譲
-	if (ADawnlightCharacter* DawnlightChar = Cast<ADawnlightCharacter>(GetPawn()))
+	if (ADawnlightCharacter* DawnlightChar = GetPawn<ADawnlightCharacter>())
 	{
 		DawnlightChar->HandleMoveInput(MovementVector);
 	}
@@ -101,7 +108,7 @@ void ADawnlightPlayerController::HandleLightAttack(const FInputActionValue& Valu
 	UE_LOG(LogDawnlight, Verbose, TEXT("DawnlightPlayerController: 通常攻撃入力を受信"));
 
 	// キャラクターに通常攻撃を委譲
-	if (ADawnlightCharacter* DawnlightChar = Cast<ADawnlightCharacter>(GetPawn()))
+	if (ADawnlightCharacter* DawnlightChar = GetPawn<ADawnlightCharacter>())
 	{
 		if (!DawnlightChar->IsAttacking())
 		{
@@ -115,7 +122,7 @@ void ADawnlightPlayerController::HandleHeavyAttack(const FInputActionValue& Valu
 	UE_LOG(LogDawnlight, Verbose, TEXT("DawnlightPlayerController: 強攻撃入力を受信"));
 
 	// キャラクターに強攻撃を委譲
-	if (ADawnlightCharacter* DawnlightChar = Cast<ADawnlightCharacter>(GetPawn()))
+	if (ADawnlightCharacter* DawnlightChar = GetPawn<ADawnlightCharacter>())
 	{
 		if (!DawnlightChar->IsAttacking())
 		{
@@ -129,7 +136,7 @@ void ADawnlightPlayerController::HandleSpecialAttack(const FInputActionValue& Va
 	UE_LOG(LogDawnlight, Verbose, TEXT("DawnlightPlayerController: 特殊攻撃入力を受信"));
 
 	// キャラクターに特殊攻撃を委譲
-	if (ADawnlightCharacter* DawnlightChar = Cast<ADawnlightCharacter>(GetPawn()))
+	if (ADawnlightCharacter* DawnlightChar = GetPawn<ADawnlightCharacter>())
 	{
 		if (!DawnlightChar->IsAttacking())
 		{
@@ -143,7 +150,7 @@ void ADawnlightPlayerController::HandleReaperMode(const FInputActionValue& Value
 	UE_LOG(LogDawnlight, Log, TEXT("DawnlightPlayerController: リーパーモード入力を受信"));
 
 	// キャラクターにリーパーモード発動を委譲
-	if (ADawnlightCharacter* DawnlightChar = Cast<ADawnlightCharacter>(GetPawn()))
+	if (ADawnlightCharacter* DawnlightChar = GetPawn<ADawnlightCharacter>())
 	{
 		// リーパーモードが発動可能な場合のみ発動
 		if (DawnlightChar->CanActivateReaperMode())
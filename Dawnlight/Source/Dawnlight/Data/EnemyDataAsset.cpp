@@ -25,34 +25,41 @@ FEnemyVariantConfig UEnemyDataAsset::GetVariantConfig(EEnemyColorVariant Variant
 
 EEnemyColorVariant UEnemyDataAsset::SelectRandomVariant(int32 CurrentWave) const
 {
-	// 有効なバリアントとその重みを収集
-	TArray<TPair<EEnemyColorVariant, float>> ValidVariants;
-	float TotalWeight = 0.0f;
+	return SelectVariantFromRoll(CurrentWave, FMath::FRand());
+}
 
+EEnemyColorVariant UEnemyDataAsset::SelectVariantFromRoll(int32 CurrentWave, float Roll) const
+{
 	// デフォルトは常に候補（重み100）
-	ValidVariants.Add(TPair<EEnemyColorVariant, float>(EEnemyColorVariant::Default, 100.0f));
-	TotalWeight += 100.0f;
+	constexpr float DefaultWeight = 100.0f;
 
-	// 各バリアントをチェック
+	// 有効なバリアントの重みを合計
+	float TotalWeight = DefaultWeight;
 	for (const FEnemyVariantConfig& Config : ColorVariants)
 	{
 		if (Config.SpawnWeight > 0.0f && CurrentWave >= Config.MinWaveToSpawn)
 		{
-			ValidVariants.Add(TPair<EEnemyColorVariant, float>(Config.Variant, Config.SpawnWeight));
 			TotalWeight += Config.SpawnWeight;
 		}
 	}
 
-	// 重み付き乱数選択
-	float RandomValue = FMath::FRandRange(0.0f, TotalWeight);
-	float AccumulatedWeight = 0.0f;
+	// 重み付き選択
+	const float RandomValue = FMath::Clamp(Roll, 0.0f, 1.0f) * TotalWeight;
+	float AccumulatedWeight = DefaultWeight;
+	if (RandomValue <= AccumulatedWeight)
+	{
+		return EEnemyColorVariant::Default;
+	}
 
-	for (const auto& Pair : ValidVariants)
+	for (const FEnemyVariantConfig& Config : ColorVariants)
 	{
-		AccumulatedWeight += Pair.Value;
-		if (RandomValue <= AccumulatedWeight)
+		if (Config.SpawnWeight > 0.0f && CurrentWave >= Config.MinWaveToSpawn)
 		{
-			return Pair.Key;
+			AccumulatedWeight += Config.SpawnWeight;
+			if (RandomValue <= AccumulatedWeight)
+			{
+				return Config.Variant;
+			}
 		}
 	}
 
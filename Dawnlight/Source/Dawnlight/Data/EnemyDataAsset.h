@@ -231,6 +231,9 @@ public:
 	UFUNCTION(BlueprintPure, Category = "敵")
 	EEnemyColorVariant SelectRandomVariant(int32 CurrentWave) const;
 
+	/** ウェーブに応じたバリアントを 0〜1 の乱数値から選択（シード付きの乱数で決定的に選ぶ場合に使用） */
+	EEnemyColorVariant SelectVariantFromRoll(int32 CurrentWave, float Roll) const;
+
 	/** バリアントの表示名を取得 */
 	UFUNCTION(BlueprintPure, Category = "敵")
 	static FText GetVariantDisplayName(EEnemyColorVariant Variant);
@@ -0,0 +1,310 @@
+// Soul Reaper - Dawnlight Project
+// Copyright (c) 2025. All Rights Reserved.
+
+#include "WaveScheduleDataAsset.h"
+#include "Dawnlight.h"
+#include "Math/RandomStream.h"
+
+#if WITH_EDITOR
+#include "Misc/DataValidation.h"
+#endif
+
+#define LOCTEXT_NAMESPACE "WaveScheduleDataAsset"
+
+namespace
+{
+	/** スポーンポイント番号の範囲（実際のスポーンポイント数で剰余を取る） */
+	constexpr int32 SpawnPointIndexRange = 1024;
+
+	/** 重み付きで敵データを選択（出現開始ウェーブ前の敵は除外） */
+	UEnemyDataAsset* PickEnemy(const FWaveConfig& Config, const FRandomStream& Stream, UEnemyDataAsset* FallbackEnemy)
+	{
+		float TotalWeight = 0.0f;
+		for (const TObjectPtr<UEnemyDataAsset>& Enemy : Config.AvailableEnemies)
+		{
+			if (Enemy && Config.WaveNumber >= Enemy->MinWaveToSpawn)
+			{
+				TotalWeight += Enemy->SpawnWeight;
+			}
+		}
+
+		if (TotalWeight <= 0.0f)
+		{
+			return FallbackEnemy;
+		}
+
+		const float RandomValue = Stream.FRandRange(0.0f, TotalWeight);
+		float CurrentWeight = 0.0f;
+		UEnemyDataAsset* LastCandidate = FallbackEnemy;
+
+		for (const TObjectPtr<UEnemyDataAsset>& Enemy : Config.AvailableEnemies)
+		{
+			if (Enemy && Config.WaveNumber >= Enemy->MinWaveToSpawn)
+			{
+				CurrentWeight += Enemy->SpawnWeight;
+				LastCandidate = Enemy;
+				if (RandomValue <= CurrentWeight)
+				{
+					return Enemy;
+				}
+			}
+		}
+
+		return LastCandidate;
+	}
+}
+
+UWaveScheduleDataAsset::UWaveScheduleDataAsset()
+{
+	// 新規アセットのひな形（導入 → 中盤 → クライマックス）
+	FWaveScheduleLoop& DefaultLoop = Loops.AddDefaulted_GetRef();
+
+	FWaveConfig& Wave1 = DefaultLoop.Waves.AddDefaulted_GetRef();
+	Wave1.WaveNumber = 1;
+	Wave1.TotalEnemies = 5;
+	Wave1.MaxConcurrentEnemies = 2;
+	Wave1.SpawnInterval = 3.0f;
+	Wave1.HealthMultiplier = 1.0f;
+	Wave1.DamageMultiplier = 1.0f;
+
+	FWaveConfig& Wave2 = DefaultLoop.Waves.AddDefaulted_GetRef();
+	Wave2.WaveNumber = 2;
+	Wave2.TotalEnemies = 8;
+	Wave2.MaxConcurrentEnemies = 3;
+	Wave2.SpawnInterval = 2.5f;
+	Wave2.HealthMultiplier = 1.2f;
+	Wave2.DamageMultiplier = 1.1f;
+
+	FWaveConfig& Wave3 = DefaultLoop.Waves.AddDefaulted_GetRef();
+	Wave3.WaveNumber = 3;
+	Wave3.TotalEnemies = 12;
+	Wave3.MaxConcurrentEnemies = 4;
+	Wave3.SpawnInterval = 2.0f;
+	Wave3.HealthMultiplier = 1.5f;
+	Wave3.DamageMultiplier = 1.3f;
+
+	BakeSchedule();
+}
+
+// ========================================================================
+// 取得
+// ========================================================================
+
+const TArray<FWaveConfig>& UWaveScheduleDataAsset::GetWaveConfigs(int32 LoopIndex) const
+{
+	static const TArray<FWaveConfig> EmptyConfigs;
+	if (Loops.Num() == 0)
+	{
+		return EmptyConfigs;
+	}
+
+	return Loops[FMath::Clamp(LoopIndex, 0, Loops.Num() - 1)].Waves;
+}
+
+const FWaveSpawnTimeline* UWaveScheduleDataAsset::GetWaveTimeline(int32 LoopIndex, int32 WaveIndex) const
+{
+	if (Loops.Num() == 0)
+	{
+		return nullptr;
+	}
+
+	const FWaveScheduleLoop& Loop = Loops[FMath::Clamp(LoopIndex, 0, Loops.Num() - 1)];
+	return Loop.BakedWaves.IsValidIndex(WaveIndex) ? &Loop.BakedWaves[WaveIndex] : nullptr;
+}
+
+int32 UWaveScheduleDataAsset::GetWaveSeed(int32 LoopIndex, int32 WaveIndex) const
+{
+	const int32 ClampedLoop = Loops.Num() > 0 ? FMath::Clamp(LoopIndex, 0, Loops.Num() - 1) : 0;
+	return static_cast<int32>(HashCombine(HashCombine(GetTypeHash(Seed), GetTypeHash(ClampedLoop)), GetTypeHash(WaveIndex)));
+}
+
+void UWaveScheduleDataAsset::GetReferencedEnemies(TArray<UEnemyDataAsset*>& OutEnemies) const
+{
+	if (DefaultEnemyData)
+	{
+		OutEnemies.AddUnique(DefaultEnemyData);
+	}
+
+	for (const FWaveScheduleLoop& Loop : Loops)
+	{
+		for (const FWaveConfig& Config : Loop.Waves)
+		{
+			for (const TObjectPtr<UEnemyDataAsset>& Enemy : Config.AvailableEnemies)
+			{
+				if (Enemy)
+				{
+					OutEnemies.AddUnique(Enemy);
+				}
+			}
+		}
+	}
+}
+
+// ========================================================================
+// ベイク
+// ========================================================================
+
+void UWaveScheduleDataAsset::BakeSchedule()
+{
+	for (int32 LoopIndex = 0; LoopIndex < Loops.Num(); ++LoopIndex)
+	{
+		FWaveScheduleLoop& Loop = Loops[LoopIndex];
+		Loop.BakedWaves.SetNum(Loop.Waves.Num());
+
+		for (int32 WaveIndex = 0; WaveIndex < Loop.Waves.Num(); ++WaveIndex)
+		{
+			BakeWave(Loop.Waves[WaveIndex], GetWaveSeed(LoopIndex, WaveIndex), FirstSpawnDelay, DefaultEnemyData, Loop.BakedWaves[WaveIndex]);
+		}
+	}
+}
+
+void UWaveScheduleDataAsset::BakeWave(const FWaveConfig& Config, int32 WaveSeed, float FirstSpawnDelay, UEnemyDataAsset* FallbackEnemy, FWaveSpawnTimeline& OutTimeline)
+{
+	const FRandomStream Stream(WaveSeed);
+	const int32 EventCount = FMath::Max(Config.TotalEnemies, 0);
+
+	OutTimeline.Events.Reset(EventCount);
+	for (int32 i = 0; i < EventCount; ++i)
+	{
+		FWaveSpawnEvent& Event = OutTimeline.Events.AddDefaulted_GetRef();
+		Event.Time = FirstSpawnDelay + i * Config.SpawnInterval;
+		Event.EnemyData = PickEnemy(Config, Stream, FallbackEnemy);
+		Event.SpawnPointIndex = Stream.RandRange(0, SpawnPointIndexRange - 1);
+
+		// 乱数の消費数をイベントごとに揃えるため、敵データがなくても引いておく
+		const float VariantRoll = Stream.FRand();
+		Event.Variant = Event.EnemyData
+			? Event.EnemyData->SelectVariantFromRoll(Config.WaveNumber, VariantRoll)
+			: EEnemyColorVariant::Default;
+	}
+}
+
+void UWaveScheduleDataAsset::MakeRampedWaveConfigs(int32 WaveCount, TConstArrayView<int32> EnemiesPerWave, TArray<FWaveConfig>& OutConfigs)
+{
+	OutConfigs.Reset(WaveCount);
+	for (int32 i = 0; i < WaveCount; i++)
+	{
+		FWaveConfig& Config = OutConfigs.AddDefaulted_GetRef();
+		Config.WaveNumber = i + 1;
+		Config.TotalEnemies = EnemiesPerWave.IsValidIndex(i) ? EnemiesPerWave[i] : 5;
+		Config.MaxConcurrentEnemies = FMath::Min(Config.TotalEnemies, 5);  // 同時に最大5体
+		Config.SpawnInterval = 2.0f;
+		Config.HealthMultiplier = 1.0f + (i * 0.2f);  // ウェーブごとにHP増加
+		Config.DamageMultiplier = 1.0f + (i * 0.1f);  // ウェーブごとにダメージ増加
+	}
+}
+
+// ========================================================================
+// 検証
+// ========================================================================
+
+bool UWaveScheduleDataAsset::ValidateSchedule(TArray<FText>& OutErrors, TArray<FText>& OutWarnings) const
+{
+	const int32 NumErrorsBefore = OutErrors.Num();
+
+	if (Loops.Num() == 0)
+	{
+		OutErrors.Add(LOCTEXT("NoLoops", "ループが1つもありません"));
+	}
+
+	for (int32 LoopIndex = 0; LoopIndex < Loops.Num(); ++LoopIndex)
+	{
+		const FWaveScheduleLoop& Loop = Loops[LoopIndex];
+		if (Loop.Waves.Num() == 0)
+		{
+			OutErrors.Add(FText::Format(LOCTEXT("NoWaves", "ループ {0}: ウェーブがありません"), LoopIndex + 1));
+			continue;
+		}
+
+		for (int32 WaveIndex = 0; WaveIndex < Loop.Waves.Num(); ++WaveIndex)
+		{
+			const FWaveConfig& Config = Loop.Waves[WaveIndex];
+
+			// 同時存在数が敵の予算を超えている
+			if (Config.MaxConcurrentEnemies > MaxConcurrentEnemyBudget)
+			{
+				OutErrors.Add(FText::Format(
+					LOCTEXT("OverBudget", "ループ {0} ウェーブ {1}: 同時存在数 {2} が敵の予算 {3} を超えています"),
+					LoopIndex + 1, Config.WaveNumber, Config.MaxConcurrentEnemies, MaxConcurrentEnemyBudget));
+			}
+
+			if (Config.WaveNumber != WaveIndex + 1)
+			{
+				OutWarnings.Add(FText::Format(
+					LOCTEXT("WaveNumberMismatch", "ループ {0}: {1} 番目のウェーブのウェーブ番号が {2} です"),
+					LoopIndex + 1, WaveIndex + 1, Config.WaveNumber));
+			}
+
+			// 出現できる敵がいない
+			const bool bHasAvailableEnemy = Config.AvailableEnemies.ContainsByPredicate([&Config](const TObjectPtr<UEnemyDataAsset>& Enemy)
+			{
+				return Enemy && Enemy->SpawnWeight > 0.0f && Config.WaveNumber >= Enemy->MinWaveToSpawn;
+			});
+
+			if (!bHasAvailableEnemy && !DefaultEnemyData)
+			{
+				OutWarnings.Add(FText::Format(
+					LOCTEXT("NoEnemies", "ループ {0} ウェーブ {1}: 出現できる敵がいません（スポーナーのデフォルト敵を使用）"),
+					LoopIndex + 1, Config.WaveNumber));
+			}
+
+			// ベイク結果と設定の不一致
+			const FWaveSpawnTimeline* Timeline = GetWaveTimeline(LoopIndex, WaveIndex);
+			if (!Timeline || Timeline->Events.Num() != Config.TotalEnemies)
+			{
+				OutErrors.Add(FText::Format(
+					LOCTEXT("NotBaked", "ループ {0} ウェーブ {1}: タイムラインがベイクされていません"),
+					LoopIndex + 1, Config.WaveNumber));
+			}
+		}
+	}
+
+	return OutErrors.Num() == NumErrorsBefore;
+}
+
+// ========================================================================
+// UObject インターフェース
+// ========================================================================
+
+void UWaveScheduleDataAsset::PostLoad()
+{
+	Super::PostLoad();
+
+	// ロード時にベイク（シードから決定的に生成）
+	BakeSchedule();
+}
+
+#if WITH_EDITOR
+void UWaveScheduleDataAsset::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	BakeSchedule();
+}
+
+EDataValidationResult UWaveScheduleDataAsset::IsDataValid(FDataValidationContext& Context) const
+{
+	EDataValidationResult Result = Super::IsDataValid(Context);
+
+	TArray<FText> Errors;
+	TArray<FText> Warnings;
+	if (!ValidateSchedule(Errors, Warnings))
+	{
+		Result = EDataValidationResult::Invalid;
+	}
+
+	for (const FText& Error : Errors)
+	{
+		Context.AddError(Error);
+	}
+
+	for (const FText& Warning : Warnings)
+	{
+		Context.AddWarning(Warning);
+	}
+
+	return Result;
+}
+#endif
+
+#undef LOCTEXT_NAMESPACE
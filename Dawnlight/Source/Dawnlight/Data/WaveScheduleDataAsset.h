@@ -0,0 +1,131 @@
+// Soul Reaper - Dawnlight Project
+// Copyright (c) 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "Subsystems/WaveSpawnerSubsystem.h"
+#include "WaveScheduleDataAsset.generated.h"
+
+/**
+ * 1ループ分のウェーブ設定
+ */
+USTRUCT(BlueprintType)
+struct DAWNLIGHT_API FWaveScheduleLoop
+{
+	GENERATED_BODY()
+
+	/** ウェーブ設定 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "ウェーブ")
+	TArray<FWaveConfig> Waves;
+
+	/** ベイク済みタイムライン（Waves と同じ並び、ロード時に生成） */
+	UPROPERTY(VisibleAnywhere, Transient, Category = "ウェーブ")
+	TArray<FWaveSpawnTimeline> BakedWaves;
+};
+
+/**
+ * ウェーブスケジュールデータアセット
+ *
+ * ループ・ウェーブごとのスポーンイベント（時間、敵データ、スポーンポイント、カラーバリアント）を
+ * ロード時にシードから決定的にベイクする
+ * - UWaveSpawnerSubsystem はスポーン時に重み付き抽選をせず、カーソルを進めるだけ
+ * - 同じシードなら毎回同じウェーブになる（ベンチマーク用）
+ * - データ検証で同時存在数が敵の予算を超えるウェーブを検出
+ */
+UCLASS(BlueprintType)
+class DAWNLIGHT_API UWaveScheduleDataAsset : public UPrimaryDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UWaveScheduleDataAsset();
+
+	// ========================================================================
+	// 設定
+	// ========================================================================
+
+	/** ループごとのウェーブ設定 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "スケジュール")
+	TArray<FWaveScheduleLoop> Loops;
+
+	/** ベイクに使う乱数シード */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "スケジュール")
+	int32 Seed = 1;
+
+	/** ウェーブ開始から最初のスポーンまでの時間（秒） */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "スケジュール", meta = (ClampMin = "0.0"))
+	float FirstSpawnDelay = 0.5f;
+
+	/** 敵データが選べない場合に使う敵 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "スケジュール")
+	TObjectPtr<UEnemyDataAsset> DefaultEnemyData;
+
+	/** 同時存在できる敵の予算（検証用） */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "検証", meta = (ClampMin = "1"))
+	int32 MaxConcurrentEnemyBudget = 8;
+
+	// ========================================================================
+	// 取得
+	// ========================================================================
+
+	/** ループ数 */
+	UFUNCTION(BlueprintPure, Category = "スケジュール")
+	int32 GetLoopCount() const { return Loops.Num(); }
+
+	/** ループのウェーブ設定（範囲外のループは最後のループ） */
+	const TArray<FWaveConfig>& GetWaveConfigs(int32 LoopIndex) const;
+
+	/** ベイク済みタイムライン（未ベイク・範囲外は null） */
+	const FWaveSpawnTimeline* GetWaveTimeline(int32 LoopIndex, int32 WaveIndex) const;
+
+	/** ウェーブのベイク用シード */
+	int32 GetWaveSeed(int32 LoopIndex, int32 WaveIndex) const;
+
+	/** スケジュールで使う敵データを収集（プリロード用） */
+	void GetReferencedEnemies(TArray<UEnemyDataAsset*>& OutEnemies) const;
+
+	// ========================================================================
+	// ベイク
+	// ========================================================================
+
+	/** 全ループ・全ウェーブのタイムラインを再生成 */
+	UFUNCTION(CallInEditor, Category = "スケジュール")
+	void BakeSchedule();
+
+	/** 1ウェーブ分のタイムラインを生成（敵数倍率を適用した設定の再ベイクにも使う） */
+	static void BakeWave(const FWaveConfig& Config, int32 WaveSeed, float FirstSpawnDelay, UEnemyDataAsset* FallbackEnemy, FWaveSpawnTimeline& OutTimeline);
+
+	/**
+	 * ウェーブごとに敵数・強さが上がる設定を生成（スケジュール未設定時のフォールバック）
+	 * @param EnemiesPerWave ウェーブごとの敵数（足りない分は5体）
+	 */
+	static void MakeRampedWaveConfigs(int32 WaveCount, TConstArrayView<int32> EnemiesPerWave, TArray<FWaveConfig>& OutConfigs);
+
+	// ========================================================================
+	// 検証
+	// ========================================================================
+
+	/**
+	 * スケジュールを検証
+	 * @return 問題がなければ true
+	 */
+	bool ValidateSchedule(TArray<FText>& OutErrors, TArray<FText>& OutWarnings) const;
+
+	// ========================================================================
+	// UObject インターフェース
+	// ========================================================================
+
+	virtual void PostLoad() override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+	virtual EDataValidationResult IsDataValid(FDataValidationContext& Context) const override;
+#endif
+
+	virtual FPrimaryAssetId GetPrimaryAssetId() const override
+	{
+		return FPrimaryAssetId(TEXT("WaveSchedule"), GetFName());
+	}
+};
@@ -1,10 +1,33 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "Dawnlight.h"
+#include "DawnlightStats.h"
 #include "Modules/ModuleManager.h"
+#include "UI/Utilities/UITweenEngine.h"
 
 DEFINE_LOG_CATEGORY(LogDawnlight);
 
+UE_TRACE_CHANNEL_DEFINE(DawnlightChannel);
+
+CSV_DEFINE_CATEGORY_MODULE(DAWNLIGHT_API, Dawnlight, true);
+
+DEFINE_STAT(STAT_DawnlightSpawnEnemy);
+DEFINE_STAT(STAT_DawnlightCollectSoul);
+DEFINE_STAT(STAT_DawnlightGenerateUpgradeChoices);
+DEFINE_STAT(STAT_DawnlightMeleeTrace);
+DEFINE_STAT(STAT_DawnlightEnemyTick);
+DEFINE_STAT(STAT_DawnlightAnimalHerdTick);
+DEFINE_STAT(STAT_DawnlightSoulPickupTick);
+DEFINE_STAT(STAT_DawnlightEnemyBlackboard);
+DEFINE_STAT(STAT_DawnlightAnimalBlackboard);
+DEFINE_STAT(STAT_DawnlightHUDTick);
+
+DEFINE_STAT(STAT_DawnlightLiveEnemies);
+DEFINE_STAT(STAT_DawnlightLiveAnimals);
+DEFINE_STAT(STAT_DawnlightLivePickups);
+DEFINE_STAT(STAT_DawnlightPooledActors);
+DEFINE_STAT(STAT_DawnlightActiveTimers);
+
 void FDawnlightModule::StartupModule()
 {
 	UE_LOG(LogDawnlight, Log, TEXT("Dawnlight モジュールを開始しました"));
@@ -12,6 +35,8 @@ void FDawnlightModule::StartupModule()
 
 void FDawnlightModule::ShutdownModule()
 {
+	FUITweenEngine::Shutdown();
+
 	UE_LOG(LogDawnlight, Log, TEXT("Dawnlight モジュールを終了しました"));
 }
 
@@ -0,0 +1,66 @@
+// Soul Reaper - Dawnlight Project
+// Copyright (c) 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+/**
+ * Dawnlight の stat グループと Unreal Insights のトレースチャンネル
+ *
+ * - stat dawnlight : ゲーム固有の処理時間と生存数カウンター
+ * - stat dawnlightai / dawnlightsouls / dawnlightspawn / dawnlightui : システムごとの詳細
+ * - Insights では -trace=cpu,dawnlight で Dawnlight のスコープを有効化
+ * - CSV プロファイラー（-csvCategories=Dawnlight）ではフェーズ・生存数・魂数・コンボ・緊張度を毎フレーム記録し、
+ *   フェーズ遷移・ウェーブ開始/終了・リーパーモード発動・アップグレード取得をイベントとして記録
+ *
+ * 各システム固有の stat は使用する .cpp で下記のグループに対して宣言する
+ */
+
+UE_TRACE_CHANNEL_EXTERN(DawnlightChannel, DAWNLIGHT_API);
+
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(DAWNLIGHT_API, Dawnlight);
+
+// ========================================================================
+// stat グループ
+// ========================================================================
+
+DECLARE_STATS_GROUP(TEXT("Dawnlight"), STATGROUP_Dawnlight, STATCAT_Advanced);
+DECLARE_STATS_GROUP(TEXT("Dawnlight AI"), STATGROUP_DawnlightAI, STATCAT_Advanced);
+DECLARE_STATS_GROUP(TEXT("Dawnlight Souls"), STATGROUP_DawnlightSouls, STATCAT_Advanced);
+DECLARE_STATS_GROUP(TEXT("Dawnlight Spawn"), STATGROUP_DawnlightSpawn, STATCAT_Advanced);
+DECLARE_STATS_GROUP(TEXT("Dawnlight UI"), STATGROUP_DawnlightUI, STATCAT_Advanced);
+
+// ========================================================================
+// 処理時間（stat dawnlight）
+// ========================================================================
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Spawn Enemy"), STAT_DawnlightSpawnEnemy, STATGROUP_Dawnlight, DAWNLIGHT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Collect Soul"), STAT_DawnlightCollectSoul, STATGROUP_Dawnlight, DAWNLIGHT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Generate Upgrade Choices"), STAT_DawnlightGenerateUpgradeChoices, STATGROUP_Dawnlight, DAWNLIGHT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Melee Swing Trace"), STAT_DawnlightMeleeTrace, STATGROUP_Dawnlight, DAWNLIGHT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Enemy Crowd Tick"), STAT_DawnlightEnemyTick, STATGROUP_Dawnlight, DAWNLIGHT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Animal Herd Tick"), STAT_DawnlightAnimalHerdTick, STATGROUP_Dawnlight, DAWNLIGHT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Soul Pickup Tick"), STAT_DawnlightSoulPickupTick, STATGROUP_Dawnlight, DAWNLIGHT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Enemy AI Update Blackboard"), STAT_DawnlightEnemyBlackboard, STATGROUP_Dawnlight, DAWNLIGHT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Animal AI Update Blackboard"), STAT_DawnlightAnimalBlackboard, STATGROUP_Dawnlight, DAWNLIGHT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("HUD Tick"), STAT_DawnlightHUDTick, STATGROUP_Dawnlight, DAWNLIGHT_API);
+
+// ========================================================================
+// 生存数（stat dawnlight、ゲームモードが毎フレーム更新）
+// ========================================================================
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Live Enemies"), STAT_DawnlightLiveEnemies, STATGROUP_Dawnlight, DAWNLIGHT_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Live Animals"), STAT_DawnlightLiveAnimals, STATGROUP_Dawnlight, DAWNLIGHT_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Live Soul Pickups"), STAT_DawnlightLivePickups, STATGROUP_Dawnlight, DAWNLIGHT_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Pooled Actors"), STAT_DawnlightPooledActors, STATGROUP_Dawnlight, DAWNLIGHT_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Active Game Timers"), STAT_DawnlightActiveTimers, STATGROUP_Dawnlight, DAWNLIGHT_API);
+
+/** stat と Insights（DawnlightChannel）の両方に計測スコープを出す */
+#define DAWNLIGHT_SCOPE_CYCLE_COUNTER(Stat) \
+	SCOPE_CYCLE_COUNTER(Stat); \
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(Stat, DawnlightChannel)
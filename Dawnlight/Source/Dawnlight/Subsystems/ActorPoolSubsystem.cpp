@@ -0,0 +1,320 @@
+// Soul Reaper - Dawnlight Project
+// Copyright (c) 2025. All Rights Reserved.
+
+#include "ActorPoolSubsystem.h"
+#include "Dawnlight.h"
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemGlobals.h"
+#include "AIController.h"
+#include "BrainComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "TimerManager.h"
+
+void UActorPoolSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	UE_LOG(LogDawnlight, Log, TEXT("[ActorPoolSubsystem] 初期化完了"));
+}
+
+void UActorPoolSubsystem::Deinitialize()
+{
+	LogPoolStats();
+
+	Pools.Empty();
+	PooledActorKeys.Empty();
+	ParkedControllers.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UActorPoolSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// ゲームワールドでのみ作成
+	if (const UWorld* World = Cast<UWorld>(Outer))
+	{
+		return World->IsGameWorld();
+	}
+	return false;
+}
+
+// ========================================================================
+// 取得/返却
+// ========================================================================
+
+AActor* UActorPoolSubsystem::AcquireActor(TSubclassOf<AActor> ActorClass, const FTransform& SpawnTransform, TFunctionRef<void(AActor*)> InitializeFunc)
+{
+	if (!ActorClass)
+	{
+		UE_LOG(LogDawnlight, Warning, TEXT("[ActorPoolSubsystem] クラスがnullのため取得できません"));
+		return nullptr;
+	}
+
+	FActorPoolEntry& Entry = Pools.FindOrAdd(ActorClass.Get());
+
+	// 待機中のアクターを探す（外部で破棄されたものは捨てる）
+	AActor* Actor = nullptr;
+	while (Entry.InactiveActors.Num() > 0 && !Actor)
+	{
+		AActor* Candidate = Entry.InactiveActors.Pop(EAllowShrinking::No);
+		PooledActorKeys.Remove(Candidate);
+
+		if (IsValid(Candidate) && !Candidate->IsActorBeingDestroyed())
+		{
+			Actor = Candidate;
+		}
+	}
+
+	if (Actor)
+	{
+		Entry.Stats.Hits++;
+
+		InitializeFunc(Actor);
+		ActivateActor(Actor, SpawnTransform);
+	}
+	else
+	{
+		Entry.Stats.Misses++;
+
+		Actor = SpawnPooledActor(ActorClass, SpawnTransform, InitializeFunc);
+		if (!Actor)
+		{
+			return nullptr;
+		}
+	}
+
+	Entry.Stats.ActiveCount++;
+	Entry.Stats.InactiveCount = Entry.InactiveActors.Num();
+	Entry.Stats.HighWaterMark = FMath::Max(Entry.Stats.HighWaterMark, Entry.Stats.ActiveCount);
+
+	return Actor;
+}
+
+void UActorPoolSubsystem::ReleaseActor(AActor* Actor)
+{
+	if (!IsValid(Actor) || Actor->IsActorBeingDestroyed())
+	{
+		return;
+	}
+
+	// ワールド破棄中はプールに戻さない
+	UWorld* World = GetWorld();
+	if (!World || World->bIsTearingDown)
+	{
+		return;
+	}
+
+	if (IsActorPooled(Actor))
+	{
+		UE_LOG(LogDawnlight, Warning, TEXT("[ActorPoolSubsystem] %s は既にプールに返却済みです"), *Actor->GetName());
+		return;
+	}
+
+	DeactivateActor(Actor);
+
+	FActorPoolEntry& Entry = Pools.FindOrAdd(Actor->GetClass());
+	Entry.InactiveActors.Add(Actor);
+	PooledActorKeys.Add(Actor);
+
+	Entry.Stats.ActiveCount = FMath::Max(0, Entry.Stats.ActiveCount - 1);
+	Entry.Stats.InactiveCount = Entry.InactiveActors.Num();
+}
+
+bool UActorPoolSubsystem::IsActorPooled(const AActor* Actor) const
+{
+	return Actor && PooledActorKeys.Contains(Actor);
+}
+
+// ========================================================================
+// プリウォーム
+// ========================================================================
+
+void UActorPoolSubsystem::PrewarmPool(TSubclassOf<AActor> ActorClass, int32 Count)
+{
+	if (!ActorClass || Count <= 0)
+	{
+		return;
+	}
+
+	FActorPoolEntry& Entry = Pools.FindOrAdd(ActorClass.Get());
+	const int32 ToSpawn = Count - Entry.InactiveActors.Num();
+
+	for (int32 i = 0; i < ToSpawn; ++i)
+	{
+		AActor* Actor = SpawnPooledActor(ActorClass, FTransform::Identity, [](AActor* SpawnedActor)
+		{
+			// データ（EnemyData等）が未設定のまま BeginPlay を迎えるため、初期化を取得時まで遅らせる
+			if (IDawnlightPoolableActor* Poolable = Cast<IDawnlightPoolableActor>(SpawnedActor))
+			{
+				Poolable->MarkAsPrewarmSpawn();
+			}
+		});
+		if (!Actor)
+		{
+			break;
+		}
+
+		DeactivateActor(Actor);
+		Entry.InactiveActors.Add(Actor);
+		PooledActorKeys.Add(Actor);
+		Entry.Stats.PrewarmedCount++;
+	}
+
+	Entry.Stats.InactiveCount = Entry.InactiveActors.Num();
+
+	if (ToSpawn > 0)
+	{
+		UE_LOG(LogDawnlight, Log, TEXT("[ActorPoolSubsystem] プリウォーム: %s x%d (待機: %d)"),
+			*ActorClass->GetName(), ToSpawn, Entry.InactiveActors.Num());
+	}
+}
+
+void UActorPoolSubsystem::PrewarmPools(const TMap<TSubclassOf<AActor>, int32>& PrewarmCounts)
+{
+	for (const TPair<TSubclassOf<AActor>, int32>& Pair : PrewarmCounts)
+	{
+		PrewarmPool(Pair.Key, Pair.Value);
+	}
+}
+
+// ========================================================================
+// 統計
+// ========================================================================
+
+FActorPoolStats UActorPoolSubsystem::GetPoolStats(TSubclassOf<AActor> ActorClass) const
+{
+	if (const FActorPoolEntry* Entry = Pools.Find(ActorClass.Get()))
+	{
+		return Entry->Stats;
+	}
+	return FActorPoolStats();
+}
+
+int32 UActorPoolSubsystem::GetTotalPooledCount() const
+{
+	int32 Total = 0;
+	for (const TPair<TObjectPtr<UClass>, FActorPoolEntry>& Pair : Pools)
+	{
+		Total += Pair.Value.InactiveActors.Num();
+	}
+	return Total;
+}
+
+void UActorPoolSubsystem::LogPoolStats() const
+{
+	for (const TPair<TObjectPtr<UClass>, FActorPoolEntry>& Pair : Pools)
+	{
+		const FActorPoolStats& Stats = Pair.Value.Stats;
+		UE_LOG(LogDawnlight, Log, TEXT("[ActorPoolSubsystem] %s: Hit=%d Miss=%d Active=%d Inactive=%d HighWater=%d Prewarm=%d"),
+			*GetNameSafe(Pair.Key), Stats.Hits, Stats.Misses, Stats.ActiveCount, Stats.InactiveCount,
+			Stats.HighWaterMark, Stats.PrewarmedCount);
+	}
+}
+
+// ========================================================================
+// 内部処理
+// ========================================================================
+
+AActor* UActorPoolSubsystem::SpawnPooledActor(UClass* ActorClass, const FTransform& SpawnTransform, TFunctionRef<void(AActor*)> InitializeFunc)
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	AActor* Actor = World->SpawnActorDeferred<AActor>(
+		ActorClass,
+		SpawnTransform,
+		nullptr,
+		nullptr,
+		ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn
+	);
+
+	if (!Actor)
+	{
+		UE_LOG(LogDawnlight, Warning, TEXT("[ActorPoolSubsystem] スポーンに失敗: %s"), *GetNameSafe(ActorClass));
+		return nullptr;
+	}
+
+	// BeginPlay前にデータを設定
+	InitializeFunc(Actor);
+	Actor->FinishSpawning(SpawnTransform);
+
+	return Actor;
+}
+
+void UActorPoolSubsystem::ActivateActor(AActor* Actor, const FTransform& SpawnTransform)
+{
+	Actor->SetActorTransform(SpawnTransform, false, nullptr, ETeleportType::ResetPhysics);
+	Actor->SetActorHiddenInGame(false);
+	Actor->SetActorEnableCollision(true);
+	Actor->SetActorTickEnabled(true);
+
+	// 返却時に切り離したコントローラーを再Possess
+	if (APawn* Pawn = Cast<APawn>(Actor))
+	{
+		TObjectPtr<AController> ParkedController;
+		if (ParkedControllers.RemoveAndCopyValue(Pawn, ParkedController) && IsValid(ParkedController))
+		{
+			ParkedController->SetActorTickEnabled(true);
+			ParkedController->Possess(Pawn);
+		}
+		else if (!Pawn->GetController() &&
+			(Pawn->AutoPossessAI == EAutoPossessAI::Spawned || Pawn->AutoPossessAI == EAutoPossessAI::PlacedInWorldOrSpawned))
+		{
+			Pawn->SpawnDefaultController();
+		}
+	}
+
+	if (IDawnlightPoolableActor* Poolable = Cast<IDawnlightPoolableActor>(Actor))
+	{
+		Poolable->OnAcquiredFromPool();
+	}
+}
+
+void UActorPoolSubsystem::DeactivateActor(AActor* Actor)
+{
+	if (IDawnlightPoolableActor* Poolable = Cast<IDawnlightPoolableActor>(Actor))
+	{
+		Poolable->OnReleasedToPool();
+	}
+
+	// AIを停止してコントローラーを切り離す（破棄せず再利用する）
+	if (APawn* Pawn = Cast<APawn>(Actor))
+	{
+		if (AController* Controller = Pawn->GetController())
+		{
+			if (AAIController* AIController = Cast<AAIController>(Controller))
+			{
+				AIController->StopMovement();
+				if (UBrainComponent* Brain = AIController->GetBrainComponent())
+				{
+					Brain->StopLogic(TEXT("Pooled"));
+				}
+			}
+
+			Controller->UnPossess();
+			Controller->SetActorTickEnabled(false);
+			ParkedControllers.Add(Pawn, Controller);
+		}
+	}
+
+	// GASの状態をリセット
+	if (UAbilitySystemComponent* ASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(Actor))
+	{
+		ASC->CancelAllAbilities();
+		ASC->RemoveActiveEffects(FGameplayEffectQuery());
+	}
+
+	// 死亡後の削除タイマー等を停止
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearAllTimersForObject(Actor);
+	}
+
+	Actor->SetActorTickEnabled(false);
+	Actor->SetActorEnableCollision(false);
+	Actor->SetActorHiddenInGame(true);
+}
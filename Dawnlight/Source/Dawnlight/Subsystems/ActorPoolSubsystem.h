@@ -0,0 +1,201 @@
+// Soul Reaper - Dawnlight Project
+// Copyright (c) 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/Interface.h"
+#include "UObject/ObjectKey.h"
+#include "Templates/Function.h"
+#include "ActorPoolSubsystem.generated.h"
+
+class AController;
+
+/**
+ * プール対象アクターのインターフェース
+ *
+ * プールから取り出された時/返却された時にアクター固有の状態をリセットする
+ * （BeginPlayは最初のスポーン時にしか呼ばれないため）
+ */
+UINTERFACE(MinimalAPI, meta = (CannotImplementInterfaceInBlueprint))
+class UDawnlightPoolableActor : public UInterface
+{
+	GENERATED_BODY()
+};
+
+class DAWNLIGHT_API IDawnlightPoolableActor
+{
+	GENERATED_BODY()
+
+public:
+	/** プールから再利用される直前（表示・コリジョン有効化後）に呼ばれる */
+	virtual void OnAcquiredFromPool() = 0;
+
+	/** プールに返却された直後（非表示化の前）に呼ばれる */
+	virtual void OnReleasedToPool() = 0;
+
+	/** プリウォームでスポーンされる場合に BeginPlay の前に呼ばれる（データに依存する初期化は最初の取得時まで省略できる） */
+	virtual void MarkAsPrewarmSpawn() {}
+};
+
+/**
+ * クラスごとのプール統計
+ */
+USTRUCT(BlueprintType)
+struct FActorPoolStats
+{
+	GENERATED_BODY()
+
+	/** プール内のアクターで要求を満たした回数 */
+	UPROPERTY(BlueprintReadOnly, Category = "アクタープール")
+	int32 Hits = 0;
+
+	/** プールが空で新規スポーンした回数 */
+	UPROPERTY(BlueprintReadOnly, Category = "アクタープール")
+	int32 Misses = 0;
+
+	/** 現在使用中の数 */
+	UPROPERTY(BlueprintReadOnly, Category = "アクタープール")
+	int32 ActiveCount = 0;
+
+	/** 現在プール内で待機している数 */
+	UPROPERTY(BlueprintReadOnly, Category = "アクタープール")
+	int32 InactiveCount = 0;
+
+	/** 同時使用数の最大値 */
+	UPROPERTY(BlueprintReadOnly, Category = "アクタープール")
+	int32 HighWaterMark = 0;
+
+	/** プリウォームで生成した数 */
+	UPROPERTY(BlueprintReadOnly, Category = "アクタープール")
+	int32 PrewarmedCount = 0;
+};
+
+/**
+ * クラス単位のプール
+ */
+USTRUCT()
+struct FActorPoolEntry
+{
+	GENERATED_BODY()
+
+	/** 待機中のアクター */
+	UPROPERTY()
+	TArray<TObjectPtr<AActor>> InactiveActors;
+
+	/** 統計 */
+	FActorPoolStats Stats;
+};
+
+/**
+ * アクタープールサブシステム
+ *
+ * 敵・動物などの頻繁にスポーン/破棄されるアクターを再利用する
+ * - ウェーブ補充時のアクター生成・コンポーネント登録・GCによるヒッチを回避
+ * - クラスごとのプリウォーム
+ * - 取得/返却時のリセット（HP・移動・AIコントローラー・GAS）
+ * - ヒット/ミス/最大同時使用数の統計
+ */
+UCLASS()
+class DAWNLIGHT_API UActorPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ========================================================================
+	// UWorldSubsystem インターフェース
+	// ========================================================================
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+	// ========================================================================
+	// 取得/返却
+	// ========================================================================
+
+	/**
+	 * プールからアクターを取得（空なら新規スポーン）
+	 * @param InitializeFunc 有効化の前に呼ばれる初期化処理（データアセットの設定など）
+	 *                       新規スポーン時はBeginPlayの前に呼ばれる
+	 */
+	AActor* AcquireActor(TSubclassOf<AActor> ActorClass, const FTransform& SpawnTransform, TFunctionRef<void(AActor*)> InitializeFunc);
+
+	/** プールからアクターを取得（型付き） */
+	template<typename T>
+	T* AcquireActor(TSubclassOf<AActor> ActorClass, const FTransform& SpawnTransform, TFunctionRef<void(T*)> InitializeFunc)
+	{
+		return Cast<T>(AcquireActor(ActorClass, SpawnTransform, [&InitializeFunc](AActor* Actor)
+		{
+			if (T* TypedActor = Cast<T>(Actor))
+			{
+				InitializeFunc(TypedActor);
+			}
+		}));
+	}
+
+	/** アクターをプールに返却 */
+	UFUNCTION(BlueprintCallable, Category = "アクタープール")
+	void ReleaseActor(AActor* Actor);
+
+	/** アクターがプール内で待機中かどうか */
+	UFUNCTION(BlueprintPure, Category = "アクタープール")
+	bool IsActorPooled(const AActor* Actor) const;
+
+	// ========================================================================
+	// プリウォーム
+	// ========================================================================
+
+	/** 指定クラスの待機数が Count になるまで事前生成 */
+	UFUNCTION(BlueprintCallable, Category = "アクタープール")
+	void PrewarmPool(TSubclassOf<AActor> ActorClass, int32 Count);
+
+	/** クラスごとのプリウォーム数をまとめて適用 */
+	UFUNCTION(BlueprintCallable, Category = "アクタープール")
+	void PrewarmPools(const TMap<TSubclassOf<AActor>, int32>& PrewarmCounts);
+
+	// ========================================================================
+	// 統計
+	// ========================================================================
+
+	/** 指定クラスの統計を取得 */
+	UFUNCTION(BlueprintPure, Category = "アクタープール")
+	FActorPoolStats GetPoolStats(TSubclassOf<AActor> ActorClass) const;
+
+	/** 全クラスでプール内に待機しているアクターの数 */
+	int32 GetTotalPooledCount() const;
+
+	/** 全クラスの統計をログ出力 */
+	UFUNCTION(BlueprintCallable, Category = "アクタープール")
+	void LogPoolStats() const;
+
+protected:
+	// ========================================================================
+	// 内部データ
+	// ========================================================================
+
+	/** クラスごとのプール */
+	UPROPERTY()
+	TMap<TObjectPtr<UClass>, FActorPoolEntry> Pools;
+
+	/** 待機中アクターの高速判定用 */
+	TSet<TObjectKey<AActor>> PooledActorKeys;
+
+	/** 返却時に切り離したコントローラー（再取得時に再Possessする） */
+	UPROPERTY()
+	TMap<TObjectPtr<APawn>, TObjectPtr<AController>> ParkedControllers;
+
+	// ========================================================================
+	// 内部処理
+	// ========================================================================
+
+	/** 新規スポーン（遅延スポーンで InitializeFunc を BeginPlay 前に適用） */
+	AActor* SpawnPooledActor(UClass* ActorClass, const FTransform& SpawnTransform, TFunctionRef<void(AActor*)> InitializeFunc);
+
+	/** 待機中アクターを有効化 */
+	void ActivateActor(AActor* Actor, const FTransform& SpawnTransform);
+
+	/** アクターを無効化して待機状態にする */
+	void DeactivateActor(AActor* Actor);
+};
@@ -0,0 +1,649 @@
+// Soul Reaper - Dawnlight Project
+// Copyright (c) 2025. All Rights Reserved.
+
+#include "AnimalHerdSubsystem.h"
+#include "Dawnlight.h"
+#include "DawnlightStats.h"
+#include "PlayerContextSubsystem.h"
+#include "SpatialGridSubsystem.h"
+#include "AI/AnimalAIController.h"
+#include "Async/ParallelFor.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "NavigationSystem.h"
+
+DECLARE_CYCLE_STAT(TEXT("Animal Herd Nav Samples"), STAT_DawnlightAnimalHerdNavSamples, STATGROUP_DawnlightAI);
+
+namespace
+{
+	/** 徘徊先に到達したとみなす距離 */
+	constexpr float WanderArrivalDistance = 50.0f;
+
+	/** 目的地がこれより近い場合はステアリングせず目的地へそのまま向かう */
+	constexpr float SteeringMinLookAhead = 200.0f;
+
+	/** サンプル点の探索範囲（セル数） */
+	constexpr int32 NavSampleSearchRings = 3;
+
+	/** ナビメッシュがない場合の最初の再試行間隔（秒、失敗するごとに倍にする） */
+	constexpr float NavSampleRetryInterval = 2.0f;
+
+	/** 再試行の上限回数（以降はナビメッシュの生成完了イベントのみで作成する） */
+	constexpr int32 MaxNavSampleRetries = 5;
+}
+
+void UAnimalHerdSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	PlayerContext = Collection.InitializeDependency<UPlayerContextSubsystem>();
+	WanderStream.GenerateNewSeed();
+
+	UE_LOG(LogDawnlight, Log, TEXT("[AnimalHerdSubsystem] 初期化完了"));
+}
+
+void UAnimalHerdSubsystem::Deinitialize()
+{
+	Animals.Empty();
+	Locations.Empty();
+	States.Empty();
+	HerdKeys.Empty();
+	HomeLocations.Empty();
+	WanderTargets.Empty();
+	WanderTimers.Empty();
+	WanderIntervals.Empty();
+	WanderRadii.Empty();
+	FleeRadiiSq.Empty();
+	DetectionRadiiSq.Empty();
+	FleeDestinations.Empty();
+	MoveDestinations.Empty();
+	SteeringTimers.Empty();
+	SteeringDue.Empty();
+	IndexByAnimal.Empty();
+	NavSamples.Empty();
+	NavSampleValid.Empty();
+	PlayerContext = nullptr;
+
+	if (UNavigationSystemV1* NavSystem = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld()))
+	{
+		NavSystem->OnNavigationGenerationFinishedDelegate.RemoveDynamic(this, &UAnimalHerdSubsystem::OnNavigationGenerationFinished);
+	}
+
+	Super::Deinitialize();
+}
+
+bool UAnimalHerdSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// ゲームワールドでのみ作成
+	if (const UWorld* World = Cast<UWorld>(Outer))
+	{
+		return World->IsGameWorld();
+	}
+	return false;
+}
+
+void UAnimalHerdSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// 実行時に生成されるナビメッシュは生成完了時に作成
+	if (UNavigationSystemV1* NavSystem = FNavigationSystem::GetCurrent<UNavigationSystemV1>(&InWorld))
+	{
+		NavSystem->OnNavigationGenerationFinishedDelegate.AddUniqueDynamic(this, &UAnimalHerdSubsystem::OnNavigationGenerationFinished);
+	}
+
+	// 静的ナビメッシュはこの時点でロード済み（なければTickで間隔を空けて再試行）
+	NavSampleRetryCount = 0;
+	NavSampleRetryTimer = NavSampleRetryInterval;
+	RebuildNavSamples();
+}
+
+TStatId UAnimalHerdSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAnimalHerdSubsystem, STATGROUP_Tickables);
+}
+
+// ========================================================================
+// 更新
+// ========================================================================
+
+void UAnimalHerdSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (Animals.Num() == 0)
+	{
+		return;
+	}
+
+	if (!bNavSamplesBuilt && NavSampleRetryCount < MaxNavSampleRetries)
+	{
+		NavSampleRetryTimer -= DeltaTime;
+		if (NavSampleRetryTimer <= 0.0f)
+		{
+			++NavSampleRetryCount;
+			NavSampleRetryTimer = NavSampleRetryInterval * (1 << NavSampleRetryCount);
+			RebuildNavSamples();
+
+			if (!bNavSamplesBuilt && NavSampleRetryCount >= MaxNavSampleRetries)
+			{
+				UE_LOG(LogDawnlight, Warning, TEXT("[AnimalHerdSubsystem] ナビメッシュが見つからないため再試行を停止（生成完了時に作成）"));
+			}
+		}
+	}
+
+	DAWNLIGHT_SCOPE_CYCLE_COUNTER(STAT_DawnlightAnimalHerdTick);
+
+	const APawn* Player = PlayerContext ? PlayerContext->GetPlayerPawn() : nullptr;
+
+	GatherAnimalData(DeltaTime);
+	ComputeSteering(Player ? Player->GetActorLocation() : FVector::ZeroVector, Player != nullptr);
+	ApplySteering();
+}
+
+void UAnimalHerdSubsystem::GatherAnimalData(float DeltaTime)
+{
+	// 外部で破棄された動物・書き戻し中に登録解除された動物を後ろから削除
+	for (int32 i = Animals.Num() - 1; i >= 0; --i)
+	{
+		if (!Animals[i].IsValid())
+		{
+			RemoveAtSwap(i);
+		}
+	}
+
+	for (int32 i = 0; i < Animals.Num(); ++i)
+	{
+		const AAnimalCharacter* Animal = Animals[i].Get();
+		Locations[i] = Animal->GetActorLocation();
+
+		// スタン等はBlueprint側から設定される可能性があるためアクターの状態を優先
+		States[i] = Animal->BehaviorState;
+
+		// 重要度の低い動物はコントローラーのTick間隔ごとにだけステアリングを更新
+		SteeringTimers[i] -= DeltaTime;
+		SteeringDue[i] = SteeringTimers[i] <= 0.0f;
+		if (SteeringDue[i])
+		{
+			const AController* Controller = Animal->GetController();
+			SteeringTimers[i] = Controller ? Controller->GetActorTickInterval() : 0.0f;
+		}
+
+		// 徘徊先の更新（逃走中・死亡中は据え置き）
+		if (States[i] == EAnimalBehaviorState::Fleeing || States[i] == EAnimalBehaviorState::Dead)
+		{
+			continue;
+		}
+
+		WanderTimers[i] -= DeltaTime;
+		if (WanderTimers[i] <= 0.0f)
+		{
+			WanderTargets[i] = PickWanderTarget(i);
+			WanderTimers[i] = WanderIntervals[i];
+		}
+	}
+}
+
+void UAnimalHerdSubsystem::ComputeSteering(const FVector& PlayerLocation, bool bHasPlayer)
+{
+	const int32 Count = Animals.Num();
+	const float SeparationRadiusSq = FMath::Square(SeparationRadius);
+	const float CohesionRadiusSq = FMath::Square(CohesionRadius);
+	const float NeighborRadius = FMath::Max(SeparationRadius, CohesionRadius);
+
+	// 近傍は空間グリッドから取得（グリッドがない場合は総当たり）
+	const USpatialGridSubsystem* SpatialGrid = GetWorld()->GetSubsystem<USpatialGridSubsystem>();
+	const FDawnlightSpatialGrid* NeighborGrid = SpatialGrid ? &SpatialGrid->GetGrid() : nullptr;
+
+	ParallelFor(Count, [this, Count, &PlayerLocation, bHasPlayer, SeparationRadiusSq, CohesionRadiusSq, NeighborRadius, NeighborGrid](int32 Index)
+	{
+		const FVector Location = Locations[Index];
+		const float DistanceToPlayerSq = bHasPlayer ? FVector::DistSquared(Location, PlayerLocation) : MAX_FLT;
+
+		const EAnimalBehaviorState PreviousState = States[Index];
+		const EAnimalBehaviorState NewState = AAnimalCharacter::EvaluateBehaviorState(
+			PreviousState, DistanceToPlayerSq, FleeRadiiSq[Index], DetectionRadiiSq[Index]);
+		States[Index] = NewState;
+
+		// 状態が変わった場合は間隔を待たずに更新（逃走の開始を遅らせない）
+		if (NewState != PreviousState)
+		{
+			SteeringDue[Index] = true;
+		}
+
+		if (!SteeringDue[Index])
+		{
+			return;
+		}
+
+		if (NewState != EAnimalBehaviorState::Wandering && NewState != EAnimalBehaviorState::Fleeing)
+		{
+			MoveDestinations[Index] = Location;
+			return;
+		}
+
+		// 目的の方向（逃走: ナビ上の逃走先、徘徊: 徘徊先）
+		FVector Desired = FVector::ZeroVector;
+		if (NewState == EAnimalBehaviorState::Fleeing)
+		{
+			FVector Away = Location - PlayerLocation;
+			Away.Z = 0.0f;
+			Away = Away.GetSafeNormal();
+
+			FleeDestinations[Index] = FindNavSample(Location + Away * FleeDistance);
+
+			Desired = (FleeDestinations[Index] - Location).GetSafeNormal2D();
+			if (Desired.IsNearlyZero())
+			{
+				Desired = Away;
+			}
+		}
+		else
+		{
+			FVector ToTarget = WanderTargets[Index] - Location;
+			ToTarget.Z = 0.0f;
+			if (ToTarget.SizeSquared() > FMath::Square(WanderArrivalDistance))
+			{
+				Desired = ToTarget.GetSafeNormal();
+			}
+		}
+
+		// 分離（全動物）と結束（同じ群れ、徘徊中のみ）
+		FVector Separation = FVector::ZeroVector;
+		FVector CohesionCenter = FVector::ZeroVector;
+		int32 CohesionCount = 0;
+		const bool bApplyCohesion = NewState == EAnimalBehaviorState::Wandering && CohesionWeight > 0.0f;
+
+		auto AccumulateNeighbor = [&](int32 Other)
+		{
+			if (Other == Index)
+			{
+				return;
+			}
+
+			FVector Offset = Location - Locations[Other];
+			Offset.Z = 0.0f;
+			const float DistanceSq = Offset.SizeSquared();
+
+			if (DistanceSq < SeparationRadiusSq && DistanceSq > KINDA_SMALL_NUMBER)
+			{
+				// 近いほど強く離れる
+				const float Distance = FMath::Sqrt(DistanceSq);
+				Separation += (Offset / Distance) * (1.0f - Distance / SeparationRadius);
+			}
+
+			if (bApplyCohesion && DistanceSq < CohesionRadiusSq && HerdKeys[Other] == HerdKeys[Index])
+			{
+				CohesionCenter += Locations[Other];
+				++CohesionCount;
+			}
+		};
+
+		if (NeighborGrid)
+		{
+			// 候補の選別のみグリッドを使い、距離は今フレームに収集した位置で判定（出力配列を確保しない）
+			NeighborGrid->ForEachInRadius(Location, NeighborRadius, static_cast<uint8>(EDawnlightSpatialCategory::Animal), [&](AActor* Neighbor)
+			{
+				if (const int32* Other = IndexByAnimal.Find(Cast<AAnimalCharacter>(Neighbor)))
+				{
+					AccumulateNeighbor(*Other);
+				}
+			});
+		}
+		else
+		{
+			for (int32 Other = 0; Other < Count; ++Other)
+			{
+				AccumulateNeighbor(Other);
+			}
+		}
+
+		FVector Steering = Desired + Separation * SeparationWeight;
+		if (CohesionCount > 0)
+		{
+			// 群れの中心から離れているほど強く寄る
+			FVector ToCenter = CohesionCenter / CohesionCount - Location;
+			ToCenter.Z = 0.0f;
+			Steering += ToCenter.GetClampedToMaxSize(CohesionRadius) / CohesionRadius * CohesionWeight;
+		}
+
+		// ステアリング方向の先をナビのサンプル点に寄せて移動先とする（経路探索はMoveToが行う）
+		const FVector Goal = NewState == EAnimalBehaviorState::Fleeing ? FleeDestinations[Index] : WanderTargets[Index];
+		const float GoalDistance = FVector::Dist2D(Location, Goal);
+		const FVector SteeringDirection = Steering.GetSafeNormal2D();
+
+		MoveDestinations[Index] = (SteeringDirection.IsNearlyZero() || GoalDistance <= SteeringMinLookAhead)
+			? Goal
+			: FindNavSample(Location + SteeringDirection * GoalDistance);
+	}, Count < ParallelUpdateThreshold);
+}
+
+void UAnimalHerdSubsystem::ApplySteering()
+{
+	// 状態変更のイベントで登録解除が走る可能性があるため、件数は開始時点で固定
+	const int32 Count = Animals.Num();
+
+	for (int32 i = 0; i < Count; ++i)
+	{
+		// 状態が変わらず更新間隔にも達していない（重要度の低い動物）
+		if (!SteeringDue[i])
+		{
+			continue;
+		}
+
+		AAnimalCharacter* Animal = Animals[i].Get();
+		if (!Animal || !Animal->IsAlive())
+		{
+			continue;
+		}
+
+		Animal->SetBehaviorState(States[i]);
+
+		// 状態変更のイベントで登録解除された
+		if (!Animals[i].IsValid())
+		{
+			continue;
+		}
+
+		// 移動はBehavior TreeのMoveToだけが行う（ここでは移動入力を加えない）
+		if (AAnimalAIController* AIController = Animal->GetController<AAnimalAIController>())
+		{
+			AIController->ApplyHerdSteering(*Animal, MoveDestinations[i]);
+		}
+	}
+}
+
+// ========================================================================
+// 登録
+// ========================================================================
+
+void UAnimalHerdSubsystem::RegisterAnimal(AAnimalCharacter* Animal)
+{
+	if (!IsValid(Animal))
+	{
+		return;
+	}
+
+	int32 Index = INDEX_NONE;
+	if (const int32* ExistingIndex = IndexByAnimal.Find(Animal))
+	{
+		Index = *ExistingIndex;
+	}
+	else
+	{
+		Index = Animals.Add(Animal);
+		Locations.Add(Animal->GetActorLocation());
+		States.Add(Animal->BehaviorState);
+		HerdKeys.Add(nullptr);
+		HomeLocations.AddZeroed();
+		WanderTargets.AddZeroed();
+		WanderTimers.AddZeroed();
+		WanderIntervals.AddZeroed();
+		WanderRadii.AddZeroed();
+		FleeRadiiSq.AddZeroed();
+		DetectionRadiiSq.AddZeroed();
+		FleeDestinations.Add(Animal->GetActorLocation());
+		MoveDestinations.Add(Animal->GetActorLocation());
+		SteeringTimers.AddZeroed();
+		SteeringDue.Add(true);
+		IndexByAnimal.Add(Animal, Index);
+	}
+
+	WriteAnimalParams(Index, Animal);
+
+	// 最初の徘徊先（プール再利用時はスポーン位置が変わる）
+	WanderTargets[Index] = PickWanderTarget(Index);
+	WanderTimers[Index] = WanderIntervals[Index];
+	SteeringTimers[Index] = 0.0f;
+
+	// 個別Tickを止めてサブシステムでまとめて更新
+	Animal->SetActorTickEnabled(false);
+}
+
+void UAnimalHerdSubsystem::UnregisterAnimal(AAnimalCharacter* Animal)
+{
+	int32 Index = INDEX_NONE;
+	if (!IndexByAnimal.RemoveAndCopyValue(Animal, Index))
+	{
+		return;
+	}
+
+	// 配列の詰め直しは次のTickの収集時に行う（書き戻し中の解除に対応）
+	Animals[Index].Reset();
+}
+
+// ========================================================================
+// 取得
+// ========================================================================
+
+bool UAnimalHerdSubsystem::GetFleeDestination(const AAnimalCharacter* Animal, FVector& OutDestination) const
+{
+	const int32* Index = IndexByAnimal.Find(Animal);
+	if (!Index)
+	{
+		return false;
+	}
+
+	OutDestination = FleeDestinations[*Index];
+	return true;
+}
+
+bool UAnimalHerdSubsystem::GetWanderTarget(const AAnimalCharacter* Animal, FVector& OutTarget) const
+{
+	const int32* Index = IndexByAnimal.Find(Animal);
+	if (!Index)
+	{
+		return false;
+	}
+
+	OutTarget = WanderTargets[*Index];
+	return true;
+}
+
+// ========================================================================
+// ナビメッシュのサンプル点
+// ========================================================================
+
+void UAnimalHerdSubsystem::RebuildNavSamples()
+{
+	SCOPE_CYCLE_COUNTER(STAT_DawnlightAnimalHerdNavSamples);
+
+	bNavSamplesBuilt = false;
+	NavSamples.Reset();
+	NavSampleValid.Reset();
+	NavGridSizeX = 0;
+	NavGridSizeY = 0;
+
+	UNavigationSystemV1* NavSystem = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+	if (!NavSystem)
+	{
+		return;
+	}
+
+	const FBox Bounds = NavSystem->GetNavigableWorldBounds();
+	if (!Bounds.IsValid)
+	{
+		return;
+	}
+
+	// セル数が上限を超える場合は間隔を広げる
+	const FVector Size = Bounds.GetSize();
+	float Spacing = NavSampleSpacing;
+	int32 SizeX = 0;
+	int32 SizeY = 0;
+	for (;;)
+	{
+		SizeX = FMath::CeilToInt(Size.X / Spacing) + 1;
+		SizeY = FMath::CeilToInt(Size.Y / Spacing) + 1;
+		if (static_cast<int64>(SizeX) * SizeY <= MaxNavSamples)
+		{
+			break;
+		}
+		Spacing *= 1.25f;
+	}
+
+	const FVector ProjectExtent(Spacing * 0.5f, Spacing * 0.5f, Size.Z * 0.5f + 200.0f);
+	const float SampleZ = Bounds.GetCenter().Z;
+	int32 NumValid = 0;
+
+	NavSamples.SetNumUninitialized(SizeX * SizeY);
+	NavSampleValid.Init(false, SizeX * SizeY);
+
+	for (int32 Y = 0; Y < SizeY; ++Y)
+	{
+		for (int32 X = 0; X < SizeX; ++X)
+		{
+			const int32 CellIndex = Y * SizeX + X;
+			const FVector Point(Bounds.Min.X + X * Spacing, Bounds.Min.Y + Y * Spacing, SampleZ);
+
+			FNavLocation NavLocation;
+			if (NavSystem->ProjectPointToNavigation(Point, NavLocation, ProjectExtent))
+			{
+				NavSamples[CellIndex] = NavLocation.Location;
+				NavSampleValid[CellIndex] = true;
+				++NumValid;
+			}
+			else
+			{
+				NavSamples[CellIndex] = Point;
+			}
+		}
+	}
+
+	if (NumValid == 0)
+	{
+		NavSamples.Reset();
+		NavSampleValid.Reset();
+		return;
+	}
+
+	NavGridOrigin = Bounds.Min;
+	NavGridSizeX = SizeX;
+	NavGridSizeY = SizeY;
+	NavGridSpacing = Spacing;
+	bNavSamplesBuilt = true;
+
+	UE_LOG(LogDawnlight, Log, TEXT("[AnimalHerdSubsystem] ナビのサンプル点を作成: %d/%d（間隔: %.0f）"),
+		NumValid, SizeX * SizeY, Spacing);
+}
+
+void UAnimalHerdSubsystem::OnNavigationGenerationFinished(ANavigationData* NavData)
+{
+	// 作成済みのサンプル点は作り直さない（動的ナビメッシュの部分再生成のたびに全セルを投影しない）
+	if (!bNavSamplesBuilt)
+	{
+		RebuildNavSamples();
+	}
+}
+
+FVector UAnimalHerdSubsystem::FindNavSample(const FVector& Target) const
+{
+	if (NavGridSizeX == 0 || NavGridSizeY == 0)
+	{
+		return Target;
+	}
+
+	// ナビの範囲外の目標は端のセルに寄せる
+	const int32 CenterX = FMath::Clamp(FMath::RoundToInt((Target.X - NavGridOrigin.X) / NavGridSpacing), 0, NavGridSizeX - 1);
+	const int32 CenterY = FMath::Clamp(FMath::RoundToInt((Target.Y - NavGridOrigin.Y) / NavGridSpacing), 0, NavGridSizeY - 1);
+
+	int32 BestIndex = INDEX_NONE;
+	float BestDistanceSq = MAX_FLT;
+
+	// 内側のリングから探し、見つかったリングで打ち切る
+	for (int32 Ring = 0; Ring <= NavSampleSearchRings && BestIndex == INDEX_NONE; ++Ring)
+	{
+		for (int32 DY = -Ring; DY <= Ring; ++DY)
+		{
+			for (int32 DX = -Ring; DX <= Ring; ++DX)
+			{
+				if (FMath::Max(FMath::Abs(DX), FMath::Abs(DY)) != Ring)
+				{
+					continue;
+				}
+
+				const int32 X = CenterX + DX;
+				const int32 Y = CenterY + DY;
+				if (X < 0 || X >= NavGridSizeX || Y < 0 || Y >= NavGridSizeY)
+				{
+					continue;
+				}
+
+				const int32 CellIndex = Y * NavGridSizeX + X;
+				if (!NavSampleValid[CellIndex])
+				{
+					continue;
+				}
+
+				const float DistanceSq = FVector::DistSquared2D(NavSamples[CellIndex], Target);
+				if (DistanceSq < BestDistanceSq)
+				{
+					BestDistanceSq = DistanceSq;
+					BestIndex = CellIndex;
+				}
+			}
+		}
+	}
+
+	return BestIndex != INDEX_NONE ? NavSamples[BestIndex] : Target;
+}
+
+// ========================================================================
+// 内部処理
+// ========================================================================
+
+FVector UAnimalHerdSubsystem::PickWanderTarget(int32 Index)
+{
+	// スポーン位置を中心にランダムな位置を選択
+	const float RandomAngle = WanderStream.FRandRange(0.0f, 2.0f * PI);
+	const float RandomDistance = WanderStream.FRandRange(WanderRadii[Index] * 0.3f, WanderRadii[Index]);
+
+	const FVector Target = HomeLocations[Index] + FVector(
+		FMath::Cos(RandomAngle) * RandomDistance,
+		FMath::Sin(RandomAngle) * RandomDistance,
+		0.0f
+	);
+
+	return FindNavSample(Target);
+}
+
+void UAnimalHerdSubsystem::WriteAnimalParams(int32 Index, const AAnimalCharacter* Animal)
+{
+	// 同じ魂データの動物を1つの群れとする（魂データがない場合はクラス単位）
+	HerdKeys[Index] = Animal->SoulData ? static_cast<const void*>(Animal->SoulData.Get()) : static_cast<const void*>(Animal->GetClass());
+	HomeLocations[Index] = Animal->GetHomeLocation();
+	WanderIntervals[Index] = Animal->WanderInterval;
+	WanderRadii[Index] = Animal->WanderRadius;
+	FleeRadiiSq[Index] = FMath::Square(Animal->FleeRadius);
+	DetectionRadiiSq[Index] = FMath::Square(Animal->DetectionRadius);
+}
+
+void UAnimalHerdSubsystem::RemoveAtSwap(int32 Index)
+{
+	const int32 LastIndex = Animals.Num() - 1;
+
+	// 末尾の要素がこのインデックスに移動するため、対応表を更新
+	if (Index != LastIndex)
+	{
+		if (const AAnimalCharacter* MovedAnimal = Animals[LastIndex].Get())
+		{
+			IndexByAnimal.Add(MovedAnimal, Index);
+		}
+	}
+
+	Animals.RemoveAtSwap(Index, EAllowShrinking::No);
+	Locations.RemoveAtSwap(Index, EAllowShrinking::No);
+	States.RemoveAtSwap(Index, EAllowShrinking::No);
+	HerdKeys.RemoveAtSwap(Index, EAllowShrinking::No);
+	HomeLocations.RemoveAtSwap(Index, EAllowShrinking::No);
+	WanderTargets.RemoveAtSwap(Index, EAllowShrinking::No);
+	WanderTimers.RemoveAtSwap(Index, EAllowShrinking::No);
+	WanderIntervals.RemoveAtSwap(Index, EAllowShrinking::No);
+	WanderRadii.RemoveAtSwap(Index, EAllowShrinking::No);
+	FleeRadiiSq.RemoveAtSwap(Index, EAllowShrinking::No);
+	DetectionRadiiSq.RemoveAtSwap(Index, EAllowShrinking::No);
+	FleeDestinations.RemoveAtSwap(Index, EAllowShrinking::No);
+	MoveDestinations.RemoveAtSwap(Index, EAllowShrinking::No);
+	SteeringTimers.RemoveAtSwap(Index, EAllowShrinking::No);
+	SteeringDue.RemoveAtSwap(Index, EAllowShrinking::No);
+}
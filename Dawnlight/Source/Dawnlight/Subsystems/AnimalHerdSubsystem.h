@@ -0,0 +1,242 @@
+// Soul Reaper - Dawnlight Project
+// Copyright (c) 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "Math/RandomStream.h"
+#include "Characters/AnimalCharacter.h"
+#include "AnimalHerdSubsystem.generated.h"
+
+class UPlayerContextSubsystem;
+class ANavigationData;
+
+/**
+ * 動物の群れシミュレーションサブシステム
+ *
+ * 登録された動物の徘徊・逃走をStructure of Arraysで保持し、1回のTickでまとめて更新する
+ * - 動物ごとのアクターTick・徘徊タイマーを無効化（AAnimalCharacter::Tick の置き換え）
+ * - 逃走先・徘徊先はナビメッシュに投影済みのサンプル点から選ぶ（毎フレームの ProjectPointToNavigation なし）
+ * - 分離（全動物）と結束（同じ種類の群れ）のステアリングを加算（近傍は USpatialGridSubsystem から取得）
+ * - 移動はBehavior TreeのMoveToに任せ、ここではステアリング後の移動先をAIコントローラーのBlackboardへ書き込むだけ
+ * - ステアリングの計算と書き込みはコントローラーのTick間隔（UDawnlightAISignificanceManager のバケット）ごと
+ */
+UCLASS()
+class DAWNLIGHT_API UAnimalHerdSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+	friend class FDawnlightBenchmarkDeterminismTest;
+
+public:
+	// ========================================================================
+	// UWorldSubsystem インターフェース
+	// ========================================================================
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	// ========================================================================
+	// FTickableGameObject インターフェース
+	// ========================================================================
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// ========================================================================
+	// 登録
+	// ========================================================================
+
+	/**
+	 * 動物を登録（アクターTickを無効化）
+	 * 登録済みの場合はAI設定（逃走距離等）を再取得する
+	 */
+	void RegisterAnimal(AAnimalCharacter* Animal);
+
+	/** 動物の登録を解除 */
+	void UnregisterAnimal(AAnimalCharacter* Animal);
+
+	/** 登録済みかどうか */
+	bool IsAnimalRegistered(const AAnimalCharacter* Animal) const { return IndexByAnimal.Contains(Animal); }
+
+	/** 登録中の動物数 */
+	UFUNCTION(BlueprintPure, Category = "動物の群れ")
+	int32 GetRegisteredAnimalCount() const { return Animals.Num(); }
+
+	// ========================================================================
+	// 取得（AIコントローラー用）
+	// ========================================================================
+
+	/**
+	 * 直近の更新で計算した逃走先
+	 * @return 登録されていなければ false
+	 */
+	bool GetFleeDestination(const AAnimalCharacter* Animal, FVector& OutDestination) const;
+
+	/**
+	 * 現在の徘徊先
+	 * @return 登録されていなければ false
+	 */
+	bool GetWanderTarget(const AAnimalCharacter* Animal, FVector& OutTarget) const;
+
+	/** 徘徊先の乱数のシードを固定（ベンチマーク用、通常は起動ごとに変わる） */
+	void SetRandomSeed(int32 InSeed) { WanderStream.Initialize(InSeed); }
+
+	/** ナビメッシュのサンプル点を作り直す（ナビメッシュ再ビルド後など） */
+	UFUNCTION(BlueprintCallable, Category = "動物の群れ")
+	void RebuildNavSamples();
+
+	// ========================================================================
+	// 設定
+	// ========================================================================
+
+	/** この数以上の動物がいる場合にParallelForでステアリングを計算 */
+	UPROPERTY(EditAnywhere, Category = "動物の群れ", meta = (ClampMin = "1"))
+	int32 ParallelUpdateThreshold = 64;
+
+	/** 逃走先（現在地からの距離） */
+	UPROPERTY(EditAnywhere, Category = "動物の群れ|逃走", meta = (ClampMin = "100"))
+	float FleeDistance = 800.0f;
+
+	/** 分離の半径（これより近い動物から離れる） */
+	UPROPERTY(EditAnywhere, Category = "動物の群れ|ステアリング", meta = (ClampMin = "0"))
+	float SeparationRadius = 150.0f;
+
+	/** 分離の重み */
+	UPROPERTY(EditAnywhere, Category = "動物の群れ|ステアリング", meta = (ClampMin = "0"))
+	float SeparationWeight = 1.5f;
+
+	/** 結束の半径（この範囲の同じ種類の動物の中心に寄る） */
+	UPROPERTY(EditAnywhere, Category = "動物の群れ|ステアリング", meta = (ClampMin = "0"))
+	float CohesionRadius = 600.0f;
+
+	/** 結束の重み（徘徊中のみ） */
+	UPROPERTY(EditAnywhere, Category = "動物の群れ|ステアリング", meta = (ClampMin = "0"))
+	float CohesionWeight = 0.3f;
+
+	/** ナビメッシュのサンプル点の間隔 */
+	UPROPERTY(EditAnywhere, Category = "動物の群れ|ナビ", meta = (ClampMin = "50"))
+	float NavSampleSpacing = 300.0f;
+
+	/** サンプル点の最大数（ナビの範囲が広い場合は間隔を広げる） */
+	UPROPERTY(EditAnywhere, Category = "動物の群れ|ナビ", meta = (ClampMin = "1"))
+	int32 MaxNavSamples = 16384;
+
+private:
+	// ========================================================================
+	// 群れデータ（Structure of Arrays、全て同じインデックスで対応）
+	// ========================================================================
+
+	/** 動物アクター */
+	TArray<TWeakObjectPtr<AAnimalCharacter>> Animals;
+
+	/** 今フレームの位置 */
+	TArray<FVector> Locations;
+
+	/** 行動状態 */
+	TArray<EAnimalBehaviorState> States;
+
+	/** 群れのキー（同じ魂データの動物が1つの群れ） */
+	TArray<const void*> HerdKeys;
+
+	/** 徘徊の中心 */
+	TArray<FVector> HomeLocations;
+
+	/** 徘徊先 */
+	TArray<FVector> WanderTargets;
+
+	/** 次の徘徊先までの残り時間 */
+	TArray<float> WanderTimers;
+
+	/** 徘徊の目的地変更間隔 */
+	TArray<float> WanderIntervals;
+
+	/** 徘徊範囲 */
+	TArray<float> WanderRadii;
+
+	/** 逃走を開始する距離の2乗 */
+	TArray<float> FleeRadiiSq;
+
+	/** 徘徊に戻る距離の2乗 */
+	TArray<float> DetectionRadiiSq;
+
+	/** 計算結果: 逃走先 */
+	TArray<FVector> FleeDestinations;
+
+	/** 計算結果: ステアリングを反映した移動先（Blackboardへ書き込む） */
+	TArray<FVector> MoveDestinations;
+
+	/** 次のステアリング更新までの残り時間（コントローラーのTick間隔で再設定） */
+	TArray<float> SteeringTimers;
+
+	/** 今フレームにステアリングを計算・書き込むか（ParallelForから書き込むため bool の配列） */
+	TArray<bool> SteeringDue;
+
+	/** 動物 → インデックス */
+	TMap<TObjectKey<AAnimalCharacter>, int32> IndexByAnimal;
+
+	// ========================================================================
+	// ナビメッシュのサンプル点（均一グリッド、セルごとに投影済みの点）
+	// ========================================================================
+
+	/** セルごとの投影済みの点（投影できなかったセルは無効） */
+	TArray<FVector> NavSamples;
+
+	/** セルごとに投影できたか */
+	TBitArray<> NavSampleValid;
+
+	/** グリッドの原点・セル数・間隔 */
+	FVector NavGridOrigin = FVector::ZeroVector;
+	int32 NavGridSizeX = 0;
+	int32 NavGridSizeY = 0;
+	float NavGridSpacing = 0.0f;
+
+	/** サンプル点を作成済みか（ナビメッシュがなければ間隔を倍にしながら再試行） */
+	bool bNavSamplesBuilt = false;
+	float NavSampleRetryTimer = 0.0f;
+	int32 NavSampleRetryCount = 0;
+
+	/** 徘徊先の乱数 */
+	FRandomStream WanderStream;
+
+	/** プレイヤーの参照先 */
+	UPROPERTY()
+	TObjectPtr<UPlayerContextSubsystem> PlayerContext;
+
+	// ========================================================================
+	// 内部処理
+	// ========================================================================
+
+	/** ナビメッシュの生成完了時（サンプル点がまだなければ作成） */
+	UFUNCTION()
+	void OnNavigationGenerationFinished(ANavigationData* NavData);
+
+	/** 動物のAI設定を配列に書き込む */
+	void WriteAnimalParams(int32 Index, const AAnimalCharacter* Animal);
+
+	/** インデックスの要素を末尾と入れ替えて削除 */
+	void RemoveAtSwap(int32 Index);
+
+	/** アクターから位置・状態を収集し、徘徊先を更新（無効な動物は削除） */
+	void GatherAnimalData(float DeltaTime);
+
+	/** 状態遷移・逃走先・移動先を計算 */
+	void ComputeSteering(const FVector& PlayerLocation, bool bHasPlayer);
+
+	/** 計算結果をキャラクターとAIコントローラーに書き戻す */
+	void ApplySteering();
+
+	/** 新しい徘徊先を選ぶ */
+	FVector PickWanderTarget(int32 Index);
+
+	/**
+	 * 目標地点に最も近いナビメッシュ上のサンプル点
+	 * スレッドセーフ（読み取りのみ）
+	 * @return サンプル点がない場合は目標地点をそのまま返す
+	 */
+	FVector FindNavSample(const FVector& Target) const;
+};
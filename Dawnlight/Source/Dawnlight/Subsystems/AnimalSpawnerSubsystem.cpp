@@ -5,6 +5,10 @@
 #include "Dawnlight.h"
 #include "Data/SoulDataAsset.h"
 #include "Characters/AnimalCharacter.h"
+#include "Subsystems/ActorPoolSubsystem.h"
+#include "Subsystems/DawnlightAssetPreloader.h"
+#include "Subsystems/SpawnSchedulerSubsystem.h"
+#include "Subsystems/SpatialGridSubsystem.h"
 #include "Engine/World.h"
 
 void UAnimalSpawnerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
@@ -44,7 +48,8 @@ void UAnimalSpawnerSubsystem::SpawnAllAnimals()
 		return;
 	}
 
-	// 各設定に基づいてスポーン
+	// 各設定に基づいてスポーンを要求（カスタムクラスはSpawnAnimal内で処理）
+	int32 RequestedCount = 0;
 	for (const FAnimalSpawnConfig& Config : SpawnConfigs)
 	{
 		if (!Config.SoulData)
@@ -55,18 +60,24 @@ void UAnimalSpawnerSubsystem::SpawnAllAnimals()
 
 		for (int32 i = 0; i < Config.SpawnCount; ++i)
 		{
-			const FVector SpawnLocation = GetRandomSpawnLocation();
-			AAnimalCharacter* Animal = SpawnAnimal(Config.SoulData, SpawnLocation);
-
-			// カスタムクラスが指定されていれば使用
-			if (Animal && Config.CustomAnimalClass)
-			{
-				// カスタムクラスは既にSpawnAnimal内で処理済み
-			}
+			RequestAnimalSpawn(Config.SoulData);
+			++RequestedCount;
 		}
 	}
 
-	UE_LOG(LogDawnlight, Log, TEXT("[AnimalSpawnerSubsystem] 全動物スポーン完了: %d体"), TotalSpawnedCount);
+	UE_LOG(LogDawnlight, Log, TEXT("[AnimalSpawnerSubsystem] 全動物スポーン要求: %d体"), RequestedCount);
+}
+
+void UAnimalSpawnerSubsystem::RequestAnimalSpawn(USoulDataAsset* SoulData)
+{
+	TWeakObjectPtr<USoulDataAsset> WeakSoulData = SoulData;
+	USpawnSchedulerSubsystem::EnqueueSpawnInWorld(GetWorld(), ESpawnPriority::Animal, this, [this, WeakSoulData]()
+	{
+		if (USoulDataAsset* Data = WeakSoulData.Get())
+		{
+			SpawnAnimal(Data, GetRandomSpawnLocation());
+		}
+	});
 }
 
 AAnimalCharacter* UAnimalSpawnerSubsystem::SpawnAnimal(USoulDataAsset* SoulData, const FVector& Location)
@@ -97,9 +108,9 @@ AAnimalCharacter* UAnimalSpawnerSubsystem::SpawnAnimal(USoulDataAsset* SoulData,
 	}
 
 	// SoulDataからBlueprintクラスを取得
-	if (!AnimalClass && SoulData->AnimalBlueprintClass.IsValid())
+	if (!AnimalClass && !SoulData->AnimalBlueprintClass.IsNull())
 	{
-		AnimalClass = SoulData->AnimalBlueprintClass.LoadSynchronous();
+		AnimalClass = UDawnlightAssetPreloader::ResolveClass(this, SoulData->AnimalBlueprintClass, TEXT("AnimalSpawner"));
 	}
 
 	// デフォルトのAnimalCharacterを使用
@@ -108,24 +119,27 @@ AAnimalCharacter* UAnimalSpawnerSubsystem::SpawnAnimal(USoulDataAsset* SoulData,
 		AnimalClass = AAnimalCharacter::StaticClass();
 	}
 
-	// スポーン
-	FActorSpawnParameters SpawnParams;
-	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+	// プールから取得（空の場合は新規スポーン）
+	UActorPoolSubsystem* Pool = World->GetSubsystem<UActorPoolSubsystem>();
+	if (!Pool)
+	{
+		return nullptr;
+	}
 
-	AAnimalCharacter* NewAnimal = World->SpawnActor<AAnimalCharacter>(
+	AAnimalCharacter* NewAnimal = Pool->AcquireActor<AAnimalCharacter>(
 		AnimalClass,
-		Location,
-		FRotator::ZeroRotator,
-		SpawnParams
+		FTransform(FRotator::ZeroRotator, Location),
+		[SoulData](AAnimalCharacter* Animal)
+		{
+			// BeginPlay/プール取得時の初期化で使用されるため先に設定
+			Animal->SoulData = SoulData;
+		}
 	);
 
 	if (NewAnimal)
 	{
-		// SoulDataを設定
-		NewAnimal->SoulData = SoulData;
-
-		// 追跡リストに追加
-		AliveAnimals.Add(NewAnimal);
+		// 追跡リストに追加（再利用されたアクターは既に含まれている場合がある）
+		AliveAnimals.AddUnique(NewAnimal);
 		TotalSpawnedCount++;
 
 		UE_LOG(LogDawnlight, Log, TEXT("[AnimalSpawnerSubsystem] 動物スポーン: %s (%d体目)"),
@@ -140,12 +154,21 @@ AAnimalCharacter* UAnimalSpawnerSubsystem::SpawnAnimal(USoulDataAsset* SoulData,
 
 void UAnimalSpawnerSubsystem::DespawnAllAnimals()
 {
-	// 生存中の動物を全て削除
+	// 待機中のスポーン要求を破棄
+	if (UWorld* World = GetWorld())
+	{
+		if (USpawnSchedulerSubsystem* Scheduler = World->GetSubsystem<USpawnSchedulerSubsystem>())
+		{
+			Scheduler->CancelSpawns(this);
+		}
+	}
+
+	// 生存中の動物を全てプールに返却
 	for (const TWeakObjectPtr<AAnimalCharacter>& Animal : AliveAnimals)
 	{
 		if (Animal.IsValid())
 		{
-			Animal->Destroy();
+			Animal->ReturnToPool();
 		}
 	}
 	AliveAnimals.Empty();
@@ -181,11 +204,10 @@ bool UAnimalSpawnerSubsystem::SpawnRandomAnimal()
 	const int32 RandomIndex = FMath::RandRange(0, ValidConfigs.Num() - 1);
 	const FAnimalSpawnConfig* SelectedConfig = ValidConfigs[RandomIndex];
 
-	// ランダムな位置にスポーン
-	const FVector SpawnLocation = GetRandomSpawnLocation();
-	AAnimalCharacter* SpawnedAnimal = SpawnAnimal(SelectedConfig->SoulData, SpawnLocation);
+	// ランダムな位置へのスポーンを要求
+	RequestAnimalSpawn(SelectedConfig->SoulData);
 
-	return SpawnedAnimal != nullptr;
+	return true;
 }
 
 void UAnimalSpawnerSubsystem::AddSpawnPoint(const FVector& Location)
@@ -243,6 +265,41 @@ TArray<AAnimalCharacter*> UAnimalSpawnerSubsystem::GetAliveAnimals() const
 	return Result;
 }
 
+TArray<AAnimalCharacter*> UAnimalSpawnerSubsystem::GetAliveAnimalsInRadius(FVector Center, float Radius) const
+{
+	TArray<AAnimalCharacter*> Result;
+
+	const USpatialGridSubsystem* SpatialGrid = GetWorld() ? GetWorld()->GetSubsystem<USpatialGridSubsystem>() : nullptr;
+	if (!SpatialGrid)
+	{
+		// 空間グリッドがない場合は線形探索
+		const float RadiusSq = FMath::Square(Radius);
+		for (AAnimalCharacter* Animal : GetAliveAnimals())
+		{
+			if (FVector::DistSquared(Center, Animal->GetActorLocation()) <= RadiusSq)
+			{
+				Result.Add(Animal);
+			}
+		}
+		return Result;
+	}
+
+	TArray<AActor*> NearbyActors;
+	SpatialGrid->GetGrid().QueryRadius(Center, Radius, static_cast<uint8>(EDawnlightSpatialCategory::Animal), NearbyActors);
+
+	Result.Reserve(NearbyActors.Num());
+	for (AActor* Actor : NearbyActors)
+	{
+		AAnimalCharacter* Animal = Cast<AAnimalCharacter>(Actor);
+		if (Animal && Animal->IsAlive())
+		{
+			Result.Add(Animal);
+		}
+	}
+
+	return Result;
+}
+
 FVector UAnimalSpawnerSubsystem::GetRandomSpawnLocation() const
 {
 	// スポーンポイントがあればそこからランダム選択
@@ -52,6 +52,8 @@ class DAWNLIGHT_API UAnimalSpawnerSubsystem : public UWorldSubsystem
 {
 	GENERATED_BODY()
 
+	friend class FDawnlightBenchmarkDeterminismTest;
+
 public:
 	// ========================================================================
 	// UWorldSubsystem インターフェース
@@ -69,11 +71,11 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "動物スポーン")
 	void InitializeAnimalSpawner(const TArray<FAnimalSpawnConfig>& InSpawnConfigs);
 
-	/** 全ての動物をスポーン */
+	/** 全ての動物のスポーンを要求（スポーンスケジューラーで数フレームに分けて実行） */
 	UFUNCTION(BlueprintCallable, Category = "動物スポーン")
 	void SpawnAllAnimals();
 
-	/** 指定された動物をスポーン */
+	/** 指定された動物を即座にスポーン */
 	UFUNCTION(BlueprintCallable, Category = "動物スポーン")
 	AAnimalCharacter* SpawnAnimal(USoulDataAsset* SoulData, const FVector& Location);
 
@@ -82,8 +84,8 @@ public:
 	void DespawnAllAnimals();
 
 	/**
-	 * ランダムな動物を1体スポーン
-	 * @return スポーン成功時 true
+	 * ランダムな動物を1体スポーン要求（スポーンスケジューラーで実行）
+	 * @return 要求を受け付けた場合 true
 	 * @note SpawnConfigsが設定されている必要があります
 	 */
 	UFUNCTION(BlueprintCallable, Category = "動物スポーン")
@@ -129,6 +131,13 @@ public:
 	UFUNCTION(BlueprintPure, Category = "動物スポーン")
 	TArray<AAnimalCharacter*> GetAliveAnimals() const;
 
+	/** 半径内の生存中の動物リストを取得（空間グリッドがあれば全件走査しない） */
+	UFUNCTION(BlueprintCallable, Category = "動物スポーン")
+	TArray<AAnimalCharacter*> GetAliveAnimalsInRadius(FVector Center, float Radius) const;
+
+	/** スポーン設定リストを取得 */
+	const TArray<FAnimalSpawnConfig>& GetSpawnConfigs() const { return SpawnConfigs; }
+
 	// ========================================================================
 	// イベント
 	// ========================================================================
@@ -183,6 +192,9 @@ protected:
 	/** スポーン位置を取得（ランダム） */
 	FVector GetRandomSpawnLocation() const;
 
+	/** 動物のスポーンをスケジューラーに要求（位置は実行時に決める） */
+	void RequestAnimalSpawn(USoulDataAsset* SoulData);
+
 	/** 動物が倒された時の処理 */
 	void OnAnimalDied(AAnimalCharacter* Animal);
 
@@ -0,0 +1,254 @@
+// Soul Reaper - Dawnlight Project
+// Copyright (c) 2025. All Rights Reserved.
+
+#include "DamagePipelineSubsystem.h"
+#include "Dawnlight.h"
+#include "DawnlightTags.h"
+#include "Abilities/DawnlightAttributeSet.h"
+#include "Abilities/SoulBuffGameplayEffect.h"
+#include "Characters/EnemyCharacter.h"
+#include "Characters/AnimalCharacter.h"
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemBlueprintLibrary.h"
+#include "Engine/DamageEvents.h"
+#include "Engine/World.h"
+#include "GameFramework/Character.h"
+
+void UDamagePipelineSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	UE_LOG(LogDawnlight, Log, TEXT("[DamagePipelineSubsystem] 初期化完了"));
+}
+
+void UDamagePipelineSubsystem::Deinitialize()
+{
+	PendingTargets.Empty();
+	PendingIndices.Empty();
+	ResolvingTargets.Empty();
+	OnDamageResolved.Clear();
+
+	Super::Deinitialize();
+}
+
+bool UDamagePipelineSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// ゲームワールドでのみ作成
+	if (const UWorld* World = Cast<UWorld>(Outer))
+	{
+		return World->IsGameWorld();
+	}
+	return false;
+}
+
+TStatId UDamagePipelineSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UDamagePipelineSubsystem, STATGROUP_Tickables);
+}
+
+void UDamagePipelineSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	FlushPendingDamage();
+}
+
+// ========================================================================
+// ダメージ
+// ========================================================================
+
+void UDamagePipelineSubsystem::QueueDamage(const FDawnlightDamageRequest& Request)
+{
+	AActor* Target = Request.Target.Get();
+	if (!Target || Request.Amount <= 0.0f)
+	{
+		return;
+	}
+
+	// 攻撃者が適用前に破棄されても良いよう、倍率はキューに積む時点で確定する
+	const float Amount = ComputeSourceDamage(Request);
+
+	FPendingDamage* Pending = nullptr;
+	if (const int32* Index = PendingIndices.Find(Target))
+	{
+		Pending = &PendingTargets[*Index];
+		++CoalescedCount;
+	}
+	else
+	{
+		PendingIndices.Add(Target, PendingTargets.Num());
+		Pending = &PendingTargets.AddDefaulted_GetRef();
+		Pending->Target = Target;
+		Pending->Source = Request.Source;
+	}
+
+	Pending->Amount += Amount;
+	Pending->HitCount++;
+	Pending->Tags.AppendTags(Request.Tags);
+
+	if (Request.KnockbackForce > Pending->KnockbackForce)
+	{
+		Pending->KnockbackDirection = Request.KnockbackDirection;
+		Pending->KnockbackForce = Request.KnockbackForce;
+	}
+}
+
+void UDamagePipelineSubsystem::QueueDamageInWorld(const FDawnlightDamageRequest& Request)
+{
+	AActor* Target = Request.Target.Get();
+	if (!Target)
+	{
+		return;
+	}
+
+	if (UWorld* World = Target->GetWorld())
+	{
+		if (UDamagePipelineSubsystem* Pipeline = World->GetSubsystem<UDamagePipelineSubsystem>())
+		{
+			Pipeline->QueueDamage(Request);
+			return;
+		}
+	}
+
+	// サブシステムがない場合はダメージを失わないよう即座に適用
+	if (Request.Amount <= 0.0f)
+	{
+		return;
+	}
+
+	FPendingDamage Pending;
+	Pending.Target = Target;
+	Pending.Source = Request.Source;
+	Pending.Amount = ComputeSourceDamage(Request);
+	Pending.HitCount = 1;
+	Pending.Tags = Request.Tags;
+	Pending.KnockbackDirection = Request.KnockbackDirection;
+	Pending.KnockbackForce = Request.KnockbackForce;
+	ApplyPendingDamage(Pending);
+}
+
+void UDamagePipelineSubsystem::FlushPendingDamage()
+{
+	if (PendingTargets.Num() == 0)
+	{
+		return;
+	}
+
+	// 適用中（死亡処理など）に積まれたダメージは次のフレームに回す
+	Swap(ResolvingTargets, PendingTargets);
+	PendingIndices.Reset();
+
+	for (const FPendingDamage& Pending : ResolvingTargets)
+	{
+		AActor* Target = Pending.Target.Get();
+		if (!Target)
+		{
+			continue;
+		}
+
+		const bool bAppliedThroughGAS = ApplyPendingDamage(Pending);
+		++ResolvedCount;
+
+		if (OnDamageResolved.IsBound())
+		{
+			FDawnlightResolvedDamage Resolved;
+			Resolved.Target = Target;
+			Resolved.Source = Pending.Source.Get();
+			Resolved.Amount = Pending.Amount;
+			Resolved.HitCount = Pending.HitCount;
+			Resolved.Tags = Pending.Tags;
+			Resolved.bAppliedThroughGAS = bAppliedThroughGAS;
+			OnDamageResolved.Broadcast(Resolved);
+		}
+	}
+
+	ResolvingTargets.Reset();
+}
+
+float UDamagePipelineSubsystem::ComputeSourceDamage(const FDawnlightDamageRequest& Request)
+{
+	float Damage = Request.Amount;
+
+	if (!Request.bApplySourceMultiplier)
+	{
+		return Damage;
+	}
+
+	// 攻撃者のダメージ倍率を取得（GAS）
+	if (UAbilitySystemComponent* SourceASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(Request.Source.Get()))
+	{
+		bool bFound = false;
+		const float SourceDamageMultiplier = SourceASC->GetGameplayAttributeValue(
+			UDawnlightAttributeSet::GetDamageMultiplierAttribute(),
+			bFound
+		);
+
+		if (bFound && SourceDamageMultiplier > 0.0f)
+		{
+			Damage *= SourceDamageMultiplier;
+		}
+	}
+
+	return Damage;
+}
+
+bool UDamagePipelineSubsystem::ApplyPendingDamage(const FPendingDamage& Pending)
+{
+	AActor* Target = Pending.Target.Get();
+	if (!Target)
+	{
+		return false;
+	}
+
+	AActor* Source = Pending.Source.Get();
+	bool bAppliedThroughGAS = false;
+
+	// ターゲットにダメージを適用（GAS経由、防御力と死亡判定は AttributeSet / キャラクター側で処理）
+	UAbilitySystemComponent* TargetASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(Target);
+	if (TargetASC && TargetASC->HasAttributeSetForAttribute(UDawnlightAttributeSet::GetIncomingDamageAttribute()))
+	{
+		FGameplayEffectContextHandle Context = TargetASC->MakeEffectContext();
+		Context.AddInstigator(Source, Source);
+
+		const FGameplayEffectSpecHandle SpecHandle = TargetASC->MakeOutgoingSpec(UDamageGameplayEffect::StaticClass(), 1.0f, Context);
+		if (SpecHandle.IsValid())
+		{
+			SpecHandle.Data->SetSetByCallerMagnitude(SoulReaperTags::Data_Damage, Pending.Amount);
+			SpecHandle.Data->AppendDynamicAssetTags(Pending.Tags);
+			TargetASC->ApplyGameplayEffectSpecToSelf(*SpecHandle.Data.Get());
+			bAppliedThroughGAS = true;
+		}
+	}
+
+	if (!bAppliedThroughGAS)
+	{
+		// GASがない場合は各キャラクターのダメージ関数を使用
+		if (AEnemyCharacter* Enemy = Cast<AEnemyCharacter>(Target))
+		{
+			Enemy->TakeDamageFromPlayer(Pending.Amount, Source);
+		}
+		else if (AAnimalCharacter* Animal = Cast<AAnimalCharacter>(Target))
+		{
+			Animal->TakeDamageFromPlayer(Pending.Amount, Source);
+		}
+		else
+		{
+			FDamageEvent DamageEvent;
+			Target->TakeDamage(Pending.Amount, DamageEvent, Source ? Source->GetInstigatorController() : nullptr, Source);
+		}
+	}
+
+	UE_LOG(LogDawnlight, Verbose, TEXT("[DamagePipelineSubsystem] %s に %.0f ダメージ（%d ヒット、%s）"),
+		*Target->GetName(), Pending.Amount, Pending.HitCount, bAppliedThroughGAS ? TEXT("GAS") : TEXT("標準"));
+
+	// ノックバック
+	if (Pending.KnockbackForce > 0.0f)
+	{
+		if (ACharacter* TargetCharacter = Cast<ACharacter>(Target))
+		{
+			TargetCharacter->LaunchCharacter(Pending.KnockbackDirection * Pending.KnockbackForce, true, true);
+		}
+	}
+
+	return bAppliedThroughGAS;
+}
@@ -0,0 +1,153 @@
+// Soul Reaper - Dawnlight Project
+// Copyright (c) 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GameplayTagContainer.h"
+#include "UObject/ObjectKey.h"
+#include "DamagePipelineSubsystem.generated.h"
+
+/**
+ * ダメージリクエスト
+ */
+struct FDawnlightDamageRequest
+{
+	/** 攻撃者 */
+	TWeakObjectPtr<AActor> Source;
+
+	/** 対象 */
+	TWeakObjectPtr<AActor> Target;
+
+	/** ダメージ量（攻撃者の DamageMultiplier 適用前） */
+	float Amount = 0.0f;
+
+	/** ダメージの種類など（Damage.Type.*） */
+	FGameplayTagContainer Tags;
+
+	/** ノックバック方向（正規化済み） */
+	FVector KnockbackDirection = FVector::ZeroVector;
+
+	/** ノックバック力（0で無し） */
+	float KnockbackForce = 0.0f;
+
+	/** 攻撃者の DamageMultiplier 属性を適用するか */
+	bool bApplySourceMultiplier = true;
+};
+
+/**
+ * 1フレーム分をまとめて適用したダメージ（ダメージ数値表示・テレメトリ用）
+ */
+struct FDawnlightResolvedDamage
+{
+	/** 対象 */
+	AActor* Target = nullptr;
+
+	/** 最初にヒットした攻撃者 */
+	AActor* Source = nullptr;
+
+	/** 合計ダメージ（防御力による軽減前） */
+	float Amount = 0.0f;
+
+	/** まとめたヒット数 */
+	int32 HitCount = 0;
+
+	/** 全ヒットのタグ */
+	FGameplayTagContainer Tags;
+
+	/** GAS 経由で適用したか */
+	bool bAppliedThroughGAS = false;
+};
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnDawnlightDamageResolved, const FDawnlightResolvedDamage&);
+
+/**
+ * ダメージパイプラインサブシステム
+ *
+ * 近接攻撃・敵の攻撃・範囲攻撃のダメージをキューに積み、1フレームに1回まとめて適用する
+ * - 同じ対象へのヒットは合算し、対象ごとに UDamageGameplayEffect のスペックを1つだけ適用
+ *   （PostGameplayEffectExecute と属性変更通知が対象ごとに1回になる）
+ * - ASC を持たない対象（敵・動物）は従来のダメージ関数に合計値を渡す
+ * - 適用後に OnDamageResolved を通知（ダメージ数値表示・テレメトリのフック）
+ */
+UCLASS()
+class DAWNLIGHT_API UDamagePipelineSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ========================================================================
+	// UWorldSubsystem インターフェース
+	// ========================================================================
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+	// ========================================================================
+	// FTickableGameObject インターフェース
+	// ========================================================================
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// ========================================================================
+	// ダメージ
+	// ========================================================================
+
+	/** ダメージをキューに積む（このフレームの終わりに適用） */
+	void QueueDamage(const FDawnlightDamageRequest& Request);
+
+	/** ダメージをキューに積む（ワールドにサブシステムがない場合は即座に適用） */
+	static void QueueDamageInWorld(const FDawnlightDamageRequest& Request);
+
+	/** キュー内のダメージを今すぐ適用 */
+	void FlushPendingDamage();
+
+	/** ダメージ待ちの対象数 */
+	int32 GetPendingTargetCount() const { return PendingTargets.Num(); }
+
+	/** 適用したスペック数（対象ごとに1） */
+	int32 GetResolvedCount() const { return ResolvedCount; }
+
+	/** 他のヒットに合算されたリクエスト数 */
+	int32 GetCoalescedCount() const { return CoalescedCount; }
+
+	/** ダメージ適用時 */
+	FOnDawnlightDamageResolved OnDamageResolved;
+
+private:
+	/** 対象ごとに合算中のダメージ */
+	struct FPendingDamage
+	{
+		TWeakObjectPtr<AActor> Target;
+		TWeakObjectPtr<AActor> Source;
+		float Amount = 0.0f;
+		int32 HitCount = 0;
+		FGameplayTagContainer Tags;
+
+		/** 最も強いノックバック */
+		FVector KnockbackDirection = FVector::ZeroVector;
+		float KnockbackForce = 0.0f;
+	};
+
+	/** ダメージ待ちの対象 */
+	TArray<FPendingDamage> PendingTargets;
+
+	/** 対象 → PendingTargets のインデックス */
+	TMap<TObjectKey<AActor>, int32> PendingIndices;
+
+	/** 適用中に使う入れ替え用の配列 */
+	TArray<FPendingDamage> ResolvingTargets;
+
+	/** 統計 */
+	int32 ResolvedCount = 0;
+	int32 CoalescedCount = 0;
+
+	/** 攻撃者の DamageMultiplier を掛けたダメージ量 */
+	static float ComputeSourceDamage(const FDawnlightDamageRequest& Request);
+
+	/** 合算済みのダメージを1つの対象に適用（GASで適用した場合は true） */
+	static bool ApplyPendingDamage(const FPendingDamage& Pending);
+};
@@ -0,0 +1,382 @@
+// Soul Reaper - Dawnlight Project
+// Copyright (c) 2025. All Rights Reserved.
+
+#include "DawnlightAISignificanceManager.h"
+#include "Dawnlight.h"
+#include "DawnlightStats.h"
+#include "AI/AnimalAIController.h"
+#include "Characters/EnemyCharacter.h"
+#include "AIController.h"
+#include "BrainComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "Kismet/GameplayStatics.h"
+#include "Perception/AIPerceptionComponent.h"
+#include "Perception/AISense_Sight.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("AI LOD High"), STAT_DawnlightAILODHigh, STATGROUP_DawnlightAI);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("AI LOD Medium"), STAT_DawnlightAILODMedium, STATGROUP_DawnlightAI);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("AI LOD Low"), STAT_DawnlightAILODLow, STATGROUP_DawnlightAI);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("AI LOD Dormant"), STAT_DawnlightAILODDormant, STATGROUP_DawnlightAI);
+DECLARE_CYCLE_STAT(TEXT("AI Significance Evaluate"), STAT_DawnlightAISignificanceEvaluate, STATGROUP_DawnlightAI);
+
+void UDawnlightAISignificanceManager::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// バケットごとのデフォルト設定
+	BucketSettings.SetNum(static_cast<int32>(EDawnlightAILOD::Max));
+
+	auto SetDefaultSettings = [this](EDawnlightAILOD LOD, float MinScore, int32 MaxAgents, float ControllerInterval, float PawnInterval, float MovementInterval, float BrainInterval, bool bPerception)
+	{
+		FDawnlightAILODSettings& Settings = BucketSettings[static_cast<int32>(LOD)];
+		Settings.MinScore = MinScore;
+		Settings.MaxAgents = MaxAgents;
+		Settings.ControllerTickInterval = ControllerInterval;
+		Settings.PawnTickInterval = PawnInterval;
+		Settings.MovementTickInterval = MovementInterval;
+		Settings.BrainTickInterval = BrainInterval;
+		Settings.bPerceptionEnabled = bPerception;
+	};
+
+	SetDefaultSettings(EDawnlightAILOD::High, 0.7f, 32, 0.0f, 0.0f, 0.0f, 0.0f, true);
+	SetDefaultSettings(EDawnlightAILOD::Medium, 0.4f, 96, 0.1f, 0.0f, 0.0f, 0.1f, true);
+	SetDefaultSettings(EDawnlightAILOD::Low, 0.15f, 0, 0.25f, 0.1f, 0.1f, 0.25f, true);
+	SetDefaultSettings(EDawnlightAILOD::Dormant, 0.0f, 0, 0.5f, 0.25f, 0.25f, 0.5f, false);
+
+	UE_LOG(LogDawnlight, Log, TEXT("[DawnlightAISignificanceManager] 初期化完了"));
+}
+
+void UDawnlightAISignificanceManager::Deinitialize()
+{
+	Agents.Empty();
+	SortedIndices.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UDawnlightAISignificanceManager::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// ゲームワールドでのみ作成
+	if (const UWorld* World = Cast<UWorld>(Outer))
+	{
+		return World->IsGameWorld();
+	}
+	return false;
+}
+
+TStatId UDawnlightAISignificanceManager::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UDawnlightAISignificanceManager, STATGROUP_Tickables);
+}
+
+// ========================================================================
+// 更新
+// ========================================================================
+
+void UDawnlightAISignificanceManager::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	TimeUntilEvaluation -= DeltaTime;
+	if (TimeUntilEvaluation > 0.0f)
+	{
+		return;
+	}
+	TimeUntilEvaluation = EvaluationInterval;
+
+	EvaluateAgents();
+}
+
+void UDawnlightAISignificanceManager::EvaluateAgents()
+{
+	SCOPE_CYCLE_COUNTER(STAT_DawnlightAISignificanceEvaluate);
+
+	// 破棄されたコントローラーを後ろから削除
+	for (int32 i = Agents.Num() - 1; i >= 0; --i)
+	{
+		if (!Agents[i].Controller.IsValid())
+		{
+			Agents.RemoveAtSwap(i, EAllowShrinking::No);
+		}
+	}
+
+	// ローカルプレイヤーの視点を収集（画面分割でも最も近い視点を使う）
+	UWorld* World = GetWorld();
+	TArray<FVector, TInlineAllocator<2>> ViewLocations;
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PlayerController = It->Get();
+		if (PlayerController && PlayerController->IsLocalController())
+		{
+			FVector ViewLocation;
+			FRotator ViewRotation;
+			PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+			ViewLocations.Add(ViewLocation);
+		}
+	}
+
+	const APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(World, 0);
+
+	SortedIndices.Reset(Agents.Num());
+	for (int32 i = 0; i < Agents.Num(); ++i)
+	{
+		FAgent& Agent = Agents[i];
+		const AAIController* Controller = Agent.Controller.Get();
+		const APawn* Pawn = Controller->GetPawn();
+
+		// ポーンがない間は評価しない（現在のバケットを維持）
+		if (!Pawn)
+		{
+			continue;
+		}
+
+		Agent.Score = ComputeScore(Controller, Pawn, ViewLocations, PlayerPawn);
+		SortedIndices.Add(i);
+	}
+
+	// スコアの高い順に上限付きでバケットを埋める
+	SortedIndices.Sort([this](int32 A, int32 B)
+	{
+		return Agents[A].Score > Agents[B].Score;
+	});
+
+	FMemory::Memzero(BucketCounts);
+	const int32 LastBucket = static_cast<int32>(EDawnlightAILOD::Max) - 1;
+
+	for (const int32 Index : SortedIndices)
+	{
+		FAgent& Agent = Agents[Index];
+		int32 Bucket = static_cast<int32>(ComputeDesiredLOD(Agent.Score, Agent.LOD));
+
+		// 上限に達したバケットは飛ばす（最後のバケットは無制限）
+		while (Bucket < LastBucket && BucketSettings[Bucket].MaxAgents > 0 && BucketCounts[Bucket] >= BucketSettings[Bucket].MaxAgents)
+		{
+			++Bucket;
+		}
+
+		++BucketCounts[Bucket];
+
+		const EDawnlightAILOD NewLOD = static_cast<EDawnlightAILOD>(Bucket);
+		if (NewLOD != Agent.LOD)
+		{
+			Agent.LOD = NewLOD;
+			ApplyLOD(Agent.Controller.Get(), NewLOD);
+		}
+	}
+
+	SET_DWORD_STAT(STAT_DawnlightAILODHigh, BucketCounts[static_cast<int32>(EDawnlightAILOD::High)]);
+	SET_DWORD_STAT(STAT_DawnlightAILODMedium, BucketCounts[static_cast<int32>(EDawnlightAILOD::Medium)]);
+	SET_DWORD_STAT(STAT_DawnlightAILODLow, BucketCounts[static_cast<int32>(EDawnlightAILOD::Low)]);
+	SET_DWORD_STAT(STAT_DawnlightAILODDormant, BucketCounts[static_cast<int32>(EDawnlightAILOD::Dormant)]);
+}
+
+float UDawnlightAISignificanceManager::ComputeScore(const AAIController* Controller, const APawn* Pawn, const TArray<FVector, TInlineAllocator<2>>& ViewLocations, const APawn* PlayerPawn) const
+{
+	const FVector PawnLocation = Pawn->GetActorLocation();
+
+	// 視点がない場合（ヘッドレス等）はプレイヤーの位置を使う
+	float DistanceSq = MAX_flt;
+	for (const FVector& ViewLocation : ViewLocations)
+	{
+		DistanceSq = FMath::Min(DistanceSq, static_cast<float>(FVector::DistSquared(ViewLocation, PawnLocation)));
+	}
+	if (ViewLocations.Num() == 0 && PlayerPawn)
+	{
+		DistanceSq = FVector::DistSquared(PlayerPawn->GetActorLocation(), PawnLocation);
+	}
+
+	const float DistanceScore = 1.0f - FMath::Clamp(FMath::Sqrt(DistanceSq) / MaxSignificanceDistance, 0.0f, 1.0f);
+	float Score = DistanceScore * DistanceWeight;
+
+	// 直近に描画されたか（レンダースレッドが記録する時刻を見るだけなので安価）
+	if (Pawn->WasRecentlyRendered(0.2f))
+	{
+		Score += VisibilityWeight;
+	}
+
+	// 戦闘への関与
+	bool bInCombat = PlayerPawn && FVector::DistSquared(PlayerPawn->GetActorLocation(), PawnLocation) <= FMath::Square(CombatRadius);
+	if (!bInCombat)
+	{
+		if (const AEnemyCharacter* Enemy = Cast<AEnemyCharacter>(Pawn))
+		{
+			bInCombat = Enemy->BehaviorState == EEnemyBehaviorState::Attacking;
+		}
+		else if (const AAnimalAIController* AnimalController = Cast<AAnimalAIController>(Controller))
+		{
+			bInCombat = AnimalController->GetCurrentState() == EAnimalAIState::Fleeing;
+		}
+	}
+	if (bInCombat)
+	{
+		Score += CombatWeight;
+	}
+
+	return FMath::Clamp(Score, 0.0f, 1.0f);
+}
+
+EDawnlightAILOD UDawnlightAISignificanceManager::ComputeDesiredLOD(float Score, EDawnlightAILOD CurrentLOD) const
+{
+	const int32 Current = static_cast<int32>(CurrentLOD);
+	const int32 LastBucket = static_cast<int32>(EDawnlightAILOD::Max) - 1;
+
+	// 上のバケットへは境界を余裕を持って超えた場合のみ
+	for (int32 Bucket = 0; Bucket < Current; ++Bucket)
+	{
+		if (Score >= BucketSettings[Bucket].MinScore + HysteresisMargin)
+		{
+			return static_cast<EDawnlightAILOD>(Bucket);
+		}
+	}
+
+	// 現在のバケットは境界を少し下回っても維持
+	if (Score >= BucketSettings[Current].MinScore - HysteresisMargin)
+	{
+		return CurrentLOD;
+	}
+
+	for (int32 Bucket = Current + 1; Bucket < LastBucket; ++Bucket)
+	{
+		if (Score >= BucketSettings[Bucket].MinScore)
+		{
+			return static_cast<EDawnlightAILOD>(Bucket);
+		}
+	}
+
+	return static_cast<EDawnlightAILOD>(LastBucket);
+}
+
+void UDawnlightAISignificanceManager::ApplyLOD(AAIController* Controller, EDawnlightAILOD LOD) const
+{
+	if (!Controller || !BucketSettings.IsValidIndex(static_cast<int32>(LOD)))
+	{
+		return;
+	}
+
+	const FDawnlightAILODSettings& Settings = BucketSettings[static_cast<int32>(LOD)];
+
+	Controller->SetActorTickInterval(Settings.ControllerTickInterval);
+
+	if (UBrainComponent* Brain = Controller->GetBrainComponent())
+	{
+		Brain->SetComponentTickInterval(Settings.BrainTickInterval);
+	}
+
+	if (UAIPerceptionComponent* Perception = Controller->GetAIPerceptionComponent())
+	{
+		Perception->SetSenseEnabled(UAISense_Sight::StaticClass(), Settings.bPerceptionEnabled);
+	}
+
+	if (APawn* Pawn = Controller->GetPawn())
+	{
+		Pawn->SetActorTickInterval(Settings.PawnTickInterval);
+
+		if (const ACharacter* Character = Cast<ACharacter>(Pawn))
+		{
+			if (UCharacterMovementComponent* Movement = Character->GetCharacterMovement())
+			{
+				Movement->SetComponentTickInterval(Settings.MovementTickInterval);
+			}
+		}
+	}
+}
+
+// ========================================================================
+// 登録
+// ========================================================================
+
+void UDawnlightAISignificanceManager::RegisterAgent(AAIController* Controller)
+{
+	if (!IsValid(Controller))
+	{
+		return;
+	}
+
+	const bool bAlreadyRegistered = Agents.ContainsByPredicate([Controller](const FAgent& Agent)
+	{
+		return Agent.Controller.Get() == Controller;
+	});
+
+	if (!bAlreadyRegistered)
+	{
+		// 次の評価までは最高バケットとして扱う
+		FAgent& Agent = Agents.AddDefaulted_GetRef();
+		Agent.Controller = Controller;
+	}
+}
+
+void UDawnlightAISignificanceManager::UnregisterAgent(AAIController* Controller)
+{
+	const int32 Index = Agents.IndexOfByPredicate([Controller](const FAgent& Agent)
+	{
+		return Agent.Controller.Get() == Controller;
+	});
+
+	if (Index == INDEX_NONE)
+	{
+		return;
+	}
+
+	// プールで再利用されても良いよう更新頻度を戻す
+	if (Agents[Index].LOD != EDawnlightAILOD::High)
+	{
+		ApplyLOD(Controller, EDawnlightAILOD::High);
+	}
+
+	Agents.RemoveAtSwap(Index, EAllowShrinking::No);
+}
+
+void UDawnlightAISignificanceManager::RegisterWithWorld(AAIController* Controller)
+{
+	if (!Controller)
+	{
+		return;
+	}
+
+	if (UWorld* World = Controller->GetWorld())
+	{
+		if (UDawnlightAISignificanceManager* Manager = World->GetSubsystem<UDawnlightAISignificanceManager>())
+		{
+			Manager->RegisterAgent(Controller);
+		}
+	}
+}
+
+void UDawnlightAISignificanceManager::UnregisterFromWorld(AAIController* Controller)
+{
+	if (!Controller)
+	{
+		return;
+	}
+
+	if (UWorld* World = Controller->GetWorld())
+	{
+		if (UDawnlightAISignificanceManager* Manager = World->GetSubsystem<UDawnlightAISignificanceManager>())
+		{
+			Manager->UnregisterAgent(Controller);
+		}
+	}
+}
+
+// ========================================================================
+// クエリ
+// ========================================================================
+
+EDawnlightAILOD UDawnlightAISignificanceManager::GetAgentLOD(const AAIController* Controller) const
+{
+	const FAgent* Agent = Agents.FindByPredicate([Controller](const FAgent& Candidate)
+	{
+		return Candidate.Controller.Get() == Controller;
+	});
+
+	return Agent ? Agent->LOD : EDawnlightAILOD::High;
+}
+
+int32 UDawnlightAISignificanceManager::GetAgentCountInBucket(EDawnlightAILOD LOD) const
+{
+	const int32 Bucket = static_cast<int32>(LOD);
+	return (Bucket >= 0 && Bucket < static_cast<int32>(EDawnlightAILOD::Max)) ? BucketCounts[Bucket] : 0;
+}
@@ -0,0 +1,195 @@
+// Soul Reaper - Dawnlight Project
+// Copyright (c) 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "DawnlightAISignificanceManager.generated.h"
+
+class AAIController;
+class APawn;
+
+/**
+ * AIの重要度バケット（上ほど重要）
+ */
+UENUM(BlueprintType)
+enum class EDawnlightAILOD : uint8
+{
+	High		UMETA(DisplayName = "高"),
+	Medium		UMETA(DisplayName = "中"),
+	Low			UMETA(DisplayName = "低"),
+	Dormant		UMETA(DisplayName = "休止"),
+
+	Max			UMETA(Hidden)
+};
+
+/**
+ * バケットごとの設定
+ */
+USTRUCT(BlueprintType)
+struct FDawnlightAILODSettings
+{
+	GENERATED_BODY()
+
+	/** このバケットに入る最低スコア（0〜1） */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI LOD", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float MinScore = 0.0f;
+
+	/** このバケットに入れる最大数（0で無制限、溢れたエージェントは下のバケットへ） */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI LOD", meta = (ClampMin = "0"))
+	int32 MaxAgents = 0;
+
+	/** コントローラーのTick間隔（Blackboard更新・逃走先の計算など） */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI LOD", meta = (ClampMin = "0.0"))
+	float ControllerTickInterval = 0.0f;
+
+	/** ポーンのTick間隔 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI LOD", meta = (ClampMin = "0.0"))
+	float PawnTickInterval = 0.0f;
+
+	/** CharacterMovementComponent のTick間隔 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI LOD", meta = (ClampMin = "0.0"))
+	float MovementTickInterval = 0.0f;
+
+	/** Behavior Tree のTick間隔 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI LOD", meta = (ClampMin = "0.0"))
+	float BrainTickInterval = 0.0f;
+
+	/** 視覚センサーを有効にするか */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI LOD")
+	bool bPerceptionEnabled = true;
+};
+
+/**
+ * AI重要度（LOD）マネージャー
+ *
+ * 敵・動物のAIコントローラーを重要度でバケット分けし、更新頻度を下げる
+ * - スコア = 視点からの距離 + 画面内に描画されているか + 戦闘に関与しているか
+ * - バケット間の移動にヒステリシスを持たせ、境界でのちらつきを防ぐ
+ * - バケットごとの上限数（溢れた場合はスコアの低いものから下のバケットへ）
+ * - コントローラー・ポーン・移動・Behavior Tree のTick間隔と視覚センサーの有効/無効を切り替える
+ * - 「stat DawnlightAI」でバケットごとのエージェント数を表示
+ */
+UCLASS()
+class DAWNLIGHT_API UDawnlightAISignificanceManager : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ========================================================================
+	// UWorldSubsystem インターフェース
+	// ========================================================================
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+	// ========================================================================
+	// FTickableGameObject インターフェース
+	// ========================================================================
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// ========================================================================
+	// 登録
+	// ========================================================================
+
+	/** AIコントローラーを登録（所有しているポーンを評価対象にする） */
+	void RegisterAgent(AAIController* Controller);
+
+	/** AIコントローラーの登録を解除（Tick間隔は最高バケットの設定に戻す） */
+	void UnregisterAgent(AAIController* Controller);
+
+	/** AIコントローラーを登録（ワールドにマネージャーがない場合は何もしない） */
+	static void RegisterWithWorld(AAIController* Controller);
+
+	/** AIコントローラーの登録を解除（ワールドにマネージャーがない場合は何もしない） */
+	static void UnregisterFromWorld(AAIController* Controller);
+
+	// ========================================================================
+	// クエリ
+	// ========================================================================
+
+	/** コントローラーの現在のバケット（未登録の場合は High） */
+	UFUNCTION(BlueprintPure, Category = "AI LOD")
+	EDawnlightAILOD GetAgentLOD(const AAIController* Controller) const;
+
+	/** バケット内のエージェント数 */
+	UFUNCTION(BlueprintPure, Category = "AI LOD")
+	int32 GetAgentCountInBucket(EDawnlightAILOD LOD) const;
+
+	/** 登録中のエージェント数 */
+	UFUNCTION(BlueprintPure, Category = "AI LOD")
+	int32 GetRegisteredAgentCount() const { return Agents.Num(); }
+
+	// ========================================================================
+	// 設定
+	// ========================================================================
+
+	/** バケットごとの設定（EDawnlightAILOD の順） */
+	UPROPERTY(EditAnywhere, Category = "AI LOD")
+	TArray<FDawnlightAILODSettings> BucketSettings;
+
+	/** 再評価の間隔（秒） */
+	UPROPERTY(EditAnywhere, Category = "AI LOD", meta = (ClampMin = "0.0"))
+	float EvaluationInterval = 0.25f;
+
+	/** この距離以上で距離スコアが0になる */
+	UPROPERTY(EditAnywhere, Category = "AI LOD", meta = (ClampMin = "1.0"))
+	float MaxSignificanceDistance = 8000.0f;
+
+	/** 距離スコアの重み */
+	UPROPERTY(EditAnywhere, Category = "AI LOD", meta = (ClampMin = "0.0"))
+	float DistanceWeight = 0.5f;
+
+	/** 画面内に描画されている場合の加算 */
+	UPROPERTY(EditAnywhere, Category = "AI LOD", meta = (ClampMin = "0.0"))
+	float VisibilityWeight = 0.3f;
+
+	/** 戦闘に関与している場合の加算（攻撃中の敵・逃走中の動物・プレイヤー付近） */
+	UPROPERTY(EditAnywhere, Category = "AI LOD", meta = (ClampMin = "0.0"))
+	float CombatWeight = 0.4f;
+
+	/** プレイヤーからこの距離内は戦闘に関与しているとみなす */
+	UPROPERTY(EditAnywhere, Category = "AI LOD", meta = (ClampMin = "0.0"))
+	float CombatRadius = 1200.0f;
+
+	/** バケット境界のヒステリシス幅（スコア） */
+	UPROPERTY(EditAnywhere, Category = "AI LOD", meta = (ClampMin = "0.0", ClampMax = "0.5"))
+	float HysteresisMargin = 0.05f;
+
+private:
+	/** 評価対象のエージェント */
+	struct FAgent
+	{
+		TWeakObjectPtr<AAIController> Controller;
+		EDawnlightAILOD LOD = EDawnlightAILOD::High;
+		float Score = 1.0f;
+	};
+
+	/** 登録中のエージェント */
+	TArray<FAgent> Agents;
+
+	/** 評価順（スコアの高い順のインデックス、使い回し） */
+	TArray<int32> SortedIndices;
+
+	/** バケットごとの人数 */
+	int32 BucketCounts[static_cast<int32>(EDawnlightAILOD::Max)] = {};
+
+	/** 次の評価までの時間 */
+	float TimeUntilEvaluation = 0.0f;
+
+	/** 全エージェントのスコアを計算してバケットを割り当てる */
+	void EvaluateAgents();
+
+	/** エージェントのスコアを計算 */
+	float ComputeScore(const AAIController* Controller, const APawn* Pawn, const TArray<FVector, TInlineAllocator<2>>& ViewLocations, const APawn* PlayerPawn) const;
+
+	/** ヒステリシスを考慮したバケット */
+	EDawnlightAILOD ComputeDesiredLOD(float Score, EDawnlightAILOD CurrentLOD) const;
+
+	/** バケットの設定をコントローラーとポーンに適用 */
+	void ApplyLOD(AAIController* Controller, EDawnlightAILOD LOD) const;
+};
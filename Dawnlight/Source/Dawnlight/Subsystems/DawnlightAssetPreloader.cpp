@@ -0,0 +1,305 @@
+// Soul Reaper - Dawnlight Project
+// Copyright (c) 2025. All Rights Reserved.
+
+#include "DawnlightAssetPreloader.h"
+#include "Dawnlight.h"
+#include "Data/EnemyDataAsset.h"
+#include "Data/SoulDataAsset.h"
+#include "Data/UpgradeDataAsset.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+
+void UDawnlightAssetPreloader::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	UE_LOG(LogDawnlight, Log, TEXT("[DawnlightAssetPreloader] 初期化完了"));
+}
+
+void UDawnlightAssetPreloader::Deinitialize()
+{
+	ReleaseAll();
+
+	Super::Deinitialize();
+}
+
+bool UDawnlightAssetPreloader::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// ゲームワールドでのみ作成
+	if (const UWorld* World = Cast<UWorld>(Outer))
+	{
+		return World->IsGameWorld();
+	}
+	return false;
+}
+
+// ========================================================================
+// プリロード
+// ========================================================================
+
+void UDawnlightAssetPreloader::PreloadEnemyAssets(const TArray<UEnemyDataAsset*>& EnemyDataAssets)
+{
+	TArray<FSoftObjectPath> Paths;
+	GatherEnemyAssetPaths(EnemyDataAssets, Paths);
+	PreloadPaths(Paths, TEXT("Enemy"));
+}
+
+void UDawnlightAssetPreloader::PreloadSoulAssets(const TArray<USoulDataAsset*>& SoulDataAssets)
+{
+	TArray<FSoftObjectPath> Paths;
+	GatherSoulAssetPaths(SoulDataAssets, Paths);
+	PreloadPaths(Paths, TEXT("Soul"));
+}
+
+void UDawnlightAssetPreloader::PreloadUpgradeIcons(const TArray<UUpgradeDataAsset*>& UpgradeDataAssets)
+{
+	TArray<FSoftObjectPath> Paths;
+	GatherUpgradeIconPaths(UpgradeDataAssets, Paths);
+	PreloadPaths(Paths, TEXT("UpgradeIcon"));
+}
+
+void UDawnlightAssetPreloader::PreloadPaths(const TArray<FSoftObjectPath>& Paths, const FString& DebugName)
+{
+	TArray<FSoftObjectPath> PathsToLoad;
+	for (const FSoftObjectPath& Path : Paths)
+	{
+		AddPathIfNeeded(Path, PathsToLoad);
+	}
+
+	if (PathsToLoad.Num() == 0)
+	{
+		return;
+	}
+
+	RequestedPaths.Append(PathsToLoad);
+
+	TSharedPtr<FStreamableHandle> Handle = StreamableManager.RequestAsyncLoad(
+		PathsToLoad,
+		FStreamableDelegate(),
+		FStreamableManager::DefaultAsyncLoadPriority,
+		false,
+		false,
+		DebugName
+	);
+
+	if (Handle.IsValid())
+	{
+		ActiveHandles.Add(Handle);
+	}
+
+	UE_LOG(LogDawnlight, Log, TEXT("[DawnlightAssetPreloader] プリロード開始: %s (%d 件)"), *DebugName, PathsToLoad.Num());
+}
+
+void UDawnlightAssetPreloader::GatherEnemyAssetPaths(const TArray<UEnemyDataAsset*>& EnemyDataAssets, TArray<FSoftObjectPath>& OutPaths)
+{
+	for (const UEnemyDataAsset* EnemyData : EnemyDataAssets)
+	{
+		if (!EnemyData)
+		{
+			continue;
+		}
+
+		// DeathEffect/SpawnEffectはハード参照のためデータアセットと同時にロード済み
+		AddPathUnique(EnemyData->EnemyBlueprintClass.ToSoftObjectPath(), OutPaths);
+		AddPathUnique(EnemyData->AttackSound.ToSoftObjectPath(), OutPaths);
+		AddPathUnique(EnemyData->DeathSound.ToSoftObjectPath(), OutPaths);
+	}
+}
+
+void UDawnlightAssetPreloader::GatherSoulAssetPaths(const TArray<USoulDataAsset*>& SoulDataAssets, TArray<FSoftObjectPath>& OutPaths)
+{
+	for (const USoulDataAsset* SoulData : SoulDataAssets)
+	{
+		if (!SoulData)
+		{
+			continue;
+		}
+
+		AddPathUnique(SoulData->AnimalBlueprintClass.ToSoftObjectPath(), OutPaths);
+		AddPathUnique(SoulData->CollectNiagaraEffect.ToSoftObjectPath(), OutPaths);
+		AddPathUnique(SoulData->CollectEffect.ToSoftObjectPath(), OutPaths);
+		AddPathUnique(SoulData->SoulIcon.ToSoftObjectPath(), OutPaths);
+		AddPathUnique(SoulData->AnimalCrySound.ToSoftObjectPath(), OutPaths);
+		AddPathUnique(SoulData->CollectSound.ToSoftObjectPath(), OutPaths);
+	}
+}
+
+void UDawnlightAssetPreloader::GatherUpgradeIconPaths(const TArray<UUpgradeDataAsset*>& UpgradeDataAssets, TArray<FSoftObjectPath>& OutPaths)
+{
+	for (const UUpgradeDataAsset* UpgradeData : UpgradeDataAssets)
+	{
+		if (UpgradeData)
+		{
+			AddPathUnique(UpgradeData->Icon.ToSoftObjectPath(), OutPaths);
+		}
+	}
+}
+
+void UDawnlightAssetPreloader::ReleaseAll()
+{
+	if (ActiveHandles.Num() == 0)
+	{
+		return;
+	}
+
+	LogPreloadReport();
+
+	for (const TSharedPtr<FStreamableHandle>& Handle : ActiveHandles)
+	{
+		if (Handle.IsValid())
+		{
+			Handle->ReleaseHandle();
+		}
+	}
+
+	ActiveHandles.Empty();
+	RequestedPaths.Empty();
+	ColdRequests.Empty();
+	TotalColdRequests = 0;
+
+	UE_LOG(LogDawnlight, Log, TEXT("[DawnlightAssetPreloader] プリロードハンドルを解放"));
+}
+
+// ========================================================================
+// アセット取得
+// ========================================================================
+
+UObject* UDawnlightAssetPreloader::ResolveObject(const FSoftObjectPath& Path, const TCHAR* Context)
+{
+	if (Path.IsNull())
+	{
+		return nullptr;
+	}
+
+	if (UObject* LoadedObject = Path.ResolveObject())
+	{
+		return LoadedObject;
+	}
+
+	RecordColdRequest(Path, Context);
+
+	// フォールバック: 同期ロードしてループ終了まで保持
+	TSharedPtr<FStreamableHandle> Handle = StreamableManager.RequestSyncLoad(Path);
+	if (!Handle.IsValid())
+	{
+		return nullptr;
+	}
+
+	ActiveHandles.Add(Handle);
+	RequestedPaths.Add(Path);
+	return Handle->GetLoadedAsset();
+}
+
+void UDawnlightAssetPreloader::RequestObject(const FSoftObjectPath& Path, const TCHAR* Context, TFunction<void(UObject*)> OnLoaded)
+{
+	if (Path.IsNull())
+	{
+		OnLoaded(nullptr);
+		return;
+	}
+
+	if (UObject* LoadedObject = Path.ResolveObject())
+	{
+		OnLoaded(LoadedObject);
+		return;
+	}
+
+	RecordColdRequest(Path, Context);
+
+	TSharedPtr<FStreamableHandle> Handle = StreamableManager.RequestAsyncLoad(
+		Path,
+		FStreamableDelegate::CreateLambda([Path, OnLoaded]()
+		{
+			OnLoaded(Path.ResolveObject());
+		})
+	);
+
+	if (Handle.IsValid())
+	{
+		ActiveHandles.Add(Handle);
+		RequestedPaths.Add(Path);
+	}
+}
+
+UObject* UDawnlightAssetPreloader::ResolveSoftPath(const UObject* WorldContextObject, const FSoftObjectPath& Path, const TCHAR* Context)
+{
+	if (Path.IsNull())
+	{
+		return nullptr;
+	}
+
+	if (const UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr)
+	{
+		if (UDawnlightAssetPreloader* Preloader = World->GetSubsystem<UDawnlightAssetPreloader>())
+		{
+			return Preloader->ResolveObject(Path, Context);
+		}
+	}
+
+	return Path.TryLoad();
+}
+
+void UDawnlightAssetPreloader::RequestSoftPath(const UObject* WorldContextObject, const FSoftObjectPath& Path, const TCHAR* Context, TFunction<void(UObject*)> OnLoaded)
+{
+	if (const UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr)
+	{
+		if (UDawnlightAssetPreloader* Preloader = World->GetSubsystem<UDawnlightAssetPreloader>())
+		{
+			Preloader->RequestObject(Path, Context, MoveTemp(OnLoaded));
+			return;
+		}
+	}
+
+	OnLoaded(Path.IsNull() ? nullptr : Path.TryLoad());
+}
+
+// ========================================================================
+// 統計
+// ========================================================================
+
+void UDawnlightAssetPreloader::LogPreloadReport() const
+{
+	UE_LOG(LogDawnlight, Log, TEXT("[DawnlightAssetPreloader] プリロード: %d 件, コールドリクエスト: %d 回 (%d 件)"),
+		RequestedPaths.Num(), TotalColdRequests, ColdRequests.Num());
+
+	for (const TPair<FSoftObjectPath, int32>& Pair : ColdRequests)
+	{
+		UE_LOG(LogDawnlight, Log, TEXT("[DawnlightAssetPreloader]   未プリロード: %s x%d"), *Pair.Key.ToString(), Pair.Value);
+	}
+}
+
+// ========================================================================
+// 内部処理
+// ========================================================================
+
+void UDawnlightAssetPreloader::RecordColdRequest(const FSoftObjectPath& Path, const TCHAR* Context)
+{
+	TotalColdRequests++;
+	int32& Count = ColdRequests.FindOrAdd(Path);
+	Count++;
+
+	// 初回のみ警告（同じアセットでログが埋まらないように）
+	if (Count == 1)
+	{
+		UE_LOG(LogDawnlight, Warning, TEXT("[DawnlightAssetPreloader] プリロード前に要求されました: %s (%s)"),
+			*Path.ToString(), Context ? Context : TEXT("Unknown"));
+	}
+}
+
+void UDawnlightAssetPreloader::AddPathUnique(const FSoftObjectPath& Path, TArray<FSoftObjectPath>& OutPaths)
+{
+	if (!Path.IsNull())
+	{
+		OutPaths.AddUnique(Path);
+	}
+}
+
+void UDawnlightAssetPreloader::AddPathIfNeeded(const FSoftObjectPath& Path, TArray<FSoftObjectPath>& OutPaths) const
+{
+	if (Path.IsNull() || RequestedPaths.Contains(Path))
+	{
+		return;
+	}
+
+	OutPaths.AddUnique(Path);
+}
@@ -0,0 +1,143 @@
+// Soul Reaper - Dawnlight Project
+// Copyright (c) 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/StreamableManager.h"
+#include "Templates/Function.h"
+#include "DawnlightAssetPreloader.generated.h"
+
+class UEnemyDataAsset;
+class USoulDataAsset;
+class UUpgradeDataAsset;
+
+/**
+ * アセットプリローダー
+ *
+ * フェーズ開始時にソフト参照（敵/動物Blueprintクラス、Niagara、アイコン等）を
+ * FStreamableManagerで非同期ロードし、ループ終了までハンドルを保持する
+ * - 戦闘中のLoadSynchronousによるゲームスレッドのブロックを回避
+ * - プリロード前に要求されたアセット（コールドリクエスト）を記録・警告
+ */
+UCLASS()
+class DAWNLIGHT_API UDawnlightAssetPreloader : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ========================================================================
+	// UWorldSubsystem インターフェース
+	// ========================================================================
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+	// ========================================================================
+	// プリロード
+	// ========================================================================
+
+	/** 敵データのソフト参照をプリロード（Blueprintクラス、サウンド） */
+	void PreloadEnemyAssets(const TArray<UEnemyDataAsset*>& EnemyDataAssets);
+
+	/** 魂データのソフト参照をプリロード（動物Blueprintクラス、Niagara、アイコン、サウンド） */
+	void PreloadSoulAssets(const TArray<USoulDataAsset*>& SoulDataAssets);
+
+	/** アップグレードアイコンをプリロード */
+	void PreloadUpgradeIcons(const TArray<UUpgradeDataAsset*>& UpgradeDataAssets);
+
+	/** 任意のパスをプリロード（既にリクエスト済みのパスはスキップ） */
+	void PreloadPaths(const TArray<FSoftObjectPath>& Paths, const FString& DebugName);
+
+	/** 敵データが参照するソフトパスを収集（Blueprintクラス、サウンド） */
+	static void GatherEnemyAssetPaths(const TArray<UEnemyDataAsset*>& EnemyDataAssets, TArray<FSoftObjectPath>& OutPaths);
+
+	/** 魂データが参照するソフトパスを収集（動物Blueprintクラス、Niagara、アイコン、サウンド） */
+	static void GatherSoulAssetPaths(const TArray<USoulDataAsset*>& SoulDataAssets, TArray<FSoftObjectPath>& OutPaths);
+
+	/** アップグレードアイコンのソフトパスを収集 */
+	static void GatherUpgradeIconPaths(const TArray<UUpgradeDataAsset*>& UpgradeDataAssets, TArray<FSoftObjectPath>& OutPaths);
+
+	/** 保持中のハンドルを全て解放（ループ終了時） */
+	UFUNCTION(BlueprintCallable, Category = "アセットプリロード")
+	void ReleaseAll();
+
+	// ========================================================================
+	// アセット取得
+	// ========================================================================
+
+	/**
+	 * ロード済みのアセットを取得
+	 * 未ロードの場合はコールドリクエストとして記録し、同期ロードする
+	 */
+	UObject* ResolveObject(const FSoftObjectPath& Path, const TCHAR* Context);
+
+	/**
+	 * アセットを非同期で要求（UI用）
+	 * ロード済みなら即座に、未ロードならコールドリクエストとして記録しロード完了後に OnLoaded を呼ぶ
+	 */
+	void RequestObject(const FSoftObjectPath& Path, const TCHAR* Context, TFunction<void(UObject*)> OnLoaded);
+
+	/** ワールドのプリローダー経由でアセットを取得（プリローダーがない場合は同期ロード） */
+	static UObject* ResolveSoftPath(const UObject* WorldContextObject, const FSoftObjectPath& Path, const TCHAR* Context);
+
+	/** ワールドのプリローダー経由でアセットを非同期要求 */
+	static void RequestSoftPath(const UObject* WorldContextObject, const FSoftObjectPath& Path, const TCHAR* Context, TFunction<void(UObject*)> OnLoaded);
+
+	/** ソフトオブジェクト参照を解決 */
+	template<typename T>
+	static T* ResolveAsset(const UObject* WorldContextObject, const TSoftObjectPtr<T>& SoftObject, const TCHAR* Context)
+	{
+		return Cast<T>(ResolveSoftPath(WorldContextObject, SoftObject.ToSoftObjectPath(), Context));
+	}
+
+	/** ソフトクラス参照を解決 */
+	template<typename T>
+	static UClass* ResolveClass(const UObject* WorldContextObject, const TSoftClassPtr<T>& SoftClass, const TCHAR* Context)
+	{
+		return Cast<UClass>(ResolveSoftPath(WorldContextObject, SoftClass.ToSoftObjectPath(), Context));
+	}
+
+	// ========================================================================
+	// 統計
+	// ========================================================================
+
+	/** プリロード前に要求された回数 */
+	UFUNCTION(BlueprintPure, Category = "アセットプリロード")
+	int32 GetColdRequestCount() const { return TotalColdRequests; }
+
+	/** プリロード済み（リクエスト済み）のパス数 */
+	UFUNCTION(BlueprintPure, Category = "アセットプリロード")
+	int32 GetPreloadedPathCount() const { return RequestedPaths.Num(); }
+
+	/** コールドリクエストの一覧をログ出力 */
+	UFUNCTION(BlueprintCallable, Category = "アセットプリロード")
+	void LogPreloadReport() const;
+
+private:
+	/** ストリーミングマネージャー */
+	FStreamableManager StreamableManager;
+
+	/** 保持中のハンドル（ループ終了まで解放しない） */
+	TArray<TSharedPtr<FStreamableHandle>> ActiveHandles;
+
+	/** リクエスト済みのパス */
+	TSet<FSoftObjectPath> RequestedPaths;
+
+	/** コールドリクエストのパスと回数 */
+	TMap<FSoftObjectPath, int32> ColdRequests;
+
+	/** コールドリクエストの総数 */
+	int32 TotalColdRequests = 0;
+
+	/** コールドリクエストを記録 */
+	void RecordColdRequest(const FSoftObjectPath& Path, const TCHAR* Context);
+
+	/** パスをリストに追加（null/重複を除外） */
+	static void AddPathUnique(const FSoftObjectPath& Path, TArray<FSoftObjectPath>& OutPaths);
+
+	/** パスをリストに追加（null/重複/リクエスト済みを除外） */
+	void AddPathIfNeeded(const FSoftObjectPath& Path, TArray<FSoftObjectPath>& OutPaths) const;
+};
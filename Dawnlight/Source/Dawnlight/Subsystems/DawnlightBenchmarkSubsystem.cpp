@@ -0,0 +1,373 @@
+// Soul Reaper - Dawnlight Project
+// Copyright (c) 2025. All Rights Reserved.
+
+#include "DawnlightBenchmarkSubsystem.h"
+#include "Dawnlight.h"
+#include "Core/DawnlightGameMode.h"
+#include "Characters/DawnlightCharacter.h"
+#include "Characters/EnemyCharacter.h"
+#include "Subsystems/AnimalHerdSubsystem.h"
+#include "Subsystems/AnimalSpawnerSubsystem.h"
+#include "Subsystems/SpatialGridSubsystem.h"
+#include "Subsystems/WaveSpawnerSubsystem.h"
+#include "UI/Widgets/UpgradeSelectionWidget.h"
+#include "Engine/World.h"
+#include "HAL/PlatformMemory.h"
+#include "Kismet/GameplayStatics.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/UObjectArray.h"
+
+namespace DawnlightBenchmark
+{
+	/** 読み込み直後のヒッチを統計から除外するフレーム数 */
+	constexpr int32 WarmupFrames = 30;
+
+	/** ボットが攻撃を開始する距離 */
+	constexpr float BotAttackRange = 200.0f;
+
+	/** ボットが標的を探す最大距離 */
+	constexpr float BotSearchRadius = 10000.0f;
+}
+
+bool UDawnlightBenchmarkSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// -DawnlightBenchmark 指定時のゲームワールドでのみ作成
+	if (const UWorld* World = Cast<UWorld>(Outer))
+	{
+		return World->IsGameWorld() && FParse::Param(FCommandLine::Get(), TEXT("DawnlightBenchmark"));
+	}
+	return false;
+}
+
+void UDawnlightBenchmarkSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	ParseCommandLine();
+
+	// 乱数を固定して同じ条件で再現できるようにする
+	SeedRandomStreams(InWorld, Seed);
+
+	if (UWaveSpawnerSubsystem* WaveSpawner = InWorld.GetSubsystem<UWaveSpawnerSubsystem>())
+	{
+		WaveSpawner->SetEnemyCountMultiplier(StressMultiplier);
+		WaveSpawner->OnEnemySpawned.AddDynamic(this, &UDawnlightBenchmarkSubsystem::OnEnemySpawned);
+	}
+
+	ConfigureGameMode();
+
+	UE_LOG(LogDawnlight, Log, TEXT("[DawnlightBenchmark] 開始 Seed=%d Stress=x%.2f Budget=%.2fms Output=%s"),
+		Seed, StressMultiplier, FrameBudgetMs, *OutputPath);
+}
+
+void UDawnlightBenchmarkSubsystem::Deinitialize()
+{
+	// ワールド破棄まで終了条件に達しなかった場合も結果を残す
+	if (!bFinished && Frames.Num() > 0)
+	{
+		FinishBenchmark(TEXT("ワールド破棄"));
+	}
+
+	Super::Deinitialize();
+}
+
+TStatId UDawnlightBenchmarkSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UDawnlightBenchmarkSubsystem, STATGROUP_Tickables);
+}
+
+void UDawnlightBenchmarkSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (bFinished)
+	{
+		return;
+	}
+
+	if (!bGameModeConfigured)
+	{
+		ConfigureGameMode();
+	}
+
+	ElapsedGameSeconds += DeltaTime;
+
+	UpdateBot();
+	RecordFrame(DeltaTime);
+
+	if (ElapsedGameSeconds >= MaxGameSeconds)
+	{
+		FinishBenchmark(TEXT("時間上限"));
+	}
+}
+
+void UDawnlightBenchmarkSubsystem::SeedRandomStreams(UWorld& World, int32 InSeed)
+{
+	FMath::RandInit(InSeed);
+	FMath::SRandInit(InSeed);
+
+	// 群れは専用の乱数ストリームを持つ
+	if (UAnimalHerdSubsystem* Herd = World.GetSubsystem<UAnimalHerdSubsystem>())
+	{
+		Herd->SetRandomSeed(InSeed);
+	}
+}
+
+// ========================================================================
+// 設定
+// ========================================================================
+
+void UDawnlightBenchmarkSubsystem::ParseCommandLine()
+{
+	const TCHAR* CommandLine = FCommandLine::Get();
+
+	FParse::Value(CommandLine, TEXT("BenchmarkSeed="), Seed);
+	FParse::Value(CommandLine, TEXT("BenchmarkStress="), StressMultiplier);
+	FParse::Value(CommandLine, TEXT("BenchmarkNightSeconds="), NightSecondsOverride);
+	FParse::Value(CommandLine, TEXT("BenchmarkMaxSeconds="), MaxGameSeconds);
+	FParse::Value(CommandLine, TEXT("BenchmarkBudgetMs="), FrameBudgetMs);
+
+	StressMultiplier = FMath::Max(StressMultiplier, 0.01f);
+
+	if (!FParse::Value(CommandLine, TEXT("BenchmarkOutput="), OutputPath))
+	{
+		OutputPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Benchmark"),
+			FString::Printf(TEXT("Dawnlight_Seed%d_x%.1f_%s.csv"), Seed, StressMultiplier, *FDateTime::Now().ToString()));
+	}
+}
+
+void UDawnlightBenchmarkSubsystem::ConfigureGameMode()
+{
+	ADawnlightGameMode* DawnlightGameMode = Cast<ADawnlightGameMode>(UGameplayStatics::GetGameMode(GetWorld()));
+	if (!DawnlightGameMode)
+	{
+		return;
+	}
+
+	GameMode = DawnlightGameMode;
+	bGameModeConfigured = true;
+
+	if (NightSecondsOverride > 0.0f)
+	{
+		DawnlightGameMode->SetNightPhaseDuration(NightSecondsOverride);
+	}
+
+	DawnlightGameMode->OnGameOver.AddDynamic(this, &UDawnlightBenchmarkSubsystem::OnGameOver);
+	DawnlightGameMode->OnGameClear.AddDynamic(this, &UDawnlightBenchmarkSubsystem::OnGameClear);
+}
+
+// ========================================================================
+// ボット
+// ========================================================================
+
+void UDawnlightBenchmarkSubsystem::UpdateBot()
+{
+	ADawnlightGameMode* DawnlightGameMode = GameMode.Get();
+	if (!DawnlightGameMode)
+	{
+		return;
+	}
+
+	// アップグレード選択はスキップして次のウェーブへ
+	if (UUpgradeSelectionWidget* UpgradeWidget = DawnlightGameMode->GetUpgradeSelectionWidget())
+	{
+		if (UpgradeWidget->IsWaitingForSelection())
+		{
+			UpgradeWidget->RequestSkip();
+		}
+	}
+
+	ADawnlightCharacter* Player = Cast<ADawnlightCharacter>(UGameplayStatics::GetPlayerPawn(GetWorld(), 0));
+	if (!Player || Player->IsDead())
+	{
+		return;
+	}
+
+	// Nightは動物、Dawnは敵を狙う
+	EDawnlightSpatialCategory TargetCategory = EDawnlightSpatialCategory::None;
+	if (DawnlightGameMode->IsInNightPhase())
+	{
+		TargetCategory = EDawnlightSpatialCategory::Animal;
+	}
+	else if (DawnlightGameMode->IsInDawnPhase())
+	{
+		TargetCategory = EDawnlightSpatialCategory::Enemy;
+	}
+
+	const USpatialGridSubsystem* SpatialGrid = GetWorld()->GetSubsystem<USpatialGridSubsystem>();
+	if (TargetCategory == EDawnlightSpatialCategory::None || !SpatialGrid)
+	{
+		return;
+	}
+
+	TArray<AActor*> Nearest;
+	const FVector PlayerLocation = Player->GetActorLocation();
+	SpatialGrid->GetGrid().QueryNearest(PlayerLocation, 1, DawnlightBenchmark::BotSearchRadius, static_cast<uint8>(TargetCategory), Nearest);
+	if (Nearest.Num() == 0)
+	{
+		return;
+	}
+
+	FVector ToTarget = Nearest[0]->GetActorLocation() - PlayerLocation;
+	ToTarget.Z = 0.0f;
+
+	if (ToTarget.SizeSquared() > FMath::Square(DawnlightBenchmark::BotAttackRange))
+	{
+		Player->AddMovementInput(ToTarget.GetSafeNormal(), 1.0f);
+	}
+	else
+	{
+		Player->SetActorRotation(ToTarget.Rotation());
+		if (!Player->IsAttacking())
+		{
+			Player->PerformLightAttack();
+		}
+	}
+}
+
+// ========================================================================
+// 計測
+// ========================================================================
+
+void UDawnlightBenchmarkSubsystem::RecordFrame(float DeltaTime)
+{
+	FDawnlightBenchmarkFrame& FrameData = Frames.AddDefaulted_GetRef();
+	FrameData.Frame = Frames.Num() - 1;
+	FrameData.GameTime = ElapsedGameSeconds;
+	FrameData.DeltaMs = DeltaTime * 1000.0f;
+
+	// 直前フレームのゲームスレッド時間（待機を除く）
+	FrameData.GameThreadMs = FPlatformTime::ToMilliseconds(GGameThreadTime);
+
+	if (const ADawnlightGameMode* DawnlightGameMode = GameMode.Get())
+	{
+		FrameData.Phase = static_cast<uint8>(DawnlightGameMode->GetCurrentPhase());
+	}
+
+	if (const UWaveSpawnerSubsystem* WaveSpawner = GetWorld()->GetSubsystem<UWaveSpawnerSubsystem>())
+	{
+		FrameData.AliveEnemies = WaveSpawner->GetAliveEnemyCount();
+	}
+	FrameData.SpawnedEnemies = SpawnedEnemyCount;
+
+	if (const UAnimalSpawnerSubsystem* AnimalSpawner = GetWorld()->GetSubsystem<UAnimalSpawnerSubsystem>())
+	{
+		FrameData.AliveAnimals = AnimalSpawner->GetAliveAnimalCount();
+		FrameData.SpawnedAnimals = AnimalSpawner->GetTotalSpawnedCount();
+	}
+
+	// アロケーション数の代わりにUObject数と使用メモリを記録
+	FrameData.UObjectCount = GUObjectArray.GetObjectArrayNumMinusAvailable();
+	FrameData.UsedMemoryMB = static_cast<float>(FPlatformMemory::GetStats().UsedPhysical) / (1024.0f * 1024.0f);
+}
+
+void UDawnlightBenchmarkSubsystem::FinishBenchmark(const TCHAR* Reason)
+{
+	if (bFinished)
+	{
+		return;
+	}
+	bFinished = true;
+
+	FString Csv;
+	Csv.Reserve(Frames.Num() * 96);
+	Csv += TEXT("Frame,GameTime,Phase,DeltaMs,GameThreadMs,AliveEnemies,AliveAnimals,SpawnedEnemies,SpawnedAnimals,UObjectCount,UsedMemoryMB\n");
+
+	for (const FDawnlightBenchmarkFrame& FrameData : Frames)
+	{
+		Csv += FString::Printf(TEXT("%d,%.4f,%d,%.3f,%.3f,%d,%d,%d,%d,%d,%.1f\n"),
+			FrameData.Frame, FrameData.GameTime, FrameData.Phase, FrameData.DeltaMs, FrameData.GameThreadMs,
+			FrameData.AliveEnemies, FrameData.AliveAnimals, FrameData.SpawnedEnemies, FrameData.SpawnedAnimals,
+			FrameData.UObjectCount, FrameData.UsedMemoryMB);
+	}
+
+	if (FFileHelper::SaveStringToFile(Csv, *OutputPath))
+	{
+		UE_LOG(LogDawnlight, Log, TEXT("[DawnlightBenchmark] 終了（%s）: %d フレームを %s に出力"), Reason, Frames.Num(), *OutputPath);
+	}
+	else
+	{
+		UE_LOG(LogDawnlight, Error, TEXT("[DawnlightBenchmark] CSVの書き込みに失敗: %s"), *OutputPath);
+	}
+
+	LogSummary();
+
+	if (FApp::IsUnattended())
+	{
+		FPlatformMisc::RequestExit(false, TEXT("DawnlightBenchmark"));
+	}
+}
+
+void UDawnlightBenchmarkSubsystem::LogSummary() const
+{
+	TArray<float> GameThreadTimes;
+	int32 MinEnemiesOverBudget = MAX_int32;
+	int32 MaxEnemiesWithinBudget = 0;
+
+	for (int32 i = DawnlightBenchmark::WarmupFrames; i < Frames.Num(); ++i)
+	{
+		const FDawnlightBenchmarkFrame& FrameData = Frames[i];
+		GameThreadTimes.Add(FrameData.GameThreadMs);
+
+		if (FrameData.GameThreadMs > FrameBudgetMs)
+		{
+			MinEnemiesOverBudget = FMath::Min(MinEnemiesOverBudget, FrameData.AliveEnemies);
+		}
+		else
+		{
+			MaxEnemiesWithinBudget = FMath::Max(MaxEnemiesWithinBudget, FrameData.AliveEnemies);
+		}
+	}
+
+	if (GameThreadTimes.Num() == 0)
+	{
+		return;
+	}
+
+	GameThreadTimes.Sort();
+
+	double Total = 0.0;
+	for (const float Time : GameThreadTimes)
+	{
+		Total += Time;
+	}
+
+	const auto Percentile = [&GameThreadTimes](float Ratio)
+	{
+		return GameThreadTimes[FMath::Clamp(FMath::FloorToInt(Ratio * (GameThreadTimes.Num() - 1)), 0, GameThreadTimes.Num() - 1)];
+	};
+
+	UE_LOG(LogDawnlight, Log, TEXT("[DawnlightBenchmark] GameThread: Avg=%.2fms P50=%.2fms P95=%.2fms P99=%.2fms Max=%.2fms"),
+		Total / GameThreadTimes.Num(), Percentile(0.5f), Percentile(0.95f), Percentile(0.99f), GameThreadTimes.Last());
+
+	UE_LOG(LogDawnlight, Log, TEXT("[DawnlightBenchmark] 敵スポーン累計: %d, 予算(%.2fms)内の最大同時敵数: %d"),
+		SpawnedEnemyCount, FrameBudgetMs, MaxEnemiesWithinBudget);
+
+	if (MinEnemiesOverBudget != MAX_int32)
+	{
+		UE_LOG(LogDawnlight, Log, TEXT("[DawnlightBenchmark] 予算超過が発生した最小同時敵数: %d"), MinEnemiesOverBudget);
+	}
+}
+
+// ========================================================================
+// イベント
+// ========================================================================
+
+void UDawnlightBenchmarkSubsystem::OnGameOver()
+{
+	FinishBenchmark(TEXT("ゲームオーバー"));
+}
+
+void UDawnlightBenchmarkSubsystem::OnGameClear()
+{
+	FinishBenchmark(TEXT("ゲームクリア"));
+}
+
+void UDawnlightBenchmarkSubsystem::OnEnemySpawned(AEnemyCharacter* Enemy)
+{
+	SpawnedEnemyCount++;
+}
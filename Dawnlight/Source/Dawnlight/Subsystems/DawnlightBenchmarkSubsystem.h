@@ -0,0 +1,141 @@
+// Soul Reaper - Dawnlight Project
+// Copyright (c) 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "DawnlightBenchmarkSubsystem.generated.h"
+
+class ADawnlightGameMode;
+class AEnemyCharacter;
+
+/**
+ * ベンチマークの1フレーム分の計測値
+ */
+struct FDawnlightBenchmarkFrame
+{
+	int32 Frame = 0;
+	float GameTime = 0.0f;
+	uint8 Phase = 0;
+	float DeltaMs = 0.0f;
+	float GameThreadMs = 0.0f;
+	int32 AliveEnemies = 0;
+	int32 AliveAnimals = 0;
+	int32 SpawnedEnemies = 0;
+	int32 SpawnedAnimals = 0;
+	int32 UObjectCount = 0;
+	float UsedMemoryMB = 0.0f;
+};
+
+/**
+ * ヘッドレスベンチマークサブシステム
+ *
+ * コマンドラインに -DawnlightBenchmark がある場合のみ作成され、
+ * スクリプト化したボットで Night → Dawn → ループ終了 までを自動プレイし、
+ * フレームごとのゲームスレッド時間・スポーン数・メモリをCSVに出力する
+ *
+ * 実行例:
+ *   UnrealEditor Dawnlight.uproject /Game/Maps/TestMap -game -nullrhi -unattended
+ *     -benchmark -fps=30 -DawnlightBenchmark -BenchmarkSeed=1234 -BenchmarkStress=4
+ *
+ * オプション:
+ *   -BenchmarkSeed=N         乱数シード（既定: 12345）
+ *   -BenchmarkStress=X       FWaveConfig の敵数・同時出現数の倍率（既定: 1）
+ *   -BenchmarkNightSeconds=S Night Phaseの長さを上書き
+ *   -BenchmarkMaxSeconds=S   ゲーム時間の上限（既定: 900）
+ *   -BenchmarkBudgetMs=F     フレーム予算（既定: 16.67）
+ *   -BenchmarkOutput=Path    CSVの出力先（既定: Saved/Benchmark/）
+ */
+UCLASS()
+class DAWNLIGHT_API UDawnlightBenchmarkSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ========================================================================
+	// UWorldSubsystem インターフェース
+	// ========================================================================
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	// ========================================================================
+	// FTickableGameObject インターフェース
+	// ========================================================================
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/**
+	 * スポーン・徘徊に使う乱数を全てシードで固定する
+	 * 同じシードの実行は同じスポーン順・同じボット入力になる
+	 */
+	static void SeedRandomStreams(UWorld& World, int32 InSeed);
+
+private:
+	// ========================================================================
+	// 設定（コマンドラインから取得）
+	// ========================================================================
+
+	int32 Seed = 12345;
+	float StressMultiplier = 1.0f;
+	float NightSecondsOverride = 0.0f;
+	float MaxGameSeconds = 900.0f;
+	float FrameBudgetMs = 1000.0f / 60.0f;
+	FString OutputPath;
+
+	// ========================================================================
+	// 状態
+	// ========================================================================
+
+	/** ゲームモードの設定（Night時間・イベント登録）を済ませたか */
+	bool bGameModeConfigured = false;
+
+	/** 計測を終了したか */
+	bool bFinished = false;
+
+	/** 経過ゲーム時間 */
+	float ElapsedGameSeconds = 0.0f;
+
+	/** スポーンした敵の累計 */
+	int32 SpawnedEnemyCount = 0;
+
+	/** 計測値 */
+	TArray<FDawnlightBenchmarkFrame> Frames;
+
+	/** ゲームモード */
+	TWeakObjectPtr<ADawnlightGameMode> GameMode;
+
+	// ========================================================================
+	// 内部処理
+	// ========================================================================
+
+	/** コマンドラインから設定を読み込む */
+	void ParseCommandLine();
+
+	/** ゲームモードに設定を適用し、終了イベントを登録 */
+	void ConfigureGameMode();
+
+	/** ボットでプレイヤーを操作 */
+	void UpdateBot();
+
+	/** 1フレーム分を記録 */
+	void RecordFrame(float DeltaTime);
+
+	/** CSVを書き出して終了 */
+	void FinishBenchmark(const TCHAR* Reason);
+
+	/** サマリーをログ出力 */
+	void LogSummary() const;
+
+	UFUNCTION()
+	void OnGameOver();
+
+	UFUNCTION()
+	void OnGameClear();
+
+	UFUNCTION()
+	void OnEnemySpawned(AEnemyCharacter* Enemy);
+};
@@ -0,0 +1,375 @@
+// Soul Reaper - Dawnlight Project
+// Copyright (c) 2025. All Rights Reserved.
+
+#include "DawnlightVFXManager.h"
+#include "Dawnlight.h"
+#include "NiagaraComponent.h"
+#include "NiagaraSystem.h"
+#include "NiagaraFunctionLibrary.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/WorldSettings.h"
+
+void UDawnlightVFXManager::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// カテゴリごとのデフォルト予算
+	Categories.SetNum(static_cast<int32>(EDawnlightVFXCategory::Max));
+
+	auto SetDefaultBudget = [this](EDawnlightVFXCategory Category, int32 MaxActive, float CullDistance)
+	{
+		FDawnlightVFXBudget& Budget = Categories[static_cast<int32>(Category)].Budget;
+		Budget.MaxActive = MaxActive;
+		Budget.CullDistance = CullDistance;
+	};
+
+	SetDefaultBudget(EDawnlightVFXCategory::Hit, 32, 4000.0f);
+	SetDefaultBudget(EDawnlightVFXCategory::Death, 16, 5000.0f);
+	SetDefaultBudget(EDawnlightVFXCategory::SoulCollect, 24, 4000.0f);
+	SetDefaultBudget(EDawnlightVFXCategory::ReaperAura, 4, 0.0f);
+
+	UE_LOG(LogDawnlight, Log, TEXT("[DawnlightVFXManager] 初期化完了"));
+}
+
+void UDawnlightVFXManager::Deinitialize()
+{
+	UE_LOG(LogDawnlight, Log, TEXT("[DawnlightVFXManager] 終了処理（待機中: %d, カリング: %d回, 再利用: %d回）"),
+		GetPooledComponentCount(), CulledCount, RecycledCount);
+
+	for (FDawnlightVFXCategoryState& State : Categories)
+	{
+		for (const FDawnlightActiveVFX& Effect : State.ActiveEffects)
+		{
+			if (IsValid(Effect.Component))
+			{
+				Effect.Component->DestroyComponent();
+			}
+		}
+		State.ActiveEffects.Empty();
+	}
+
+	for (TPair<TObjectPtr<UNiagaraSystem>, FDawnlightVFXFreeList>& Pair : FreeLists)
+	{
+		for (UNiagaraComponent* Component : Pair.Value.Components)
+		{
+			if (IsValid(Component))
+			{
+				Component->DestroyComponent();
+			}
+		}
+	}
+	FreeLists.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UDawnlightVFXManager::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// ゲームワールドでのみ作成
+	if (const UWorld* World = Cast<UWorld>(Outer))
+	{
+		return World->IsGameWorld();
+	}
+	return false;
+}
+
+// ========================================================================
+// スポーン
+// ========================================================================
+
+UNiagaraComponent* UDawnlightVFXManager::SpawnAtLocation(UNiagaraSystem* System, EDawnlightVFXCategory Category, FVector Location, FRotator Rotation)
+{
+	if (!System || !Categories.IsValidIndex(static_cast<int32>(Category)))
+	{
+		return nullptr;
+	}
+
+	// 見えない距離のエフェクトはスポーンしない
+	const FDawnlightVFXBudget& Budget = Categories[static_cast<int32>(Category)].Budget;
+	if (Budget.CullDistance > 0.0f && IsBeyondCullDistance(Location, Budget.CullDistance))
+	{
+		++CulledCount;
+		return nullptr;
+	}
+
+	UNiagaraComponent* Component = AcquireComponent(System, Category, false);
+	if (!Component)
+	{
+		return nullptr;
+	}
+
+	Component->SetWorldLocationAndRotation(Location, Rotation);
+	Component->Activate(true);
+
+	return Component;
+}
+
+UNiagaraComponent* UDawnlightVFXManager::SpawnAttached(UNiagaraSystem* System, EDawnlightVFXCategory Category, USceneComponent* AttachTo, FName SocketName)
+{
+	if (!System || !AttachTo || !Categories.IsValidIndex(static_cast<int32>(Category)))
+	{
+		return nullptr;
+	}
+
+	// 呼び出し側が ReleaseEffect するまで保持するため、予算超過時も再利用しない
+	UNiagaraComponent* Component = AcquireComponent(System, Category, true);
+	if (!Component)
+	{
+		return nullptr;
+	}
+
+	Component->AttachToComponent(AttachTo, FAttachmentTransformRules::KeepRelativeTransform, SocketName);
+	Component->SetRelativeLocationAndRotation(FVector::ZeroVector, FRotator::ZeroRotator);
+	Component->Activate(true);
+
+	return Component;
+}
+
+void UDawnlightVFXManager::ReleaseEffect(UNiagaraComponent* Component)
+{
+	if (UNiagaraSystem* System = RemoveFromActive(Component))
+	{
+		ReturnToFreeList(Component, System);
+	}
+}
+
+UNiagaraComponent* UDawnlightVFXManager::SpawnAtLocationInWorld(const UObject* WorldContextObject, UNiagaraSystem* System, EDawnlightVFXCategory Category, const FVector& Location, const FRotator& Rotation)
+{
+	UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+	if (!World || !System)
+	{
+		return nullptr;
+	}
+
+	if (UDawnlightVFXManager* VFXManager = World->GetSubsystem<UDawnlightVFXManager>())
+	{
+		return VFXManager->SpawnAtLocation(System, Category, Location, Rotation);
+	}
+
+	return UNiagaraFunctionLibrary::SpawnSystemAtLocation(World, System, Location, Rotation);
+}
+
+// ========================================================================
+// 予算
+// ========================================================================
+
+void UDawnlightVFXManager::SetCategoryBudget(EDawnlightVFXCategory Category, const FDawnlightVFXBudget& Budget)
+{
+	if (!Categories.IsValidIndex(static_cast<int32>(Category)))
+	{
+		return;
+	}
+
+	FDawnlightVFXCategoryState& State = Categories[static_cast<int32>(Category)];
+	State.Budget = Budget;
+	State.Budget.MaxActive = FMath::Max(Budget.MaxActive, 1);
+
+	// 予算を下げた場合は古いものから停止（呼び出し側が保持するエフェクトは残す）
+	while (State.ActiveEffects.Num() > State.Budget.MaxActive)
+	{
+		if (!RecycleOldestEffect(State))
+		{
+			break;
+		}
+	}
+}
+
+FDawnlightVFXBudget UDawnlightVFXManager::GetCategoryBudget(EDawnlightVFXCategory Category) const
+{
+	return Categories.IsValidIndex(static_cast<int32>(Category))
+		? Categories[static_cast<int32>(Category)].Budget
+		: FDawnlightVFXBudget();
+}
+
+int32 UDawnlightVFXManager::GetActiveEffectCount(EDawnlightVFXCategory Category) const
+{
+	return Categories.IsValidIndex(static_cast<int32>(Category))
+		? Categories[static_cast<int32>(Category)].ActiveEffects.Num()
+		: 0;
+}
+
+int32 UDawnlightVFXManager::GetPooledComponentCount() const
+{
+	int32 Count = 0;
+	for (const TPair<TObjectPtr<UNiagaraSystem>, FDawnlightVFXFreeList>& Pair : FreeLists)
+	{
+		Count += Pair.Value.Components.Num();
+	}
+	return Count;
+}
+
+// ========================================================================
+// 内部処理
+// ========================================================================
+
+UNiagaraComponent* UDawnlightVFXManager::AcquireComponent(UNiagaraSystem* System, EDawnlightVFXCategory Category)
+{
+	FDawnlightVFXCategoryState& State = Categories[static_cast<int32>(Category)];
+
+	// 予算超過時は最も古いエフェクトを止めて枠を空ける
+	if (State.ActiveEffects.Num() >= State.Budget.MaxActive)
+	{
+		if (!RecycleOldestEffect(State))
+		{
+			UE_LOG(LogDawnlight, Verbose, TEXT("[DawnlightVFXManager] 予算が保持中のエフェクトで埋まっているためスポーンしません: %s"),
+				*GetNameSafe(System));
+			return nullptr;
+		}
+		++RecycledCount;
+	}
+
+	UNiagaraComponent* Component = PopOrCreateComponent(System);
+	if (!Component)
+	{
+		return nullptr;
+	}
+
+	FDawnlightActiveVFX& Effect = State.ActiveEffects.AddDefaulted_GetRef();
+	Effect.Component = Component;
+	Effect.System = System;
+	Effect.bOwnedByCaller = bOwnedByCaller;
+
+	return Component;
+}
+
+bool UDawnlightVFXManager::RecycleOldestEffect(FDawnlightVFXCategoryState& State)
+{
+	// 保持中のコンポーネントを再利用すると、呼び出し側の ReleaseEffect が別のエフェクトを止めてしまう
+	const int32 Index = State.ActiveEffects.IndexOfByPredicate([](const FDawnlightActiveVFX& Effect)
+	{
+		return !Effect.bOwnedByCaller;
+	});
+
+	if (Index == INDEX_NONE)
+	{
+		return false;
+	}
+
+	const FDawnlightActiveVFX Oldest = State.ActiveEffects[Index];
+	State.ActiveEffects.RemoveAt(Index, EAllowShrinking::No);
+	ReturnToFreeList(Oldest.Component, Oldest.System);
+	return true;
+}
+
+UNiagaraComponent* UDawnlightVFXManager::PopOrCreateComponent(UNiagaraSystem* System)
+{
+	if (FDawnlightVFXFreeList* FreeList = FreeLists.Find(System))
+	{
+		while (FreeList->Components.Num() > 0)
+		{
+			UNiagaraComponent* Component = FreeList->Components.Pop(EAllowShrinking::No);
+			if (IsValid(Component))
+			{
+				return Component;
+			}
+		}
+	}
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	// 所有アクターの破棄に巻き込まれないよう WorldSettings を Outer にする
+	UObject* Outer = World->GetWorldSettings();
+	UNiagaraComponent* Component = NewObject<UNiagaraComponent>(Outer ? Outer : World);
+	Component->SetAutoActivate(false);
+	Component->SetAutoDestroy(false);
+	Component->SetAsset(System);
+	Component->RegisterComponentWithWorld(World);
+	Component->OnSystemFinished.AddUniqueDynamic(this, &UDawnlightVFXManager::OnEffectFinished);
+
+	return Component;
+}
+
+void UDawnlightVFXManager::ReturnToFreeList(UNiagaraComponent* Component, UNiagaraSystem* System)
+{
+	if (!IsValid(Component) || !System)
+	{
+		return;
+	}
+
+	// 再生中なら即停止（OnSystemFinished が呼ばれるが、再生中リストからは除外済み）
+	if (Component->IsActive())
+	{
+		Component->DeactivateImmediate();
+	}
+
+	if (Component->GetAttachParent())
+	{
+		Component->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
+	}
+
+	FreeLists.FindOrAdd(System).Components.Add(Component);
+}
+
+UNiagaraSystem* UDawnlightVFXManager::RemoveFromActive(UNiagaraComponent* Component)
+{
+	if (!Component)
+	{
+		return nullptr;
+	}
+
+	for (FDawnlightVFXCategoryState& State : Categories)
+	{
+		const int32 Index = State.ActiveEffects.IndexOfByPredicate([Component](const FDawnlightActiveVFX& Effect)
+		{
+			return Effect.Component == Component;
+		});
+
+		if (Index != INDEX_NONE)
+		{
+			UNiagaraSystem* System = State.ActiveEffects[Index].System;
+			State.ActiveEffects.RemoveAt(Index, EAllowShrinking::No);
+			return System;
+		}
+	}
+
+	return nullptr;
+}
+
+bool UDawnlightVFXManager::IsBeyondCullDistance(const FVector& Location, float CullDistance) const
+{
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return false;
+	}
+
+	const float CullDistanceSq = FMath::Square(CullDistance);
+	bool bHasViewer = false;
+
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PlayerController = It->Get();
+		if (!PlayerController || !PlayerController->IsLocalController())
+		{
+			continue;
+		}
+
+		FVector ViewLocation;
+		FRotator ViewRotation;
+		PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+		bHasViewer = true;
+
+		if (FVector::DistSquared(ViewLocation, Location) <= CullDistanceSq)
+		{
+			return false;
+		}
+	}
+
+	// 視点がない場合（ヘッドレス等）はカリングしない
+	return bHasViewer;
+}
+
+void UDawnlightVFXManager::OnEffectFinished(UNiagaraComponent* FinishedComponent)
+{
+	// 再生を終えたエフェクトをプールに戻す
+	if (UNiagaraSystem* System = RemoveFromActive(FinishedComponent))
+	{
+		ReturnToFreeList(FinishedComponent, System);
+	}
+}
@@ -0,0 +1,207 @@
+// Soul Reaper - Dawnlight Project
+// Copyright (c) 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "DawnlightVFXManager.generated.h"
+
+class UNiagaraSystem;
+class UNiagaraComponent;
+class USceneComponent;
+
+/**
+ * エフェクトの予算カテゴリ
+ */
+UENUM(BlueprintType)
+enum class EDawnlightVFXCategory : uint8
+{
+	Hit			UMETA(DisplayName = "ヒット"),
+	Death		UMETA(DisplayName = "死亡"),
+	SoulCollect	UMETA(DisplayName = "魂収集"),
+	ReaperAura	UMETA(DisplayName = "リーパーオーラ"),
+
+	Max			UMETA(Hidden)
+};
+
+/**
+ * カテゴリごとの予算
+ */
+USTRUCT(BlueprintType)
+struct FDawnlightVFXBudget
+{
+	GENERATED_BODY()
+
+	/** 同時に再生できる最大数（超えた場合は最も古いものを再利用） */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VFX", meta = (ClampMin = "1"))
+	int32 MaxActive = 16;
+
+	/** カメラからこの距離より遠い場合はスポーンしない（0で無制限） */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VFX", meta = (ClampMin = "0"))
+	float CullDistance = 0.0f;
+};
+
+/**
+ * 再生中のエフェクト
+ */
+USTRUCT()
+struct FDawnlightActiveVFX
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TObjectPtr<UNiagaraComponent> Component;
+
+	UPROPERTY()
+	TObjectPtr<UNiagaraSystem> System;
+
+	/** 呼び出し側が保持するエフェクト（ReleaseEffect まで予算超過時の再利用対象外） */
+	UPROPERTY()
+	bool bOwnedByCaller = false;
+};
+
+/**
+ * カテゴリごとの状態
+ */
+USTRUCT()
+struct FDawnlightVFXCategoryState
+{
+	GENERATED_BODY()
+
+	/** 予算 */
+	UPROPERTY()
+	FDawnlightVFXBudget Budget;
+
+	/** 再生中のエフェクト（古い順） */
+	UPROPERTY()
+	TArray<FDawnlightActiveVFX> ActiveEffects;
+};
+
+/**
+ * システムアセットごとの待機中コンポーネント
+ */
+USTRUCT()
+struct FDawnlightVFXFreeList
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<TObjectPtr<UNiagaraComponent>> Components;
+};
+
+/**
+ * Niagaraエフェクトマネージャー
+ *
+ * 使い捨ての SpawnSystemAtLocation を置き換え、コンポーネントを再利用する
+ * - システムアセットごとにコンポーネントをプール（再生終了で返却）
+ * - カテゴリごとの同時再生数の上限（超過時は最も古いものを再利用、SpawnAttached のエフェクトは除く）
+ * - カメラからの距離によるスポーン時カリング
+ */
+UCLASS()
+class DAWNLIGHT_API UDawnlightVFXManager : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ========================================================================
+	// UWorldSubsystem インターフェース
+	// ========================================================================
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+	// ========================================================================
+	// スポーン
+	// ========================================================================
+
+	/**
+	 * 指定位置でエフェクトを再生
+	 * @return 再生したコンポーネント（カリングされた場合は nullptr、保持しないこと）
+	 */
+	UFUNCTION(BlueprintCallable, Category = "VFX")
+	UNiagaraComponent* SpawnAtLocation(UNiagaraSystem* System, EDawnlightVFXCategory Category, FVector Location, FRotator Rotation = FRotator::ZeroRotator);
+
+	/**
+	 * コンポーネントにアタッチしてエフェクトを再生（ループエフェクト向け、距離カリングなし）
+	 * 停止する場合は ReleaseEffect を呼ぶ
+	 */
+	UFUNCTION(BlueprintCallable, Category = "VFX")
+	UNiagaraComponent* SpawnAttached(UNiagaraSystem* System, EDawnlightVFXCategory Category, USceneComponent* AttachTo, FName SocketName = NAME_None);
+
+	/** 再生中のエフェクトを停止してプールに戻す */
+	UFUNCTION(BlueprintCallable, Category = "VFX")
+	void ReleaseEffect(UNiagaraComponent* Component);
+
+	/** 指定位置でエフェクトを再生（マネージャーがないワールドでは通常のスポーン） */
+	static UNiagaraComponent* SpawnAtLocationInWorld(const UObject* WorldContextObject, UNiagaraSystem* System, EDawnlightVFXCategory Category, const FVector& Location, const FRotator& Rotation = FRotator::ZeroRotator);
+
+	// ========================================================================
+	// 予算
+	// ========================================================================
+
+	/** カテゴリの予算を設定 */
+	UFUNCTION(BlueprintCallable, Category = "VFX")
+	void SetCategoryBudget(EDawnlightVFXCategory Category, const FDawnlightVFXBudget& Budget);
+
+	/** カテゴリの予算を取得 */
+	UFUNCTION(BlueprintPure, Category = "VFX")
+	FDawnlightVFXBudget GetCategoryBudget(EDawnlightVFXCategory Category) const;
+
+	/** カテゴリの再生中エフェクト数 */
+	UFUNCTION(BlueprintPure, Category = "VFX")
+	int32 GetActiveEffectCount(EDawnlightVFXCategory Category) const;
+
+	/** プール内で待機中のコンポーネント数 */
+	UFUNCTION(BlueprintPure, Category = "VFX")
+	int32 GetPooledComponentCount() const;
+
+protected:
+	// ========================================================================
+	// 内部データ
+	// ========================================================================
+
+	/** カテゴリごとの予算と再生中エフェクト（EDawnlightVFXCategory の順） */
+	UPROPERTY()
+	TArray<FDawnlightVFXCategoryState> Categories;
+
+	/** システムアセットごとの待機中コンポーネント */
+	UPROPERTY()
+	TMap<TObjectPtr<UNiagaraSystem>, FDawnlightVFXFreeList> FreeLists;
+
+	/** 距離カリングでスポーンしなかった回数 */
+	int32 CulledCount = 0;
+
+	/** 予算超過で古いエフェクトを再利用した回数 */
+	int32 RecycledCount = 0;
+
+	// ========================================================================
+	// 内部処理
+	// ========================================================================
+
+	/**
+	 * 予算を確保してコンポーネントを取得（距離カリングは呼び出し側）
+	 * @return 予算が呼び出し側の保持するエフェクトで埋まっている場合は nullptr
+	 */
+	UNiagaraComponent* AcquireComponent(UNiagaraSystem* System, EDawnlightVFXCategory Category, bool bOwnedByCaller);
+
+	/** 再利用できる最も古いエフェクトを停止してプールに戻す（なければ false） */
+	bool RecycleOldestEffect(FDawnlightVFXCategoryState& State);
+
+	/** プールから取り出すか新規作成 */
+	UNiagaraComponent* PopOrCreateComponent(UNiagaraSystem* System);
+
+	/** コンポーネントを停止して待機リストに戻す */
+	void ReturnToFreeList(UNiagaraComponent* Component, UNiagaraSystem* System);
+
+	/** 再生中リストから取り除く（見つかった場合はシステムを返す） */
+	UNiagaraSystem* RemoveFromActive(UNiagaraComponent* Component);
+
+	/** 位置がいずれのローカルプレイヤーの視点からも CullDistance より遠いか */
+	bool IsBeyondCullDistance(const FVector& Location, float CullDistance) const;
+
+	/** 再生終了時のコールバック */
+	UFUNCTION()
+	void OnEffectFinished(UNiagaraComponent* FinishedComponent);
+};
@@ -0,0 +1,253 @@
+// Soul Reaper - Dawnlight Project
+// Copyright (c) 2025. All Rights Reserved.
+
+#include "EnemyCrowdSubsystem.h"
+#include "Dawnlight.h"
+#include "DawnlightStats.h"
+#include "PlayerFlowFieldSubsystem.h"
+#include "Async/ParallelFor.h"
+#include "Engine/World.h"
+#include "Kismet/GameplayStatics.h"
+
+void UEnemyCrowdSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	FlowField = Collection.InitializeDependency<UPlayerFlowFieldSubsystem>();
+
+	UE_LOG(LogDawnlight, Log, TEXT("[EnemyCrowdSubsystem] 初期化完了"));
+}
+
+void UEnemyCrowdSubsystem::Deinitialize()
+{
+	Enemies.Empty();
+	Locations.Empty();
+	States.Empty();
+	AttackRangesSq.Empty();
+	AttackMoveScales.Empty();
+	BossFlags.Empty();
+	MoveDirections.Empty();
+	MoveScales.Empty();
+	IndexByEnemy.Empty();
+	CachedPlayer.Reset();
+	FlowField = nullptr;
+
+	Super::Deinitialize();
+}
+
+bool UEnemyCrowdSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// ゲームワールドでのみ作成
+	if (const UWorld* World = Cast<UWorld>(Outer))
+	{
+		return World->IsGameWorld();
+	}
+	return false;
+}
+
+TStatId UEnemyCrowdSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEnemyCrowdSubsystem, STATGROUP_Tickables);
+}
+
+// ========================================================================
+// 更新
+// ========================================================================
+
+void UEnemyCrowdSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (Enemies.Num() == 0)
+	{
+		return;
+	}
+
+	DAWNLIGHT_SCOPE_CYCLE_COUNTER(STAT_DawnlightEnemyTick);
+
+	if (!CachedPlayer.IsValid())
+	{
+		CachedPlayer = UGameplayStatics::GetPlayerPawn(GetWorld(), 0);
+		if (!CachedPlayer.IsValid())
+		{
+			return;
+		}
+	}
+
+	GatherEnemyData();
+	ComputeSteering(CachedPlayer->GetActorLocation());
+	ApplySteering(DeltaTime);
+}
+
+void UEnemyCrowdSubsystem::GatherEnemyData()
+{
+	// 外部で破棄された敵・書き戻し中に登録解除された敵を後ろから削除
+	for (int32 i = Enemies.Num() - 1; i >= 0; --i)
+	{
+		if (!Enemies[i].IsValid())
+		{
+			RemoveAtSwap(i);
+		}
+	}
+
+	for (int32 i = 0; i < Enemies.Num(); ++i)
+	{
+		const AEnemyCharacter* Enemy = Enemies[i].Get();
+		Locations[i] = Enemy->GetActorLocation();
+
+		// スタン等はBlueprint側から設定される可能性があるためアクターの状態を優先
+		States[i] = Enemy->BehaviorState;
+	}
+}
+
+void UEnemyCrowdSubsystem::ComputeSteering(const FVector& PlayerLocation)
+{
+	const int32 Count = Enemies.Num();
+
+	// フィールドは自身のTickでのみ更新されるため、ここでは読み取り専用で共有できる
+	const UPlayerFlowFieldSubsystem* SharedFlowField = FlowField;
+
+	ParallelFor(Count, [this, &PlayerLocation, SharedFlowField](int32 Index)
+	{
+		FVector ToPlayer = PlayerLocation - Locations[Index];
+		const EEnemyBehaviorState NewState = AEnemyCharacter::EvaluateBehaviorState(
+			States[Index], ToPlayer.SizeSquared(), AttackRangesSq[Index]);
+
+		// 追跡中はフローフィールドに従う（プレイヤーと同じセル・フィールド外では直進）
+		FVector FlowDirection;
+		if (NewState == EEnemyBehaviorState::Chasing && SharedFlowField && SharedFlowField->GetFlowDirection(Locations[Index], FlowDirection))
+		{
+			MoveDirections[Index] = FlowDirection;
+		}
+		else
+		{
+			ToPlayer.Z = 0.0f;
+			MoveDirections[Index] = ToPlayer.GetSafeNormal();
+		}
+		States[Index] = NewState;
+
+		switch (NewState)
+		{
+		case EEnemyBehaviorState::Chasing:
+			MoveScales[Index] = 1.0f;
+			break;
+
+		case EEnemyBehaviorState::Attacking:
+			MoveScales[Index] = AttackMoveScales[Index];
+			break;
+
+		default:
+			MoveScales[Index] = 0.0f;
+			break;
+		}
+	}, Count < ParallelUpdateThreshold);
+}
+
+void UEnemyCrowdSubsystem::ApplySteering(float DeltaTime)
+{
+	// 攻撃でプレイヤーが死亡した場合などに登録解除が走るため、件数は開始時点で固定
+	const int32 Count = Enemies.Num();
+
+	for (int32 i = 0; i < Count; ++i)
+	{
+		AEnemyCharacter* Enemy = Enemies[i].Get();
+		if (!Enemy || !Enemy->IsAlive())
+		{
+			continue;
+		}
+
+		Enemy->BehaviorState = States[i];
+
+		if (MoveScales[i] > 0.0f && !MoveDirections[i].IsNearlyZero())
+		{
+			Enemy->AddMovementInput(MoveDirections[i], MoveScales[i]);
+		}
+
+		// 攻撃・ボス処理はタイマーを使うためゲームスレッドで個別に実行
+		if (States[i] == EEnemyBehaviorState::Attacking || BossFlags[i])
+		{
+			Enemy->ProcessCrowdActions(DeltaTime);
+		}
+	}
+}
+
+// ========================================================================
+// 登録
+// ========================================================================
+
+void UEnemyCrowdSubsystem::RegisterEnemy(AEnemyCharacter* Enemy)
+{
+	if (!IsValid(Enemy))
+	{
+		return;
+	}
+
+	int32 Index = INDEX_NONE;
+	if (const int32* ExistingIndex = IndexByEnemy.Find(Enemy))
+	{
+		Index = *ExistingIndex;
+	}
+	else
+	{
+		Index = Enemies.Add(Enemy);
+		Locations.Add(Enemy->GetActorLocation());
+		States.Add(Enemy->BehaviorState);
+		AttackRangesSq.AddZeroed();
+		AttackMoveScales.AddZeroed();
+		BossFlags.Add(false);
+		MoveDirections.Add(FVector::ZeroVector);
+		MoveScales.Add(0.0f);
+		IndexByEnemy.Add(Enemy, Index);
+	}
+
+	WriteEnemyParams(Index, Enemy);
+
+	// 個別Tickを止めてサブシステムでまとめて更新
+	Enemy->SetActorTickEnabled(false);
+}
+
+void UEnemyCrowdSubsystem::UnregisterEnemy(AEnemyCharacter* Enemy)
+{
+	int32 Index = INDEX_NONE;
+	if (!IndexByEnemy.RemoveAndCopyValue(Enemy, Index))
+	{
+		return;
+	}
+
+	// 配列の詰め直しは次のTickの収集時に行う（書き戻し中の解除に対応）
+	Enemies[Index].Reset();
+}
+
+// ========================================================================
+// 内部処理
+// ========================================================================
+
+void UEnemyCrowdSubsystem::WriteEnemyParams(int32 Index, const AEnemyCharacter* Enemy)
+{
+	AttackRangesSq[Index] = FMath::Square(Enemy->AttackRange);
+	AttackMoveScales[Index] = Enemy->GetAttackMoveScale();
+	BossFlags[Index] = Enemy->bIsBoss;
+}
+
+void UEnemyCrowdSubsystem::RemoveAtSwap(int32 Index)
+{
+	const int32 LastIndex = Enemies.Num() - 1;
+
+	// 末尾の要素がこのインデックスに移動するため、対応表を更新
+	if (Index != LastIndex)
+	{
+		if (const AEnemyCharacter* MovedEnemy = Enemies[LastIndex].Get())
+		{
+			IndexByEnemy.Add(MovedEnemy, Index);
+		}
+	}
+
+	Enemies.RemoveAtSwap(Index, EAllowShrinking::No);
+	Locations.RemoveAtSwap(Index, EAllowShrinking::No);
+	States.RemoveAtSwap(Index, EAllowShrinking::No);
+	AttackRangesSq.RemoveAtSwap(Index, EAllowShrinking::No);
+	AttackMoveScales.RemoveAtSwap(Index, EAllowShrinking::No);
+	BossFlags.RemoveAtSwap(Index, EAllowShrinking::No);
+	MoveDirections.RemoveAtSwap(Index, EAllowShrinking::No);
+	MoveScales.RemoveAtSwap(Index, EAllowShrinking::No);
+}
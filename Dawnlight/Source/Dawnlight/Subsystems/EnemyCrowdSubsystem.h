@@ -0,0 +1,126 @@
+// Soul Reaper - Dawnlight Project
+// Copyright (c) 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "Characters/EnemyCharacter.h"
+#include "EnemyCrowdSubsystem.generated.h"
+
+class UPlayerFlowFieldSubsystem;
+
+/**
+ * 敵群衆シミュレーションサブシステム
+ *
+ * 登録された敵の追跡ステートをStructure of Arraysで保持し、1回のTickでまとめて更新する
+ * - 敵ごとのアクターTickを無効化（Tick → UpdateBehaviorState → ProcessChasing の連鎖を置き換え）
+ * - 距離計算・状態遷移は連続配列上で実行（敵が多い場合はParallelFor）
+ * - 追跡中の移動方向はプレイヤーのフローフィールドを参照（壁を回り込む）
+ * - キャラクターへの書き戻しは状態・移動入力・攻撃判定のみ
+ */
+UCLASS()
+class DAWNLIGHT_API UEnemyCrowdSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ========================================================================
+	// UWorldSubsystem インターフェース
+	// ========================================================================
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+	// ========================================================================
+	// FTickableGameObject インターフェース
+	// ========================================================================
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// ========================================================================
+	// 登録
+	// ========================================================================
+
+	/**
+	 * 敵を登録（アクターTickを無効化）
+	 * 登録済みの場合はAI設定（攻撃範囲等）を再取得する
+	 */
+	void RegisterEnemy(AEnemyCharacter* Enemy);
+
+	/** 敵の登録を解除 */
+	void UnregisterEnemy(AEnemyCharacter* Enemy);
+
+	/** 登録中の敵数 */
+	UFUNCTION(BlueprintPure, Category = "敵群衆")
+	int32 GetRegisteredEnemyCount() const { return Enemies.Num(); }
+
+	// ========================================================================
+	// 設定
+	// ========================================================================
+
+	/** この数以上の敵がいる場合にParallelForで状態を計算 */
+	UPROPERTY(EditAnywhere, Category = "敵群衆", meta = (ClampMin = "1"))
+	int32 ParallelUpdateThreshold = 64;
+
+private:
+	// ========================================================================
+	// 群衆データ（Structure of Arrays、全て同じインデックスで対応）
+	// ========================================================================
+
+	/** 敵アクター */
+	TArray<TWeakObjectPtr<AEnemyCharacter>> Enemies;
+
+	/** 今フレームの位置 */
+	TArray<FVector> Locations;
+
+	/** 行動状態 */
+	TArray<EEnemyBehaviorState> States;
+
+	/** 攻撃範囲の2乗 */
+	TArray<float> AttackRangesSq;
+
+	/** 攻撃中の移動入力スケール（立ち止まる敵は0） */
+	TArray<float> AttackMoveScales;
+
+	/** ボスかどうか */
+	TArray<bool> BossFlags;
+
+	/** 計算結果: 移動方向 */
+	TArray<FVector> MoveDirections;
+
+	/** 計算結果: 移動入力スケール */
+	TArray<float> MoveScales;
+
+	/** 敵 → インデックス */
+	TMap<TObjectKey<AEnemyCharacter>, int32> IndexByEnemy;
+
+	/** プレイヤーへの参照（キャッシュ） */
+	TWeakObjectPtr<AActor> CachedPlayer;
+
+	/** 追跡方向の参照先 */
+	UPROPERTY()
+	TObjectPtr<UPlayerFlowFieldSubsystem> FlowField;
+
+	// ========================================================================
+	// 内部処理
+	// ========================================================================
+
+	/** 敵のAI設定を配列に書き込む */
+	void WriteEnemyParams(int32 Index, const AEnemyCharacter* Enemy);
+
+	/** インデックスの要素を末尾と入れ替えて削除 */
+	void RemoveAtSwap(int32 Index);
+
+	/** アクターから位置・状態を収集（無効な敵は削除） */
+	void GatherEnemyData();
+
+	/** 状態遷移と移動方向を計算 */
+	void ComputeSteering(const FVector& PlayerLocation);
+
+	/** 計算結果をキャラクターに書き戻す */
+	void ApplySteering(float DeltaTime);
+};
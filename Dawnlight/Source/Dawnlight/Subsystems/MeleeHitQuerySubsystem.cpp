@@ -0,0 +1,277 @@
+// Soul Reaper - Dawnlight Project
+// Copyright (c) 2025. All Rights Reserved.
+
+#include "MeleeHitQuerySubsystem.h"
+#include "Dawnlight.h"
+#include "DawnlightStats.h"
+#include "DawnlightTags.h"
+#include "Subsystems/DamagePipelineSubsystem.h"
+#include "Subsystems/SpatialGridSubsystem.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "DrawDebugHelpers.h"
+#include "Engine/World.h"
+
+void UMeleeHitQuerySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	UE_LOG(LogDawnlight, Log, TEXT("[MeleeHitQuerySubsystem] 初期化完了"));
+}
+
+void UMeleeHitQuerySubsystem::Deinitialize()
+{
+	Swings.Empty();
+	Candidates.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UMeleeHitQuerySubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// ゲームワールドでのみ作成
+	if (const UWorld* World = Cast<UWorld>(Outer))
+	{
+		return World->IsGameWorld();
+	}
+	return false;
+}
+
+TStatId UMeleeHitQuerySubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMeleeHitQuerySubsystem, STATGROUP_Tickables);
+}
+
+// ========================================================================
+// 更新
+// ========================================================================
+
+void UMeleeHitQuerySubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// ダメージ処理で振りが終了・追加されても良いよう後ろから走査
+	for (int32 i = Swings.Num() - 1; i >= 0; --i)
+	{
+		if (!Swings.IsValidIndex(i))
+		{
+			continue;
+		}
+
+		if (!Swings[i].Params.Owner.IsValid() || Swings[i].Params.Mesh.IsStale())
+		{
+			// 攻撃者かメッシュが破棄された（NotifyEnd が呼ばれなかった）
+			Swings.RemoveAtSwap(i, EAllowShrinking::No);
+			continue;
+		}
+
+		ProcessSwing(Swings[i]);
+	}
+}
+
+void UMeleeHitQuerySubsystem::ProcessSwing(FActiveSwing& Swing)
+{
+	DAWNLIGHT_SCOPE_CYCLE_COUNTER(STAT_DawnlightMeleeTrace);
+
+	FVector CurrentLocation;
+	if (!GetSwingLocation(Swing.Params, CurrentLocation))
+	{
+		return;
+	}
+
+	// 初回は現在位置のみ、以降は前フレームの位置からスイープ
+	const FVector StartLocation = Swing.bHasPreviousLocation ? Swing.PreviousLocation : CurrentLocation;
+	Swing.PreviousLocation = CurrentLocation;
+	Swing.bHasPreviousLocation = true;
+
+	UWorld* World = GetWorld();
+	const USpatialGridSubsystem* SpatialGrid = World->GetSubsystem<USpatialGridSubsystem>();
+	if (!SpatialGrid)
+	{
+		return;
+	}
+
+	// スイープ区間を覆う球内の候補を空間グリッドから取得し、1体ずつ厳密に判定する
+	const FVector SweepCenter = (StartLocation + CurrentLocation) * 0.5f;
+	const float SweepHalfLength = FVector::Dist(StartLocation, CurrentLocation) * 0.5f;
+	Candidates.Reset();
+	SpatialGrid->GetGrid().QueryRadius(SweepCenter, SweepHalfLength + Swing.Params.Radius + MaxTargetExtent, DawnlightSpatialCategory_All, Candidates);
+
+	// ダメージ処理で Swings が再確保されても良いよう、必要な値をコピーしておく
+	const uint32 SwingID = Swing.ID;
+	const FMeleeSwingParams Params = Swing.Params;
+	AActor* Attacker = Params.Owner.Get();
+
+	Candidates.RemoveAllSwap([&](const AActor* Candidate)
+	{
+		return !Candidate || Candidate == Attacker || !DoesSweepHitTarget(StartLocation, CurrentLocation, Params.Radius, Candidate);
+	}, EAllowShrinking::No);
+
+	if (Params.bShowDebug)
+	{
+		DrawDebugCapsule(World, SweepCenter, SweepHalfLength + Params.Radius,
+			Params.Radius, FRotationMatrix::MakeFromZ(CurrentLocation - StartLocation).ToQuat(),
+			Candidates.Num() > 0 ? FColor::Green : FColor::Red, false, 1.0f);
+	}
+
+	// ダメージ処理の中で Candidates が書き換わらないよう、このフレームの対象をコピーしておく
+	const TArray<AActor*, TInlineAllocator<16>> HitActors(Candidates);
+
+	for (AActor* HitActor : HitActors)
+	{
+		if (!IsValid(HitActor))
+		{
+			continue;
+		}
+
+		FActiveSwing* CurrentSwing = FindSwing(SwingID);
+		if (!CurrentSwing)
+		{
+			// ダメージ処理の中で振りが終了した
+			return;
+		}
+
+		// 重複チェック（1つの振りで同じアクターには1回だけ）
+		bool bAlreadyHit = false;
+		CurrentSwing->HitActors.Add(HitActor, &bAlreadyHit);
+		if (bAlreadyHit)
+		{
+			continue;
+		}
+
+		ApplyHit(Params, Attacker, HitActor);
+
+		UE_LOG(LogDawnlight, Log, TEXT("[MeleeHitQuerySubsystem] ヒット: %s"), *HitActor->GetName());
+	}
+}
+
+bool UMeleeHitQuerySubsystem::DoesSweepHitTarget(const FVector& Start, const FVector& End, float Radius, const AActor* Target)
+{
+	float TargetRadius = 0.0f;
+	float TargetHalfHeight = 0.0f;
+	Target->GetSimpleCollisionCylinder(TargetRadius, TargetHalfHeight);
+
+	// 対象の中心に最も近いスイープ上の点で、円柱と球が重なるか
+	const FVector TargetLocation = Target->GetActorLocation();
+	const FVector ClosestPoint = FMath::ClosestPointOnSegment(TargetLocation, Start, End);
+
+	return FVector::DistSquaredXY(ClosestPoint, TargetLocation) <= FMath::Square(Radius + TargetRadius)
+		&& FMath::Abs(ClosestPoint.Z - TargetLocation.Z) <= Radius + TargetHalfHeight;
+}
+
+bool UMeleeHitQuerySubsystem::GetSwingLocation(const FMeleeSwingParams& Params, FVector& OutLocation)
+{
+	const AActor* Owner = Params.Owner.Get();
+	if (!Owner)
+	{
+		return false;
+	}
+
+	const USkeletalMeshComponent* Mesh = Params.Mesh.Get();
+	if (Mesh && !Params.SocketName.IsNone() && Mesh->DoesSocketExist(Params.SocketName))
+	{
+		OutLocation = Mesh->GetSocketLocation(Params.SocketName);
+		return true;
+	}
+
+	// キャラクター前方
+	OutLocation = Owner->GetActorLocation() + Owner->GetActorForwardVector() * Params.ForwardOffset;
+	return true;
+}
+
+void UMeleeHitQuerySubsystem::ApplyHit(const FMeleeSwingParams& Params, AActor* Attacker, AActor* Target)
+{
+	if (!Attacker || !Target)
+	{
+		return;
+	}
+
+	// ダメージはパイプラインに積み、同じ対象へのヒットはフレーム末にまとめて適用
+	FDawnlightDamageRequest Request;
+	Request.Source = Attacker;
+	Request.Target = Target;
+	Request.Amount = Params.Damage;
+	Request.Tags.AddTag(SoulReaperTags::Damage_Type_Melee);
+
+	// ノックバック
+	if (Params.bApplyKnockback && Params.KnockbackForce > 0.0f)
+	{
+		FVector KnockbackDirection = (Target->GetActorLocation() - Attacker->GetActorLocation()).GetSafeNormal();
+		KnockbackDirection.Z = 0.3f; // 少し上向きに
+		KnockbackDirection.Normalize();
+
+		Request.KnockbackDirection = KnockbackDirection;
+		Request.KnockbackForce = Params.KnockbackForce;
+	}
+
+	UDamagePipelineSubsystem::QueueDamageInWorld(Request);
+}
+
+// ========================================================================
+// 振りの登録
+// ========================================================================
+
+FMeleeSwingHandle UMeleeHitQuerySubsystem::BeginSwing(const FMeleeSwingParams& Params)
+{
+	FMeleeSwingHandle Handle;
+
+	AActor* Owner = Params.Owner.Get();
+	if (!Owner)
+	{
+		return Handle;
+	}
+
+	FActiveSwing& Swing = Swings.AddDefaulted_GetRef();
+	Swing.ID = NextSwingID++;
+	Swing.Params = Params;
+
+	// 0 は無効なIDとして予約
+	if (NextSwingID == 0)
+	{
+		NextSwingID = 1;
+	}
+
+	Handle.ID = Swing.ID;
+	return Handle;
+}
+
+void UMeleeHitQuerySubsystem::EndSwing(FMeleeSwingHandle& Handle)
+{
+	const int32 Index = Swings.IndexOfByPredicate([&Handle](const FActiveSwing& Swing)
+	{
+		return Swing.ID == Handle.ID;
+	});
+
+	if (Index != INDEX_NONE)
+	{
+		Swings.RemoveAtSwap(Index, EAllowShrinking::No);
+	}
+
+	Handle.Invalidate();
+}
+
+bool UMeleeHitQuerySubsystem::IsSwingActive(const FMeleeSwingHandle& Handle) const
+{
+	return Handle.IsValid() && FindSwing(Handle.ID) != nullptr;
+}
+
+int32 UMeleeHitQuerySubsystem::GetSwingHitCount(const FMeleeSwingHandle& Handle) const
+{
+	const FActiveSwing* Swing = Handle.IsValid() ? FindSwing(Handle.ID) : nullptr;
+	return Swing ? Swing->HitActors.Num() : 0;
+}
+
+UMeleeHitQuerySubsystem::FActiveSwing* UMeleeHitQuerySubsystem::FindSwing(uint32 ID)
+{
+	return Swings.FindByPredicate([ID](const FActiveSwing& Swing)
+	{
+		return Swing.ID == ID;
+	});
+}
+
+const UMeleeHitQuerySubsystem::FActiveSwing* UMeleeHitQuerySubsystem::FindSwing(uint32 ID) const
+{
+	return Swings.FindByPredicate([ID](const FActiveSwing& Swing)
+	{
+		return Swing.ID == ID;
+	});
+}
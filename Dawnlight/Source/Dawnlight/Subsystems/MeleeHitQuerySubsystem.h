@@ -0,0 +1,151 @@
+// Soul Reaper - Dawnlight Project
+// Copyright (c) 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "MeleeHitQuerySubsystem.generated.h"
+
+class USkeletalMeshComponent;
+
+/**
+ * 近接攻撃の1回の振りの設定
+ */
+struct FMeleeSwingParams
+{
+	/** 攻撃者 */
+	TWeakObjectPtr<AActor> Owner;
+
+	/** 判定位置を取るメッシュ（ソケットを使う場合） */
+	TWeakObjectPtr<USkeletalMeshComponent> Mesh;
+
+	/** 判定位置のソケット（None の場合は攻撃者の前方 ForwardOffset の位置） */
+	FName SocketName = NAME_None;
+
+	/** 攻撃者前方へのオフセット（ソケットを使わない場合） */
+	float ForwardOffset = 100.0f;
+
+	/** 判定球の半径 */
+	float Radius = 100.0f;
+
+	/** ダメージ（攻撃者の DamageMultiplier 適用前） */
+	float Damage = 10.0f;
+
+	/** ヒット時にノックバックを与えるか */
+	bool bApplyKnockback = true;
+
+	/** ノックバック力 */
+	float KnockbackForce = 500.0f;
+
+	/** デバッグ表示 */
+	bool bShowDebug = false;
+};
+
+/**
+ * 近接攻撃の振りのハンドル
+ */
+struct FMeleeSwingHandle
+{
+	/** 振りのID（無効な場合は 0） */
+	uint32 ID = 0;
+
+	bool IsValid() const { return ID != 0; }
+	void Invalidate() { ID = 0; }
+};
+
+/**
+ * 近接攻撃ヒット判定サブシステム
+ *
+ * AnimNotifyState ごとのトレースを置き換え、進行中の全ての振りを1フレームに1回まとめて判定する
+ * - 振りごとにヒット済みアクターの TSet を持つ（同じモンタージュを再生する複数のメッシュで共有しない）
+ * - 前フレームの判定位置から現在位置までスイープし、速い振りでもすり抜けない
+ * - 候補は空間グリッドから取得し、物理シーンへのトレースは行わない
+ */
+UCLASS()
+class DAWNLIGHT_API UMeleeHitQuerySubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ========================================================================
+	// UWorldSubsystem インターフェース
+	// ========================================================================
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+	// ========================================================================
+	// FTickableGameObject インターフェース
+	// ========================================================================
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// ========================================================================
+	// 振りの登録
+	// ========================================================================
+
+	/** 振りを開始（このフレームの終わりから判定が始まる） */
+	FMeleeSwingHandle BeginSwing(const FMeleeSwingParams& Params);
+
+	/** 振りを終了（ハンドルは無効化される） */
+	void EndSwing(FMeleeSwingHandle& Handle);
+
+	/** 振りが進行中か */
+	bool IsSwingActive(const FMeleeSwingHandle& Handle) const;
+
+	/** 振りでヒットしたアクター数 */
+	int32 GetSwingHitCount(const FMeleeSwingHandle& Handle) const;
+
+	/** 進行中の振りの数 */
+	UFUNCTION(BlueprintPure, Category = "近接攻撃")
+	int32 GetActiveSwingCount() const { return Swings.Num(); }
+
+private:
+	/** 進行中の振り */
+	struct FActiveSwing
+	{
+		uint32 ID = 0;
+		FMeleeSwingParams Params;
+
+		/** 前フレームの判定位置 */
+		FVector PreviousLocation = FVector::ZeroVector;
+
+		/** 前フレームの判定位置が有効か */
+		bool bHasPreviousLocation = false;
+
+		/** この振りでヒット済みのアクター */
+		TSet<TObjectKey<AActor>> HitActors;
+	};
+
+	/** 進行中の振り */
+	TArray<FActiveSwing> Swings;
+
+	/** 次に発行するID */
+	uint32 NextSwingID = 1;
+
+	/** 空間グリッドから取得した候補（使い回し） */
+	TArray<AActor*> Candidates;
+
+	/** 候補を探す際に判定球の半径へ加える、対象のコリジョンの最大の広がり */
+	static constexpr float MaxTargetExtent = 250.0f;
+
+	/** 判定球が Start から End へ動いた時に対象のコリジョン（円柱で近似）に触れるか */
+	static bool DoesSweepHitTarget(const FVector& Start, const FVector& End, float Radius, const AActor* Target);
+
+	/** 振りの現在の判定位置を取得（攻撃者がいない場合は false） */
+	static bool GetSwingLocation(const FMeleeSwingParams& Params, FVector& OutLocation);
+
+	/** 1つの振りを判定 */
+	void ProcessSwing(FActiveSwing& Swing);
+
+	/** ヒットしたアクターへのダメージとノックバックをダメージパイプラインに積む */
+	static void ApplyHit(const FMeleeSwingParams& Params, AActor* Attacker, AActor* Target);
+
+	/** IDから振りを探す */
+	FActiveSwing* FindSwing(uint32 ID);
+	const FActiveSwing* FindSwing(uint32 ID) const;
+};
@@ -0,0 +1,181 @@
+// Soul Reaper - Dawnlight Project
+// Copyright (c) 2025. All Rights Reserved.
+
+#include "PlayerContextSubsystem.h"
+#include "Dawnlight.h"
+#include "Characters/DawnlightCharacter.h"
+#include "Abilities/DawnlightAttributeSet.h"
+#include "Components/ReaperModeComponent.h"
+#include "AbilitySystemComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "Kismet/GameplayStatics.h"
+
+void UPlayerContextSubsystem::Deinitialize()
+{
+	if (APlayerController* PC = PlayerController.Get())
+	{
+		PC->OnPossessedPawnChanged.RemoveDynamic(this, &UPlayerContextSubsystem::HandlePossessedPawnChanged);
+	}
+
+	if (APawn* Pawn = PlayerPawn.Get())
+	{
+		Pawn->OnDestroyed.RemoveDynamic(this, &UPlayerContextSubsystem::HandlePawnDestroyed);
+	}
+
+	PlayerController.Reset();
+	PlayerPawn.Reset();
+	PlayerCharacter.Reset();
+	AbilitySystemComponent.Reset();
+	AttributeSet.Reset();
+	ReaperModeComponent.Reset();
+
+	Super::Deinitialize();
+}
+
+bool UPlayerContextSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// ゲームワールドでのみ作成
+	if (const UWorld* World = Cast<UWorld>(Outer))
+	{
+		return World->IsGameWorld();
+	}
+	return false;
+}
+
+void UPlayerContextSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// BeginPlay 時点でログイン済みのローカルプレイヤー
+	RegisterPlayerController(InWorld.GetFirstPlayerController());
+}
+
+// ========================================================================
+// 登録
+// ========================================================================
+
+void UPlayerContextSubsystem::RegisterPlayerController(APlayerController* InPlayerController)
+{
+	if (!InPlayerController || !InPlayerController->IsLocalController() || PlayerController.Get() == InPlayerController)
+	{
+		return;
+	}
+
+	if (APlayerController* OldController = PlayerController.Get())
+	{
+		OldController->OnPossessedPawnChanged.RemoveDynamic(this, &UPlayerContextSubsystem::HandlePossessedPawnChanged);
+	}
+
+	PlayerController = InPlayerController;
+	InPlayerController->OnPossessedPawnChanged.AddUniqueDynamic(this, &UPlayerContextSubsystem::HandlePossessedPawnChanged);
+
+	SetPlayerPawn(InPlayerController->GetPawn());
+
+	UE_LOG(LogDawnlight, Log, TEXT("[PlayerContextSubsystem] プレイヤーコントローラーを登録: %s"), *InPlayerController->GetName());
+}
+
+void UPlayerContextSubsystem::SetPlayerPawn(APawn* NewPawn)
+{
+	if (PlayerPawn.Get() == NewPawn)
+	{
+		return;
+	}
+
+	if (APawn* OldPawn = PlayerPawn.Get())
+	{
+		OldPawn->OnDestroyed.RemoveDynamic(this, &UPlayerContextSubsystem::HandlePawnDestroyed);
+	}
+
+	PlayerPawn = NewPawn;
+	PlayerCharacter = Cast<ADawnlightCharacter>(NewPawn);
+
+	ADawnlightCharacter* Character = PlayerCharacter.Get();
+	AbilitySystemComponent = Character ? Character->GetAbilitySystemComponent() : nullptr;
+	AttributeSet = Character ? Character->GetDawnlightAttributeSet() : nullptr;
+	ReaperModeComponent = Character ? Character->GetReaperModeComponent() : nullptr;
+
+	if (NewPawn)
+	{
+		NewPawn->OnDestroyed.AddUniqueDynamic(this, &UPlayerContextSubsystem::HandlePawnDestroyed);
+	}
+
+	UE_LOG(LogDawnlight, Verbose, TEXT("[PlayerContextSubsystem] プレイヤーを更新: %s"), *GetNameSafe(NewPawn));
+
+	OnPlayerContextChanged.Broadcast(Character);
+}
+
+// ========================================================================
+// 取得
+// ========================================================================
+
+APawn* UPlayerContextSubsystem::GetPlayerPawnInWorld(const UObject* WorldContextObject)
+{
+	UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	if (const UPlayerContextSubsystem* PlayerContext = World->GetSubsystem<UPlayerContextSubsystem>())
+	{
+		return PlayerContext->GetPlayerPawn();
+	}
+
+	return UGameplayStatics::GetPlayerPawn(World, 0);
+}
+
+ADawnlightCharacter* UPlayerContextSubsystem::GetPlayerCharacterInWorld(const UObject* WorldContextObject)
+{
+	UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	if (const UPlayerContextSubsystem* PlayerContext = World->GetSubsystem<UPlayerContextSubsystem>())
+	{
+		return PlayerContext->GetPlayerCharacter();
+	}
+
+	return Cast<ADawnlightCharacter>(UGameplayStatics::GetPlayerPawn(World, 0));
+}
+
+bool UPlayerContextSubsystem::IsPlayerActorInWorld(const UObject* WorldContextObject, const AActor* Actor)
+{
+	if (!Actor)
+	{
+		return false;
+	}
+
+	UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+	if (!World)
+	{
+		return false;
+	}
+
+	if (const UPlayerContextSubsystem* PlayerContext = World->GetSubsystem<UPlayerContextSubsystem>())
+	{
+		return PlayerContext->IsPlayerActor(Actor);
+	}
+
+	return Actor == UGameplayStatics::GetPlayerPawn(World, 0);
+}
+
+// ========================================================================
+// イベントハンドラ
+// ========================================================================
+
+void UPlayerContextSubsystem::HandlePossessedPawnChanged(APawn* OldPawn, APawn* NewPawn)
+{
+	SetPlayerPawn(NewPawn);
+}
+
+void UPlayerContextSubsystem::HandlePawnDestroyed(AActor* DestroyedActor)
+{
+	if (DestroyedActor == PlayerPawn.Get())
+	{
+		SetPlayerPawn(nullptr);
+	}
+}
@@ -0,0 +1,109 @@
+// Soul Reaper - Dawnlight Project
+// Copyright (c) 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "PlayerContextSubsystem.generated.h"
+
+class APlayerController;
+class ADawnlightCharacter;
+class UAbilitySystemComponent;
+class UDawnlightAttributeSet;
+class UReaperModeComponent;
+
+/**
+ * プレイヤーコンテキストサブシステム
+ *
+ * ローカルプレイヤーのキャラクターと、そのアビリティシステム・属性セット・リーパーモードを
+ * 所持変更時にだけ解決してキャッシュする
+ * - 毎イベントの GetPlayerPawn + Cast を置き換える
+ * - 所持/所持解除（OnPossessedPawnChanged）とキャラクターの破棄でキャッシュを更新
+ * - 変更時に OnPlayerContextChanged を発火
+ */
+UCLASS()
+class DAWNLIGHT_API UPlayerContextSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ========================================================================
+	// UWorldSubsystem インターフェース
+	// ========================================================================
+
+	virtual void Deinitialize() override;
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	// ========================================================================
+	// 登録
+	// ========================================================================
+
+	/** ローカルプレイヤーコントローラーを登録（所持変更を監視、登録済みなら何もしない） */
+	void RegisterPlayerController(APlayerController* InPlayerController);
+
+	// ========================================================================
+	// 取得
+	// ========================================================================
+
+	/** プレイヤーのポーン（未所持なら null） */
+	UFUNCTION(BlueprintPure, Category = "プレイヤー")
+	APawn* GetPlayerPawn() const { return PlayerPawn.Get(); }
+
+	/** プレイヤーキャラクター（ADawnlightCharacter 以外を所持中なら null） */
+	UFUNCTION(BlueprintPure, Category = "プレイヤー")
+	ADawnlightCharacter* GetPlayerCharacter() const { return PlayerCharacter.Get(); }
+
+	/** プレイヤーのアビリティシステムコンポーネント */
+	UAbilitySystemComponent* GetAbilitySystemComponent() const { return AbilitySystemComponent.Get(); }
+
+	/** プレイヤーの属性セット */
+	UDawnlightAttributeSet* GetAttributeSet() const { return AttributeSet.Get(); }
+
+	/** プレイヤーのリーパーモードコンポーネント */
+	UReaperModeComponent* GetReaperModeComponent() const { return ReaperModeComponent.Get(); }
+
+	/** アクターがプレイヤーのポーンかどうか */
+	bool IsPlayerActor(const AActor* Actor) const { return Actor && Actor == PlayerPawn.Get(); }
+
+	/** プレイヤーのポーンを取得（サブシステムがない場合は GetPlayerPawn） */
+	static APawn* GetPlayerPawnInWorld(const UObject* WorldContextObject);
+
+	/** プレイヤーキャラクターを取得（サブシステムがない場合は GetPlayerPawn + Cast） */
+	static ADawnlightCharacter* GetPlayerCharacterInWorld(const UObject* WorldContextObject);
+
+	/** アクターがプレイヤーのポーンかどうか（サブシステムがない場合は GetPlayerPawn と比較） */
+	static bool IsPlayerActorInWorld(const UObject* WorldContextObject, const AActor* Actor);
+
+	// ========================================================================
+	// イベント
+	// ========================================================================
+
+	/** プレイヤーキャラクター変更時（所持解除・破棄時は null） */
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPlayerContextChanged, ADawnlightCharacter*, NewCharacter);
+	UPROPERTY(BlueprintAssignable, Category = "プレイヤー|イベント")
+	FOnPlayerContextChanged OnPlayerContextChanged;
+
+private:
+	/** 所持中のポーンからキャッシュを更新 */
+	void SetPlayerPawn(APawn* NewPawn);
+
+	/** 所持変更時 */
+	UFUNCTION()
+	void HandlePossessedPawnChanged(APawn* OldPawn, APawn* NewPawn);
+
+	/** プレイヤーのポーン破棄時 */
+	UFUNCTION()
+	void HandlePawnDestroyed(AActor* DestroyedActor);
+
+	/** 監視中のプレイヤーコントローラー */
+	TWeakObjectPtr<APlayerController> PlayerController;
+
+	/** キャッシュ */
+	TWeakObjectPtr<APawn> PlayerPawn;
+	TWeakObjectPtr<ADawnlightCharacter> PlayerCharacter;
+	TWeakObjectPtr<UAbilitySystemComponent> AbilitySystemComponent;
+	TWeakObjectPtr<UDawnlightAttributeSet> AttributeSet;
+	TWeakObjectPtr<UReaperModeComponent> ReaperModeComponent;
+};
@@ -0,0 +1,342 @@
+// Soul Reaper - Dawnlight Project
+// Copyright (c) 2025. All Rights Reserved.
+
+#include "PlayerFlowFieldSubsystem.h"
+#include "Dawnlight.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "Kismet/GameplayStatics.h"
+#include "NavigationSystem.h"
+
+namespace
+{
+	/** 8近傍のオフセット（0-3: 直交、4-7: 斜め） */
+	const FIntPoint NeighborOffsets[8] =
+	{
+		FIntPoint(1, 0), FIntPoint(-1, 0), FIntPoint(0, 1), FIntPoint(0, -1),
+		FIntPoint(1, 1), FIntPoint(1, -1), FIntPoint(-1, 1), FIntPoint(-1, -1)
+	};
+
+	/** 8近傍の正規化済み方向 */
+	const FVector NeighborDirections[8] =
+	{
+		FVector(1.0f, 0.0f, 0.0f), FVector(-1.0f, 0.0f, 0.0f), FVector(0.0f, 1.0f, 0.0f), FVector(0.0f, -1.0f, 0.0f),
+		FVector(UE_INV_SQRT_2, UE_INV_SQRT_2, 0.0f), FVector(UE_INV_SQRT_2, -UE_INV_SQRT_2, 0.0f),
+		FVector(-UE_INV_SQRT_2, UE_INV_SQRT_2, 0.0f), FVector(-UE_INV_SQRT_2, -UE_INV_SQRT_2, 0.0f)
+	};
+}
+
+void UPlayerFlowFieldSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	UE_LOG(LogDawnlight, Log, TEXT("[PlayerFlowFieldSubsystem] 初期化完了"));
+}
+
+void UPlayerFlowFieldSubsystem::Deinitialize()
+{
+	UE_LOG(LogDawnlight, Log, TEXT("[PlayerFlowFieldSubsystem] 終了処理（再構築: %d回）"), RebuildCount);
+
+	IntegrationField.Empty();
+	FlowDirections.Empty();
+	OpenList.Empty();
+	WalkableCacheCells.Empty();
+	WalkableCache.Empty();
+	CachedPlayer.Reset();
+	bHasField = false;
+
+	Super::Deinitialize();
+}
+
+bool UPlayerFlowFieldSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// ゲームワールドでのみ作成
+	if (const UWorld* World = Cast<UWorld>(Outer))
+	{
+		return World->IsGameWorld();
+	}
+	return false;
+}
+
+TStatId UPlayerFlowFieldSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UPlayerFlowFieldSubsystem, STATGROUP_Tickables);
+}
+
+// ========================================================================
+// 更新
+// ========================================================================
+
+void UPlayerFlowFieldSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (!CachedPlayer.IsValid())
+	{
+		CachedPlayer = UGameplayStatics::GetPlayerPawn(GetWorld(), 0);
+		if (!CachedPlayer.IsValid())
+		{
+			return;
+		}
+	}
+
+	// 設定が変わった場合は確保し直す
+	if (FieldHalfExtent != HalfExtentCells || FieldCellSize != CellSize)
+	{
+		AllocateField();
+	}
+
+	const FVector PlayerLocation = CachedPlayer->GetActorLocation();
+	const FIntPoint PlayerCell = WorldToCell(PlayerLocation);
+
+	// プレイヤーが同じセルにいて、投影待ちもなければ何もしない
+	if (bHasField && PlayerCell == CenterCell && !bWalkabilityPending)
+	{
+		return;
+	}
+
+	CenterCell = PlayerCell;
+	ReferenceZ = PlayerLocation.Z;
+
+	bWalkabilityPending = !UpdateWalkability();
+	BuildIntegrationField();
+	BuildFlowDirections();
+
+	bHasField = true;
+	++RebuildCount;
+}
+
+void UPlayerFlowFieldSubsystem::InvalidateField()
+{
+	for (FIntPoint& Cell : WalkableCacheCells)
+	{
+		Cell = FIntPoint(MAX_int32, MAX_int32);
+	}
+
+	bWalkabilityPending = WalkableCacheCells.Num() > 0;
+}
+
+// ========================================================================
+// クエリ
+// ========================================================================
+
+bool UPlayerFlowFieldSubsystem::GetFlowDirection(FVector Location, FVector& OutDirection) const
+{
+	if (!bHasField)
+	{
+		return false;
+	}
+
+	const int32 LocalIndex = GetLocalIndex(WorldToCell(Location));
+	if (LocalIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	const uint8 Direction = FlowDirections[LocalIndex];
+	if (Direction == NoFlowDirection)
+	{
+		return false;
+	}
+
+	OutDirection = NeighborDirections[Direction];
+	return true;
+}
+
+// ========================================================================
+// 内部処理
+// ========================================================================
+
+void UPlayerFlowFieldSubsystem::AllocateField()
+{
+	FieldCellSize = CellSize;
+	FieldHalfExtent = HalfExtentCells;
+	FieldDim = FieldHalfExtent * 2 + 1;
+
+	const int32 CellCount = FieldDim * FieldDim;
+	IntegrationField.Init(UnreachableCost, CellCount);
+	FlowDirections.Init(NoFlowDirection, CellCount);
+	WalkableCacheCells.Init(FIntPoint(MAX_int32, MAX_int32), CellCount);
+	WalkableCache.Init(1, CellCount);
+	OpenList.Reset(CellCount);
+
+	bHasField = false;
+	bWalkabilityPending = false;
+
+	UE_LOG(LogDawnlight, Log, TEXT("[PlayerFlowFieldSubsystem] フィールド確保: %dx%d（セルサイズ: %.0f）"), FieldDim, FieldDim, FieldCellSize);
+}
+
+bool UPlayerFlowFieldSubsystem::UpdateWalkability()
+{
+	const UNavigationSystemV1* NavSystem = UNavigationSystemV1::GetCurrent<UNavigationSystemV1>(GetWorld());
+	const bool bHasNavData = NavSystem && NavSystem->GetDefaultNavDataInstance() != nullptr;
+	const FVector ProjectionExtent(FieldCellSize * 0.5f, FieldCellSize * 0.5f, NavProjectionHeight);
+
+	int32 ProjectionBudget = MaxNavProjectionsPerTick;
+	bool bComplete = true;
+
+	for (int32 LocalY = 0; LocalY < FieldDim; ++LocalY)
+	{
+		for (int32 LocalX = 0; LocalX < FieldDim; ++LocalX)
+		{
+			const FIntPoint Cell(CenterCell.X - FieldHalfExtent + LocalX, CenterCell.Y - FieldHalfExtent + LocalY);
+			const int32 Slot = GetCacheSlot(Cell);
+
+			// 以前の構築で投影済みのセルは再利用
+			if (WalkableCacheCells[Slot] == Cell)
+			{
+				continue;
+			}
+
+			// ナビメッシュがない場合は全て通行可能として扱う
+			if (!bHasNavData)
+			{
+				WalkableCacheCells[Slot] = Cell;
+				WalkableCache[Slot] = 1;
+				continue;
+			}
+
+			if (ProjectionBudget <= 0)
+			{
+				// 投影されるまでは通行可能として扱う（スロットは未投影のまま）
+				WalkableCacheCells[Slot] = FIntPoint(MAX_int32, MAX_int32);
+				WalkableCache[Slot] = 1;
+				bComplete = false;
+				continue;
+			}
+
+			const FVector CellCenter((Cell.X + 0.5f) * FieldCellSize, (Cell.Y + 0.5f) * FieldCellSize, ReferenceZ);
+			FNavLocation NavLocation;
+			WalkableCacheCells[Slot] = Cell;
+			WalkableCache[Slot] = NavSystem->ProjectPointToNavigation(CellCenter, NavLocation, ProjectionExtent) ? 1 : 0;
+			--ProjectionBudget;
+		}
+	}
+
+	return bComplete;
+}
+
+void UPlayerFlowFieldSubsystem::BuildIntegrationField()
+{
+	for (uint16& Cost : IntegrationField)
+	{
+		Cost = UnreachableCost;
+	}
+
+	// プレイヤーのセルは通行不可（ジャンプ中など）でも起点にする
+	const int32 StartIndex = FieldHalfExtent * FieldDim + FieldHalfExtent;
+	IntegrationField[StartIndex] = 0;
+
+	OpenList.Reset();
+	OpenList.Add(StartIndex);
+
+	// 一様コストなのでBFSがダイクストラと同じ結果になる
+	for (int32 Head = 0; Head < OpenList.Num(); ++Head)
+	{
+		const int32 Current = OpenList[Head];
+		const int32 CurrentX = Current % FieldDim;
+		const int32 CurrentY = Current / FieldDim;
+		const uint16 NextCost = IntegrationField[Current] + 1;
+
+		for (int32 Dir = 0; Dir < 4; ++Dir)
+		{
+			const int32 NextX = CurrentX + NeighborOffsets[Dir].X;
+			const int32 NextY = CurrentY + NeighborOffsets[Dir].Y;
+			if (!IsLocalCellWalkable(NextX, NextY))
+			{
+				continue;
+			}
+
+			const int32 Next = NextY * FieldDim + NextX;
+			if (IntegrationField[Next] != UnreachableCost)
+			{
+				continue;
+			}
+
+			IntegrationField[Next] = NextCost;
+			OpenList.Add(Next);
+		}
+	}
+}
+
+void UPlayerFlowFieldSubsystem::BuildFlowDirections()
+{
+	for (int32 LocalY = 0; LocalY < FieldDim; ++LocalY)
+	{
+		for (int32 LocalX = 0; LocalX < FieldDim; ++LocalX)
+		{
+			const int32 Index = LocalY * FieldDim + LocalX;
+			FlowDirections[Index] = NoFlowDirection;
+
+			const uint16 Cost = IntegrationField[Index];
+			if (Cost == 0 || Cost == UnreachableCost)
+			{
+				continue;
+			}
+
+			// 斜めは積分コストが2下がるため、直線的に進める場合は自然に斜めが選ばれる
+			uint16 BestCost = Cost;
+			for (int32 Dir = 0; Dir < 8; ++Dir)
+			{
+				const FIntPoint& Offset = NeighborOffsets[Dir];
+				const int32 NextX = LocalX + Offset.X;
+				const int32 NextY = LocalY + Offset.Y;
+				if (NextX < 0 || NextX >= FieldDim || NextY < 0 || NextY >= FieldDim)
+				{
+					continue;
+				}
+
+				// 斜め移動は両側の直交セルが通れる場合のみ（壁の角に引っかからないように）
+				if (Dir >= 4 && (!IsLocalCellWalkable(LocalX + Offset.X, LocalY) || !IsLocalCellWalkable(LocalX, LocalY + Offset.Y)))
+				{
+					continue;
+				}
+
+				const uint16 NextCost = IntegrationField[NextY * FieldDim + NextX];
+				if (NextCost < BestCost)
+				{
+					BestCost = NextCost;
+					FlowDirections[Index] = static_cast<uint8>(Dir);
+				}
+			}
+		}
+	}
+}
+
+FIntPoint UPlayerFlowFieldSubsystem::WorldToCell(const FVector& Location) const
+{
+	return FIntPoint(
+		FMath::FloorToInt32(Location.X / FieldCellSize),
+		FMath::FloorToInt32(Location.Y / FieldCellSize)
+	);
+}
+
+int32 UPlayerFlowFieldSubsystem::GetCacheSlot(const FIntPoint& Cell) const
+{
+	// 負の座標でも0以上になるよう剰余を取る
+	const int32 SlotX = ((Cell.X % FieldDim) + FieldDim) % FieldDim;
+	const int32 SlotY = ((Cell.Y % FieldDim) + FieldDim) % FieldDim;
+	return SlotY * FieldDim + SlotX;
+}
+
+int32 UPlayerFlowFieldSubsystem::GetLocalIndex(const FIntPoint& Cell) const
+{
+	const int32 LocalX = Cell.X - CenterCell.X + FieldHalfExtent;
+	const int32 LocalY = Cell.Y - CenterCell.Y + FieldHalfExtent;
+	if (LocalX < 0 || LocalX >= FieldDim || LocalY < 0 || LocalY >= FieldDim)
+	{
+		return INDEX_NONE;
+	}
+	return LocalY * FieldDim + LocalX;
+}
+
+bool UPlayerFlowFieldSubsystem::IsLocalCellWalkable(int32 LocalX, int32 LocalY) const
+{
+	if (LocalX < 0 || LocalX >= FieldDim || LocalY < 0 || LocalY >= FieldDim)
+	{
+		return false;
+	}
+
+	const FIntPoint Cell(CenterCell.X - FieldHalfExtent + LocalX, CenterCell.Y - FieldHalfExtent + LocalY);
+	return WalkableCache[GetCacheSlot(Cell)] != 0;
+}
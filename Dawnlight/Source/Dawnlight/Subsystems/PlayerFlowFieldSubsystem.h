@@ -0,0 +1,171 @@
+// Soul Reaper - Dawnlight Project
+// Copyright (c) 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "PlayerFlowFieldSubsystem.generated.h"
+
+/**
+ * プレイヤー追跡用フローフィールドサブシステム
+ *
+ * プレイヤーを中心としたグリッド上に、プレイヤーへ向かう移動方向を事前計算する
+ * - 各セルの通行可否はナビメッシュへの投影で判定し、ワールド座標基準でキャッシュ
+ * - プレイヤーがセルをまたいだ時だけ再構築（新しく範囲に入ったセルのみ投影し直す）
+ * - 積分フィールドはBFS、移動方向は8近傍の最小コスト方向（壁の角はすり抜けない）
+ * - 追跡中の全ての敵が共有し、1体あたりの経路計算をセル参照だけにする
+ */
+UCLASS()
+class DAWNLIGHT_API UPlayerFlowFieldSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ========================================================================
+	// UWorldSubsystem インターフェース
+	// ========================================================================
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+	// ========================================================================
+	// FTickableGameObject インターフェース
+	// ========================================================================
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// ========================================================================
+	// クエリ
+	// ========================================================================
+
+	/**
+	 * 位置からプレイヤーへ向かう移動方向を取得（水平・正規化済み）
+	 * フィールド外・到達不能・プレイヤーと同じセルの場合は false（直接プレイヤーへ向かうこと）
+	 */
+	UFUNCTION(BlueprintCallable, Category = "フローフィールド")
+	bool GetFlowDirection(FVector Location, FVector& OutDirection) const;
+
+	/** フィールドが構築済みか */
+	UFUNCTION(BlueprintPure, Category = "フローフィールド")
+	bool IsFieldValid() const { return bHasField; }
+
+	/** 起動後の再構築回数 */
+	UFUNCTION(BlueprintPure, Category = "フローフィールド")
+	int32 GetRebuildCount() const { return RebuildCount; }
+
+	/** 通行可否のキャッシュを破棄して作り直す（障害物が変化した場合など） */
+	UFUNCTION(BlueprintCallable, Category = "フローフィールド")
+	void InvalidateField();
+
+	// ========================================================================
+	// 設定
+	// ========================================================================
+
+	/** セルの一辺の長さ */
+	UPROPERTY(EditAnywhere, Category = "フローフィールド", meta = (ClampMin = "25.0"))
+	float CellSize = 100.0f;
+
+	/** プレイヤーから各方向に何セル分のフィールドを作るか */
+	UPROPERTY(EditAnywhere, Category = "フローフィールド", meta = (ClampMin = "4", ClampMax = "128"))
+	int32 HalfExtentCells = 40;
+
+	/** 1フレームあたりのナビメッシュ投影の上限（残りは次のフレーム以降） */
+	UPROPERTY(EditAnywhere, Category = "フローフィールド", meta = (ClampMin = "1"))
+	int32 MaxNavProjectionsPerTick = 1024;
+
+	/** ナビメッシュ投影の上下の探索範囲 */
+	UPROPERTY(EditAnywhere, Category = "フローフィールド", meta = (ClampMin = "0.0"))
+	float NavProjectionHeight = 300.0f;
+
+private:
+	/** 到達不能を表す積分コスト */
+	static constexpr uint16 UnreachableCost = MAX_uint16;
+
+	/** 移動方向なしを表す値 */
+	static constexpr uint8 NoFlowDirection = MAX_uint8;
+
+	// ========================================================================
+	// フィールドデータ（ローカルインデックス = Y * FieldDim + X）
+	// ========================================================================
+
+	/** 構築時のセルサイズ */
+	float FieldCellSize = 0.0f;
+
+	/** 構築時の半径（セル数） */
+	int32 FieldHalfExtent = 0;
+
+	/** 一辺のセル数 */
+	int32 FieldDim = 0;
+
+	/** フィールド中心（プレイヤーのいるセル） */
+	FIntPoint CenterCell = FIntPoint::ZeroValue;
+
+	/** 投影の基準高さ */
+	float ReferenceZ = 0.0f;
+
+	/** 積分コスト（プレイヤーのセルからの距離） */
+	TArray<uint16> IntegrationField;
+
+	/** 移動方向（8近傍のインデックス） */
+	TArray<uint8> FlowDirections;
+
+	/** BFSのキュー（使い回し） */
+	TArray<int32> OpenList;
+
+	// ========================================================================
+	// 通行可否キャッシュ（ワールドのセル座標でリング状に格納）
+	// ========================================================================
+
+	/** 各スロットが保持しているセル座標 */
+	TArray<FIntPoint> WalkableCacheCells;
+
+	/** 各スロットの通行可否 */
+	TArray<uint8> WalkableCache;
+
+	// ========================================================================
+	// 状態
+	// ========================================================================
+
+	/** フィールドが構築済みか */
+	bool bHasField = false;
+
+	/** 未投影のセルが残っているか */
+	bool bWalkabilityPending = false;
+
+	/** 再構築回数 */
+	int32 RebuildCount = 0;
+
+	/** プレイヤーへの参照（キャッシュ） */
+	TWeakObjectPtr<AActor> CachedPlayer;
+
+	// ========================================================================
+	// 内部処理
+	// ========================================================================
+
+	/** 設定に合わせて配列を確保し直す */
+	void AllocateField();
+
+	/** 範囲内の未投影セルを投影する（全て済んだら true） */
+	bool UpdateWalkability();
+
+	/** プレイヤーのセルからBFSで積分フィールドを作る */
+	void BuildIntegrationField();
+
+	/** 積分フィールドから各セルの移動方向を決める */
+	void BuildFlowDirections();
+
+	/** ワールド座標 → セル座標 */
+	FIntPoint WorldToCell(const FVector& Location) const;
+
+	/** セル座標 → キャッシュのスロット */
+	int32 GetCacheSlot(const FIntPoint& Cell) const;
+
+	/** セル座標 → ローカルインデックス（範囲外は INDEX_NONE） */
+	int32 GetLocalIndex(const FIntPoint& Cell) const;
+
+	/** ローカル座標のセルが通行可能か */
+	bool IsLocalCellWalkable(int32 LocalX, int32 LocalY) const;
+};
@@ -3,10 +3,18 @@
 
 #include "SoulCollectionSubsystem.h"
 #include "Dawnlight.h"
+#include "DawnlightStats.h"
+#include "DawnlightTags.h"
 #include "Abilities/DawnlightAttributeSet.h"
+#include "Abilities/SoulBuffGameplayEffect.h"
 #include "Characters/DawnlightCharacter.h"
+#include "Subsystems/DawnlightAssetPreloader.h"
+#include "Subsystems/PlayerContextSubsystem.h"
+#include "AbilitySystemComponent.h"
 #include "Engine/AssetManager.h"
-#include "Kismet/GameplayStatics.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Soul Events Drained"), STAT_DawnlightSoulEventsDrained, STATGROUP_DawnlightSouls);
+DECLARE_CYCLE_STAT(TEXT("Soul Event Drain"), STAT_DawnlightSoulEventDrain, STATGROUP_DawnlightSouls);
 
 // ========================================================================
 // UWorldSubsystem インターフェース
@@ -20,6 +28,11 @@ void USoulCollectionSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 	InitializeDefaultComboThresholds();
 	InitializeDefaultSetBonuses();
 
+	// 収集イベントキューを確保
+	SoulEventQueue.SetNum(FMath::Max(SoulEventQueueCapacity, 1));
+	SoulEventHead = 0;
+	SoulEventCount = 0;
+
 	UE_LOG(LogDawnlight, Log, TEXT("SoulCollectionSubsystem: 初期化完了"));
 }
 
@@ -28,10 +41,15 @@ void USoulCollectionSubsystem::Deinitialize()
 	// クリーンアップ
 	ClearSouls();
 	SoulDataMap.Empty();
-	AppliedBuffs.Empty();
+	AppliedBuffHandles.Empty();
+	BuffTargetASC.Reset();
 	ComboInfo = FComboKillInfo();
 	SetBonusDefinitions.Empty();
-	AchievedSetBonuses.Empty();
+	SetBonusSlots.Empty();
+	SetBonusTracker.Reset();
+	SoulEventQueue.Empty();
+	SoulEventHead = 0;
+	SoulEventCount = 0;
 
 	Super::Deinitialize();
 
@@ -48,11 +66,23 @@ bool USoulCollectionSubsystem::ShouldCreateSubsystem(UObject* Outer) const
 	return false;
 }
 
+TStatId USoulCollectionSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USoulCollectionSubsystem, STATGROUP_Tickables);
+}
+
+void USoulCollectionSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	DrainSoulEvents(MaxSoulEventsPerFrame);
+}
+
 // ========================================================================
 // 魂収集
 // ========================================================================
 
-bool USoulCollectionSubsystem::CollectSoul(const FGameplayTag& SoulTag, const FVector& CollectionLocation)
+bool USoulCollectionSubsystem::CollectSoul(const FGameplayTag& SoulTag, const FVector& CollectionLocation, bool bFromKill)
 {
 	if (!SoulTag.IsValid())
 	{
@@ -68,47 +98,154 @@ bool USoulCollectionSubsystem::CollectSoul(const FGameplayTag& SoulTag, const FV
 		return false;
 	}
 
-	return CollectSoulFromData(SoulData, CollectionLocation);
+	return CollectSoulFromData(SoulData, CollectionLocation, bFromKill);
 }
 
-bool USoulCollectionSubsystem::CollectSoulFromData(const USoulDataAsset* SoulData, const FVector& CollectionLocation)
+bool USoulCollectionSubsystem::CollectSoulFromData(const USoulDataAsset* SoulData, const FVector& CollectionLocation, bool bFromKill)
 {
+	DAWNLIGHT_SCOPE_CYCLE_COUNTER(STAT_DawnlightCollectSoul);
+
 	if (!SoulData)
 	{
 		return false;
 	}
 
-	// 魂をコレクションに追加
-	CollectedSouls.AddSoul(SoulData->SoulTag, 1);
+	// ゲージ・コンボ・セットボーナス・通知はフレームの終わりにまとめて処理
+	EnqueueSoulEvent(SoulData, CollectionLocation, bFromKill);
+	return true;
+}
+
+void USoulCollectionSubsystem::FlushSoulEvents()
+{
+	DrainSoulEvents(0);
+}
+
+void USoulCollectionSubsystem::EnqueueSoulEvent(const USoulDataAsset* SoulData, const FVector& Location, bool bFromKill)
+{
+	// 満杯の場合は容量を倍にして並べ直す（魂を取りこぼさない）
+	if (SoulEventCount >= SoulEventQueue.Num())
+	{
+		const int32 OldCapacity = SoulEventQueue.Num();
+		const int32 NewCapacity = FMath::Max(OldCapacity * 2, FMath::Max(SoulEventQueueCapacity, 1));
+
+		TArray<FPendingSoulEvent> NewQueue;
+		NewQueue.SetNum(NewCapacity);
+		for (int32 i = 0; i < SoulEventCount; ++i)
+		{
+			NewQueue[i] = MoveTemp(SoulEventQueue[(SoulEventHead + i) % OldCapacity]);
+		}
+
+		SoulEventQueue = MoveTemp(NewQueue);
+		SoulEventHead = 0;
+
+		if (OldCapacity > 0)
+		{
+			UE_LOG(LogDawnlight, Warning, TEXT("SoulCollectionSubsystem: 収集イベントキューを拡張 (%d → %d)"), OldCapacity, NewCapacity);
+		}
+	}
+
+	FPendingSoulEvent& Event = SoulEventQueue[(SoulEventHead + SoulEventCount) % SoulEventQueue.Num()];
+	Event.SoulData = SoulData;
+	Event.Location = Location;
+	Event.bFromKill = bFromKill;
+	++SoulEventCount;
+}
+
+void USoulCollectionSubsystem::DrainSoulEvents(int32 MaxEvents)
+{
+	if (SoulEventCount == 0)
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_DawnlightSoulEventDrain);
+
+	const int32 NumToDrain = MaxEvents > 0 ? FMath::Min(SoulEventCount, MaxEvents) : SoulEventCount;
+	const float CurrentTime = GetWorld()->GetTimeSeconds();
+
+	// 個数が変わった魂の種類（セットボーナス判定用）
+	TArray<FGameplayTag, TInlineAllocator<8>> ChangedSouls;
+
+	float ReaperGaugeGain = 0.0f;
+	int32 KillCount = 0;
+	int32 BonusSouls = 0;
+	int32 CollectedCount = 0;
+	const USoulDataAsset* LastSoulData = nullptr;
+	FVector LastLocation = FVector::ZeroVector;
+
+	for (int32 i = 0; i < NumToDrain; ++i)
+	{
+		FPendingSoulEvent& Event = SoulEventQueue[SoulEventHead];
+		SoulEventHead = (SoulEventHead + 1) % SoulEventQueue.Num();
+		--SoulEventCount;
+
+		const USoulDataAsset* SoulData = Event.SoulData.Get();
+		Event.SoulData.Reset();
+		if (!SoulData)
+		{
+			continue;
+		}
+
+		const FGameplayTag& SoulTag = SoulData->SoulTag;
+		ChangedSouls.AddUnique(SoulTag);
+
+		// 魂をコレクションに追加
+		CollectedSouls.AddSoul(SoulTag, 1);
+		ReaperGaugeGain += SoulData->ReaperGaugeGain;
+		++CollectedCount;
+
+		// キルによる収集はコンボに加算
+		if (Event.bFromKill)
+		{
+			BonusSouls += RecordKillInternal(CurrentTime);
+			++KillCount;
+		}
+
+		LastSoulData = SoulData;
+		LastLocation = Event.Location;
+	}
+
+	DrainedSoulEventCount += NumToDrain;
+	INC_DWORD_STAT_BY(STAT_DawnlightSoulEventsDrained, NumToDrain);
 
-	// 新しいカウントを取得
-	const int32 NewCount = GetSoulCount(SoulData->SoulTag);
+	if (CollectedCount == 0)
+	{
+		return;
+	}
 
 	// プレイヤーキャラクターのリーパーゲージを増加
-	if (APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(GetWorld(), 0))
+	if (ReaperGaugeGain > 0.0f)
 	{
-		if (ADawnlightCharacter* PlayerCharacter = Cast<ADawnlightCharacter>(PlayerPawn))
+		if (ADawnlightCharacter* PlayerCharacter = UPlayerContextSubsystem::GetPlayerCharacterInWorld(this))
 		{
-			PlayerCharacter->AddReaperGauge(SoulData->ReaperGaugeGain);
+			PlayerCharacter->AddReaperGauge(ReaperGaugeGain);
 		}
 	}
 
-	// セットボーナスの達成をチェック
-	CheckSetBonusAchievement(SoulData->SoulTag, NewCount);
+	// セットボーナスの達成をチェック（種類ごとに1回）
+	for (const FGameplayTag& SoulTag : ChangedSouls)
+	{
+		CheckSetBonusAchievement(SoulTag, GetSoulCount(SoulTag));
+	}
+
+	// コンボ更新を通知
+	if (KillCount > 0)
+	{
+		OnComboUpdated.Broadcast(ComboInfo.CurrentCombo, BonusSouls);
+	}
 
-	// イベントデータを作成
+	// イベントデータを作成（最後に収集した魂で代表）
 	FSoulCollectedEventData EventData;
-	EventData.SoulData = const_cast<USoulDataAsset*>(SoulData);
-	EventData.CollectionLocation = CollectionLocation;
+	EventData.SoulData = const_cast<USoulDataAsset*>(LastSoulData);
+	EventData.CollectionLocation = LastLocation;
 	EventData.TotalSoulCount = GetTotalSoulCount();
+	EventData.CollectedCount = CollectedCount;
 
 	// デリゲートを発火
 	OnSoulCollected.Broadcast(EventData);
 
-	UE_LOG(LogDawnlight, Log, TEXT("SoulCollectionSubsystem: 魂を収集 - %s (個数: %d, 総数: %d, ゲージ+%.0f)"),
-		*SoulData->DisplayNameEN, NewCount, EventData.TotalSoulCount, SoulData->ReaperGaugeGain);
-
-	return true;
+	UE_LOG(LogDawnlight, Log, TEXT("SoulCollectionSubsystem: 魂を収集 - %d個 (最後: %s, 総数: %d, ゲージ+%.0f, 残り: %d)"),
+		CollectedCount, LastSoulData ? *LastSoulData->DisplayNameEN : TEXT("None"), EventData.TotalSoulCount, ReaperGaugeGain, SoulEventCount);
 }
 
 int32 USoulCollectionSubsystem::GetSoulCount(const FGameplayTag& SoulTag) const
@@ -123,6 +260,17 @@ int32 USoulCollectionSubsystem::GetTotalSoulCount() const
 
 void USoulCollectionSubsystem::ClearSouls()
 {
+	// 処理待ちのイベントも破棄
+	for (FPendingSoulEvent& Event : SoulEventQueue)
+	{
+		Event.SoulData.Reset();
+	}
+	SoulEventHead = 0;
+	SoulEventCount = 0;
+
+	// 新しい夜はセットボーナスも最初から
+	SetBonusTracker.ResetCounts();
+
 	CollectedSouls.Clear();
 	UE_LOG(LogDawnlight, Log, TEXT("SoulCollectionSubsystem: 魂コレクションをクリア"));
 }
@@ -177,104 +325,164 @@ void USoulCollectionSubsystem::ApplyCollectedBuffs(UDawnlightAttributeSet* Targe
 		return;
 	}
 
-	// 現在のバフをクリア
-	AppliedBuffs.Empty();
+	UAbilitySystemComponent* ASC = TargetAttributeSet->GetOwningAbilitySystemComponent();
+	if (!ASC)
+	{
+		UE_LOG(LogDawnlight, Warning, TEXT("SoulCollectionSubsystem: AbilitySystemComponentが見つかりません"));
+		return;
+	}
+
+	// 前回のバフを除去（二重適用防止）
+	ClearAppliedBuffs(TargetAttributeSet);
+
+	// 処理待ちの魂も数える
+	FlushSoulEvents();
+
+	// 魂の種類 × バフ定義ごとに集計（魂の数だけループしない）
+	TMap<TSubclassOf<USoulBuffGameplayEffect>, FAggregatedSoulBuff> AggregatedBuffs;
+	float ReaperGaugeGain = 0.0f;
 
-	// 収集した魂ごとにバフを適用
 	for (const auto& SoulPair : CollectedSouls.CollectedSouls)
 	{
 		const FGameplayTag& SoulTag = SoulPair.Key;
 		const int32 Count = SoulPair.Value;
 
 		const USoulDataAsset* SoulData = GetSoulDataByTag(SoulTag);
-		if (!SoulData)
+		if (!SoulData || Count <= 0)
 		{
 			continue;
 		}
 
-		// 魂の数だけバフを適用
-		for (int32 i = 0; i < Count; ++i)
+		for (const FSoulBuffEffect& Buff : SoulData->BuffEffects)
 		{
-			for (const FSoulBuffEffect& Buff : SoulData->BuffEffects)
-			{
-				ApplyBuffEffect(TargetAttributeSet, Buff);
-				AppliedBuffs.Add(Buff);
-			}
+			AccumulateBuffEffect(AggregatedBuffs, ReaperGaugeGain, Buff, Count);
 		}
 
-		UE_LOG(LogDawnlight, Log, TEXT("SoulCollectionSubsystem: バフ適用 - %s x%d"),
+		UE_LOG(LogDawnlight, Log, TEXT("SoulCollectionSubsystem: バフ集計 - %s x%d"),
 			*SoulData->DisplayNameEN, Count);
 	}
 
+	// GameplayEffect クラスごとにスタック数を指定して1回だけ適用
+	BuffTargetASC = ASC;
+	for (const auto& BuffPair : AggregatedBuffs)
+	{
+		const USoulBuffGameplayEffect* EffectCDO = BuffPair.Key.GetDefaultObject();
+		const FAggregatedSoulBuff& Aggregated = BuffPair.Value;
+		if (!EffectCDO || Aggregated.StackCount <= 0)
+		{
+			continue;
+		}
+
+		// スタック上限を超えた分は1スタックあたりの効果量に含め、合計値を保つ
+		const int32 StackLimit = EffectCDO->StackLimitCount > 0 ? EffectCDO->StackLimitCount : Aggregated.StackCount;
+		const int32 StackCount = FMath::Min(Aggregated.StackCount, StackLimit);
+		const float AmountPerStack = Aggregated.TotalAmount / StackCount;
+
+		FGameplayEffectContextHandle Context = ASC->MakeEffectContext();
+		Context.AddSourceObject(this);
+
+		const FGameplayEffectSpecHandle SpecHandle = ASC->MakeOutgoingSpec(BuffPair.Key, 1.0f, Context);
+		if (!SpecHandle.IsValid())
+		{
+			continue;
+		}
+
+		SpecHandle.Data->SetSetByCallerMagnitude(SoulReaperTags::Data_SoulBuff, AmountPerStack);
+		SpecHandle.Data->SetStackCount(StackCount);
+
+		const FActiveGameplayEffectHandle Handle = ASC->ApplyGameplayEffectSpecToSelf(*SpecHandle.Data.Get());
+		if (Handle.IsValid())
+		{
+			AppliedBuffHandles.Add(Handle);
+		}
+
+		UE_LOG(LogDawnlight, Log, TEXT("SoulCollectionSubsystem: バフ適用 - %s x%d (合計: %.2f)"),
+			*BuffPair.Key->GetName(), StackCount, Aggregated.TotalAmount);
+	}
+
+	// リーパーゲージは除去しないバフなので直接加算
+	if (ReaperGaugeGain > 0.0f)
+	{
+		TargetAttributeSet->SetReaperGauge(TargetAttributeSet->GetReaperGauge() + ReaperGaugeGain);
+	}
+
 	// デリゲートを発火
 	OnBuffsApplied.Broadcast();
 
 	UE_LOG(LogDawnlight, Log, TEXT("SoulCollectionSubsystem: 全てのバフを適用完了 (合計: %d効果)"),
-		AppliedBuffs.Num());
+		AppliedBuffHandles.Num());
 }
 
 void USoulCollectionSubsystem::ClearAppliedBuffs(UDawnlightAttributeSet* TargetAttributeSet)
 {
-	if (!TargetAttributeSet)
+	UAbilitySystemComponent* ASC = BuffTargetASC.Get();
+	if (!ASC && TargetAttributeSet)
 	{
-		return;
+		ASC = TargetAttributeSet->GetOwningAbilitySystemComponent();
 	}
 
-	// 適用したバフを逆順で除去
-	for (int32 i = AppliedBuffs.Num() - 1; i >= 0; --i)
+	// 適用した GameplayEffect を全スタックごと除去
+	if (ASC)
 	{
-		RemoveBuffEffect(TargetAttributeSet, AppliedBuffs[i]);
+		for (const FActiveGameplayEffectHandle& Handle : AppliedBuffHandles)
+		{
+			ASC->RemoveActiveGameplayEffect(Handle);
+		}
 	}
 
-	AppliedBuffs.Empty();
+	AppliedBuffHandles.Empty();
+	BuffTargetASC.Reset();
 
 	UE_LOG(LogDawnlight, Log, TEXT("SoulCollectionSubsystem: 全てのバフをクリア"));
 }
 
-void USoulCollectionSubsystem::ApplyBuffEffect(UDawnlightAttributeSet* AttributeSet, const FSoulBuffEffect& Buff)
+void USoulCollectionSubsystem::AccumulateBuffEffect(TMap<TSubclassOf<USoulBuffGameplayEffect>, FAggregatedSoulBuff>& OutBuffs,
+	float& OutReaperGauge, const FSoulBuffEffect& Buff, int32 SoulCount)
 {
-	if (!AttributeSet)
+	auto Add = [&OutBuffs, SoulCount](TSubclassOf<USoulBuffGameplayEffect> EffectClass, float AmountPerSoul)
 	{
-		return;
-	}
+		FAggregatedSoulBuff& Aggregated = OutBuffs.FindOrAdd(EffectClass);
+		Aggregated.StackCount += SoulCount;
+		Aggregated.TotalAmount += AmountPerSoul * SoulCount;
+	};
 
 	switch (Buff.BuffType)
 	{
 	case ESoulBuffType::Damage:
 		// ダメージ倍率を加算
-		AttributeSet->SetDamageMultiplier(AttributeSet->GetDamageMultiplier() + Buff.BuffAmount);
+		Add(USoulBuff_Power::StaticClass(), Buff.BuffAmount);
 		break;
 
 	case ESoulBuffType::Speed:
 		// スピード倍率を加算
-		AttributeSet->SetSpeedMultiplier(AttributeSet->GetSpeedMultiplier() + Buff.BuffAmount);
+		Add(USoulBuff_Speed::StaticClass(), Buff.BuffAmount);
 		break;
 
 	case ESoulBuffType::Defense:
 		// 防御ボーナスを加算
-		AttributeSet->SetDefenseBonus(AttributeSet->GetDefenseBonus() + Buff.BuffAmount);
+		Add(USoulBuff_Guard::StaticClass(), Buff.BuffAmount);
 		break;
 
 	case ESoulBuffType::Cooldown:
 		// クールダウン短縮率を加算
-		AttributeSet->SetCooldownReduction(AttributeSet->GetCooldownReduction() + Buff.BuffAmount);
+		Add(USoulBuff_Cooldown::StaticClass(), Buff.BuffAmount);
 		break;
 
 	case ESoulBuffType::Luck:
 		// ラックを加算
-		AttributeSet->SetLuck(AttributeSet->GetLuck() + Buff.BuffAmount);
+		Add(USoulBuff_Luck::StaticClass(), Buff.BuffAmount);
 		break;
 
 	case ESoulBuffType::AllStats:
 		// 全ステータスに適用
-		AttributeSet->SetDamageMultiplier(AttributeSet->GetDamageMultiplier() + Buff.BuffAmount);
-		AttributeSet->SetSpeedMultiplier(AttributeSet->GetSpeedMultiplier() + Buff.BuffAmount);
-		AttributeSet->SetDefenseBonus(AttributeSet->GetDefenseBonus() + Buff.BuffAmount * 10.0f);
+		Add(USoulBuff_Power::StaticClass(), Buff.BuffAmount);
+		Add(USoulBuff_Speed::StaticClass(), Buff.BuffAmount);
+		Add(USoulBuff_Guard::StaticClass(), Buff.BuffAmount * 10.0f);
 		break;
 
 	case ESoulBuffType::ReaperGauge:
 		// リーパーゲージを直接増加
-		AttributeSet->SetReaperGauge(AttributeSet->GetReaperGauge() + Buff.BuffAmount);
+		OutReaperGauge += Buff.BuffAmount * SoulCount;
 		break;
 
 	default:
@@ -283,51 +491,6 @@ void USoulCollectionSubsystem::ApplyBuffEffect(UDawnlightAttributeSet* Attribute
 	}
 }
 
-void USoulCollectionSubsystem::RemoveBuffEffect(UDawnlightAttributeSet* AttributeSet, const FSoulBuffEffect& Buff)
-{
-	if (!AttributeSet)
-	{
-		return;
-	}
-
-	switch (Buff.BuffType)
-	{
-	case ESoulBuffType::Damage:
-		AttributeSet->SetDamageMultiplier(FMath::Max(1.0f, AttributeSet->GetDamageMultiplier() - Buff.BuffAmount));
-		break;
-
-	case ESoulBuffType::Speed:
-		AttributeSet->SetSpeedMultiplier(FMath::Max(1.0f, AttributeSet->GetSpeedMultiplier() - Buff.BuffAmount));
-		break;
-
-	case ESoulBuffType::Defense:
-		AttributeSet->SetDefenseBonus(FMath::Max(0.0f, AttributeSet->GetDefenseBonus() - Buff.BuffAmount));
-		break;
-
-	case ESoulBuffType::Cooldown:
-		AttributeSet->SetCooldownReduction(FMath::Max(0.0f, AttributeSet->GetCooldownReduction() - Buff.BuffAmount));
-		break;
-
-	case ESoulBuffType::Luck:
-		AttributeSet->SetLuck(FMath::Max(0.0f, AttributeSet->GetLuck() - Buff.BuffAmount));
-		break;
-
-	case ESoulBuffType::AllStats:
-		AttributeSet->SetDamageMultiplier(FMath::Max(1.0f, AttributeSet->GetDamageMultiplier() - Buff.BuffAmount));
-		AttributeSet->SetSpeedMultiplier(FMath::Max(1.0f, AttributeSet->GetSpeedMultiplier() - Buff.BuffAmount));
-		AttributeSet->SetDefenseBonus(FMath::Max(0.0f, AttributeSet->GetDefenseBonus() - Buff.BuffAmount * 10.0f));
-		break;
-
-	case ESoulBuffType::ReaperGauge:
-		// リーパーゲージは除去しない（一度増えたら減らない）
-		break;
-
-	default:
-		// 未知のバフタイプは無視
-		break;
-	}
-}
-
 // ========================================================================
 // 動物スポーン
 // ========================================================================
@@ -343,14 +506,14 @@ AActor* USoulCollectionSubsystem::SpawnAnimal(const FVector& SpawnLocation, cons
 	}
 
 	// Blueprintクラスをロード
-	if (!SoulData->AnimalBlueprintClass.IsValid())
+	if (SoulData->AnimalBlueprintClass.IsNull())
 	{
 		UE_LOG(LogDawnlight, Warning, TEXT("SoulCollectionSubsystem: 動物スポーン失敗 - Blueprintクラスが設定されていません: %s"),
 			*SoulData->DisplayNameEN);
 		return nullptr;
 	}
 
-	UClass* AnimalClass = SoulData->AnimalBlueprintClass.LoadSynchronous();
+	UClass* AnimalClass = UDawnlightAssetPreloader::ResolveClass(this, SoulData->AnimalBlueprintClass, TEXT("SoulCollection"));
 	if (!AnimalClass)
 	{
 		UE_LOG(LogDawnlight, Warning, TEXT("SoulCollectionSubsystem: 動物スポーン失敗 - Blueprintクラスのロードに失敗: %s"),
@@ -443,7 +606,19 @@ int32 USoulCollectionSubsystem::RecordKill(const FVector& KillLocation)
 		return 0;
 	}
 
-	const float CurrentTime = World->GetTimeSeconds();
+	const int32 BonusSouls = RecordKillInternal(World->GetTimeSeconds());
+
+	// デリゲートを発火
+	OnComboUpdated.Broadcast(ComboInfo.CurrentCombo, BonusSouls);
+
+	UE_LOG(LogDawnlight, Log, TEXT("SoulCollectionSubsystem: キル記録 - コンボ: %d, ボーナス魂: %d"),
+		ComboInfo.CurrentCombo, BonusSouls);
+
+	return BonusSouls;
+}
+
+int32 USoulCollectionSubsystem::RecordKillInternal(float CurrentTime)
+{
 	const float TimeSinceLastKill = CurrentTime - ComboInfo.LastKillTime;
 
 	// コンボがタイムアウトしていないかチェック
@@ -476,12 +651,6 @@ int32 USoulCollectionSubsystem::RecordKill(const FVector& KillLocation)
 	// ボーナス魂を記録
 	ComboInfo.BonusSoulsFromCombo += BonusSouls;
 
-	// デリゲートを発火
-	OnComboUpdated.Broadcast(ComboInfo.CurrentCombo, BonusSouls);
-
-	UE_LOG(LogDawnlight, Log, TEXT("SoulCollectionSubsystem: キル記録 - コンボ: %d, ボーナス魂: %d"),
-		ComboInfo.CurrentCombo, BonusSouls);
-
 	return BonusSouls;
 }
 
@@ -511,15 +680,9 @@ TArray<FSoulSetBonus> USoulCollectionSubsystem::GetActiveSetBonuses(const FGamep
 		return ActiveBonuses;
 	}
 
-	const int32 CurrentCount = GetSoulCount(SoulTag);
-
-	for (const FSoulSetBonus& Bonus : *Bonuses)
-	{
-		if (CurrentCount >= Bonus.RequiredCount)
-		{
-			ActiveBonuses.Add(Bonus);
-		}
-	}
+	// 定義は RequiredCount 順なので、到達済みの段階数だけ先頭から取る
+	const int32 Tier = FMath::Min(GetSetBonusTier(SoulTag), Bonuses->Num());
+	ActiveBonuses.Append(Bonuses->GetData(), Tier);
 
 	return ActiveBonuses;
 }
@@ -530,25 +693,11 @@ TMap<FGameplayTag, FSoulSetBonus> USoulCollectionSubsystem::GetAllActiveSetBonus
 
 	for (const auto& Pair : SetBonusDefinitions)
 	{
-		const FGameplayTag& SoulTag = Pair.Key;
-		const int32 CurrentCount = GetSoulCount(SoulTag);
-
 		// 最も高いアクティブなボーナスを取得
-		const FSoulSetBonus* HighestBonus = nullptr;
-		for (const FSoulSetBonus& Bonus : Pair.Value)
-		{
-			if (CurrentCount >= Bonus.RequiredCount)
-			{
-				if (!HighestBonus || Bonus.RequiredCount > HighestBonus->RequiredCount)
-				{
-					HighestBonus = &Bonus;
-				}
-			}
-		}
-
-		if (HighestBonus)
+		const int32 Tier = FMath::Min(GetSetBonusTier(Pair.Key), Pair.Value.Num());
+		if (Tier > 0)
 		{
-			AllActiveBonuses.Add(SoulTag, *HighestBonus);
+			AllActiveBonuses.Add(Pair.Key, Pair.Value[Tier - 1]);
 		}
 	}
 
@@ -566,10 +715,26 @@ void USoulCollectionSubsystem::RegisterSetBonus(const FGameplayTag& SoulTag, con
 		return A.RequiredCount < B.RequiredCount;
 	});
 
+	// 段階トラッカーの閾値を更新（登録時のみ確保）
+	const int32 Slot = SetBonusSlots.FindOrAdd(SoulTag, SetBonusSlots.Num());
+
+	TArray<int32, TInlineAllocator<8>> Thresholds;
+	for (const FSoulSetBonus& Registered : Bonuses)
+	{
+		Thresholds.Add(Registered.RequiredCount);
+	}
+	SetBonusTracker.SetThresholds(Slot, Thresholds);
+
 	UE_LOG(LogDawnlight, Log, TEXT("SoulCollectionSubsystem: セットボーナス登録 - %s (必要数: %d)"),
 		*Bonus.BonusName.ToString(), Bonus.RequiredCount);
 }
 
+int32 USoulCollectionSubsystem::GetSetBonusTier(const FGameplayTag& SoulTag) const
+{
+	const int32* Slot = SetBonusSlots.Find(SoulTag);
+	return Slot ? SetBonusTracker.GetTier(*Slot) : 0;
+}
+
 // ========================================================================
 // 内部関数
 // ========================================================================
@@ -602,34 +767,27 @@ void USoulCollectionSubsystem::InitializeDefaultSetBonuses()
 
 void USoulCollectionSubsystem::CheckSetBonusAchievement(const FGameplayTag& SoulTag, int32 NewCount)
 {
+	const int32* Slot = SetBonusSlots.Find(SoulTag);
 	const TArray<FSoulSetBonus>* Bonuses = SetBonusDefinitions.Find(SoulTag);
-	if (!Bonuses)
+	if (!Slot || !Bonuses)
 	{
 		return;
 	}
 
-	for (const FSoulSetBonus& Bonus : *Bonuses)
+	// 到達した段階だけ通知（まとめて処理するので複数の段階を跨ぐことがある）
+	SetBonusTracker.UpdateCount(*Slot, NewCount, [this, &SoulTag, Bonuses](int32, int32 Tier)
 	{
-		// ちょうど閾値に達した時のみ通知
-		if (NewCount == Bonus.RequiredCount)
+		if (!Bonuses->IsValidIndex(Tier - 1))
 		{
-			// 重複通知を防ぐ
-			const FString BonusKey = MakeSetBonusKey(SoulTag, Bonus.RequiredCount);
-			if (!AchievedSetBonuses.Contains(BonusKey))
-			{
-				AchievedSetBonuses.Add(BonusKey);
+			return;
+		}
 
-				// デリゲートを発火
-				OnSetBonusAchieved.Broadcast(SoulTag, Bonus);
+		const FSoulSetBonus& Bonus = (*Bonuses)[Tier - 1];
 
-				UE_LOG(LogDawnlight, Log, TEXT("SoulCollectionSubsystem: セットボーナス達成! %s - %s"),
-					*SoulTag.ToString(), *Bonus.BonusName.ToString());
-			}
-		}
-	}
-}
+		// デリゲートを発火
+		OnSetBonusAchieved.Broadcast(SoulTag, Bonus);
 
-FString USoulCollectionSubsystem::MakeSetBonusKey(const FGameplayTag& SoulTag, int32 RequiredCount) const
-{
-	return FString::Printf(TEXT("%s_%d"), *SoulTag.ToString(), RequiredCount);
+		UE_LOG(LogDawnlight, Log, TEXT("SoulCollectionSubsystem: セットボーナス達成! %s - %s"),
+			*SoulTag.ToString(), *Bonus.BonusName.ToString());
+	});
 }
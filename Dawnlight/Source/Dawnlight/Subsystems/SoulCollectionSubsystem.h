@@ -6,12 +6,16 @@
 #include "CoreMinimal.h"
 #include "Subsystems/WorldSubsystem.h"
 #include "GameplayTagContainer.h"
+#include "GameplayEffectTypes.h"
 #include "Data/SoulDataAsset.h"
 #include "Data/SoulTypes.h"
+#include "Utilities/SetBonusTierTracker.h"
 #include "SoulCollectionSubsystem.generated.h"
 
 class USoulDataAsset;
 class UDawnlightAttributeSet;
+class UAbilitySystemComponent;
+class USoulBuffGameplayEffect;
 
 /**
  * コンボキル情報
@@ -57,6 +61,10 @@ struct DAWNLIGHT_API FSoulCollectedEventData
 	/** 現在の総魂数 */
 	UPROPERTY(BlueprintReadOnly, Category = "魂")
 	int32 TotalSoulCount = 0;
+
+	/** このイベントにまとめられた収集数（同じフレームの収集は1回の通知になる） */
+	UPROPERTY(BlueprintReadOnly, Category = "魂")
+	int32 CollectedCount = 1;
 };
 
 /**
@@ -64,11 +72,11 @@ struct DAWNLIGHT_API FSoulCollectedEventData
  *
  * Night Phase中の魂収集を管理
  * - 動物のスポーン
- * - 魂の収集とカウント
+ * - 魂の収集とカウント（収集はキューに積み、1フレームに1回まとめて処理）
  * - バフの適用
  */
 UCLASS()
-class DAWNLIGHT_API USoulCollectionSubsystem : public UWorldSubsystem
+class DAWNLIGHT_API USoulCollectionSubsystem : public UTickableWorldSubsystem
 {
 	GENERATED_BODY()
 
@@ -81,27 +89,56 @@ public:
 	virtual void Deinitialize() override;
 	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
 
+	// ========================================================================
+	// FTickableGameObject インターフェース
+	// ========================================================================
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
 	// ========================================================================
 	// 魂収集
 	// ========================================================================
 
 	/**
-	 * 魂を収集
+	 * 魂を収集（キューに積み、フレームの終わりにまとめて処理）
 	 * @param SoulTag 収集する魂のタグ
 	 * @param CollectionLocation 収集した場所
+	 * @param bFromKill キルによる収集か（コンボに加算）
 	 * @return 収集に成功したか
 	 */
 	UFUNCTION(BlueprintCallable, Category = "魂")
-	bool CollectSoul(const FGameplayTag& SoulTag, const FVector& CollectionLocation);
+	bool CollectSoul(const FGameplayTag& SoulTag, const FVector& CollectionLocation, bool bFromKill = false);
 
 	/**
-	 * 魂データから魂を収集
+	 * 魂データから魂を収集（キューに積み、フレームの終わりにまとめて処理）
 	 * @param SoulData 魂データアセット
 	 * @param CollectionLocation 収集した場所
+	 * @param bFromKill キルによる収集か（コンボに加算）
 	 * @return 収集に成功したか
 	 */
 	UFUNCTION(BlueprintCallable, Category = "魂")
-	bool CollectSoulFromData(const USoulDataAsset* SoulData, const FVector& CollectionLocation);
+	bool CollectSoulFromData(const USoulDataAsset* SoulData, const FVector& CollectionLocation, bool bFromKill = false);
+
+	/** キュー内の収集イベントを予算に関係なく全て処理 */
+	UFUNCTION(BlueprintCallable, Category = "魂")
+	void FlushSoulEvents();
+
+	/** 処理待ちの収集イベント数 */
+	UFUNCTION(BlueprintPure, Category = "魂")
+	int32 GetPendingSoulEventCount() const { return SoulEventCount; }
+
+	/** これまでに処理した収集イベント数 */
+	UFUNCTION(BlueprintPure, Category = "魂")
+	int32 GetDrainedSoulEventCount() const { return DrainedSoulEventCount; }
+
+	/** 1フレームに処理する収集イベントの上限（0で無制限） */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "魂|設定", meta = (ClampMin = "0"))
+	int32 MaxSoulEventsPerFrame = 64;
+
+	/** 収集イベントキューの初期容量（溢れた場合は拡張） */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "魂|設定", meta = (ClampMin = "1"))
+	int32 SoulEventQueueCapacity = 256;
 
 	/** 収集した魂を取得 */
 	UFUNCTION(BlueprintPure, Category = "魂")
@@ -149,7 +186,8 @@ public:
 	/**
 	 * 収集した魂のバフをプレイヤーに適用
 	 * Dawn Phase開始時に呼び出される
-	 * @param TargetAttributeSet バフを適用する属性セット
+	 * バフの種類ごとにスタック可能な GameplayEffect を1つだけ適用する（スタック数 = 魂の数）
+	 * @param TargetAttributeSet バフを適用する属性セット（所有する ASC に適用）
 	 */
 	UFUNCTION(BlueprintCallable, Category = "バフ")
 	void ApplyCollectedBuffs(UDawnlightAttributeSet* TargetAttributeSet);
@@ -282,9 +320,12 @@ protected:
 	UPROPERTY()
 	TMap<FGameplayTag, TObjectPtr<USoulDataAsset>> SoulDataMap;
 
-	/** 現在適用されているバフ（リセット用に保存） */
+	/** 現在適用されているバフのハンドル（リセット用に保存） */
 	UPROPERTY()
-	TArray<FSoulBuffEffect> AppliedBuffs;
+	TArray<FActiveGameplayEffectHandle> AppliedBuffHandles;
+
+	/** バフを適用したASC */
+	TWeakObjectPtr<UAbilitySystemComponent> BuffTargetASC;
 
 	/** コンボ情報 */
 	UPROPERTY()
@@ -293,19 +334,46 @@ protected:
 	/** セットボーナス定義（魂タグ→ボーナスリスト） - UPROPERTYは使用不可（TArrayがTMapの値のため） */
 	TMap<FGameplayTag, TArray<FSoulSetBonus>> SetBonusDefinitions;
 
-	/** 達成済みセットボーナス（再通知防止用） */
-	UPROPERTY()
-	TSet<FString> AchievedSetBonuses;
+	/** セットボーナスの段階（魂タグごとのスロット） */
+	FSetBonusTierTracker SetBonusTracker;
+
+	/** 魂タグ → SetBonusTracker のスロット */
+	TMap<FGameplayTag, int32> SetBonusSlots;
+
+	/** 処理待ちの収集イベント */
+	struct FPendingSoulEvent
+	{
+		TWeakObjectPtr<const USoulDataAsset> SoulData;
+		FVector Location = FVector::ZeroVector;
+		bool bFromKill = false;
+	};
+
+	/** 収集イベントのリングバッファ */
+	TArray<FPendingSoulEvent> SoulEventQueue;
+
+	/** リングバッファの先頭 */
+	int32 SoulEventHead = 0;
+
+	/** リングバッファ内のイベント数 */
+	int32 SoulEventCount = 0;
+
+	/** これまでに処理した収集イベント数 */
+	int32 DrainedSoulEventCount = 0;
 
 	// ========================================================================
 	// 内部関数
 	// ========================================================================
 
-	/** バフ効果を属性セットに適用 */
-	void ApplyBuffEffect(UDawnlightAttributeSet* AttributeSet, const FSoulBuffEffect& Buff);
+	/** GameplayEffect クラスごとに集計したバフ */
+	struct FAggregatedSoulBuff
+	{
+		int32 StackCount = 0;
+		float TotalAmount = 0.0f;
+	};
 
-	/** バフ効果を属性セットから除去 */
-	void RemoveBuffEffect(UDawnlightAttributeSet* AttributeSet, const FSoulBuffEffect& Buff);
+	/** バフ効果を GameplayEffect クラスごとに集計（リーパーゲージは即時加算分として返す） */
+	static void AccumulateBuffEffect(TMap<TSubclassOf<USoulBuffGameplayEffect>, FAggregatedSoulBuff>& OutBuffs,
+		float& OutReaperGauge, const FSoulBuffEffect& Buff, int32 SoulCount);
 
 	/** デフォルトのコンボ閾値を初期化 */
 	void InitializeDefaultComboThresholds();
@@ -313,9 +381,18 @@ protected:
 	/** デフォルトのセットボーナスを初期化 */
 	void InitializeDefaultSetBonuses();
 
-	/** セットボーナスの達成をチェック */
+	/** セットボーナスの達成をチェック（新しく到達した段階を通知） */
 	void CheckSetBonusAchievement(const FGameplayTag& SoulTag, int32 NewCount);
 
-	/** セットボーナスキーを生成（再通知防止用） */
-	FString MakeSetBonusKey(const FGameplayTag& SoulTag, int32 RequiredCount) const;
+	/** 魂タグの現在のセットボーナス段階（0 = 未到達） */
+	int32 GetSetBonusTier(const FGameplayTag& SoulTag) const;
+
+	/** キルを記録してコンボボーナス魂数を返す（デリゲートは発火しない） */
+	int32 RecordKillInternal(float CurrentTime);
+
+	/** 収集イベントをキューに積む */
+	void EnqueueSoulEvent(const USoulDataAsset* SoulData, const FVector& Location, bool bFromKill);
+
+	/** キュー内の収集イベントを最大 MaxEvents 件処理（0で全て） */
+	void DrainSoulEvents(int32 MaxEvents);
 };
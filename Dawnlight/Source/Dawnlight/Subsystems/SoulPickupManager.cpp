@@ -0,0 +1,369 @@
+// Soul Reaper - Dawnlight Project
+// Copyright (c) 2025. All Rights Reserved.
+
+#include "SoulPickupManager.h"
+#include "Dawnlight.h"
+#include "DawnlightStats.h"
+#include "Data/SoulDataAsset.h"
+#include "Subsystems/PlayerContextSubsystem.h"
+#include "Subsystems/SoulCollectionSubsystem.h"
+#include "Subsystems/DawnlightAssetPreloader.h"
+#include "Subsystems/DawnlightVFXManager.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "NiagaraSystem.h"
+
+namespace
+{
+	/** 未使用スロットの変換（スケール0で非表示） */
+	const FTransform HiddenInstanceTransform(FQuat::Identity, FVector::ZeroVector, FVector::ZeroVector);
+
+	/** インスタンスごとのカスタムデータ（魂の色 RGB） */
+	constexpr int32 NumColorCustomData = 3;
+}
+
+void USoulPickupManager::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	PlayerContext = Collection.InitializeDependency<UPlayerContextSubsystem>();
+	SoulCollection = Collection.InitializeDependency<USoulCollectionSubsystem>();
+
+	UE_LOG(LogDawnlight, Log, TEXT("[SoulPickupManager] 初期化完了"));
+}
+
+void USoulPickupManager::Deinitialize()
+{
+	DEC_DWORD_STAT_BY(STAT_DawnlightLivePickups, Pickups.Num());
+
+	Pickups.Empty();
+	FreeInstances.Empty();
+	InstanceTransforms.Empty();
+	InstanceComponent = nullptr;
+	RenderActor = nullptr;
+
+	Super::Deinitialize();
+}
+
+bool USoulPickupManager::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// ゲームワールドでのみ作成
+	if (const UWorld* World = Cast<UWorld>(Outer))
+	{
+		return World->IsGameWorld();
+	}
+	return false;
+}
+
+TStatId USoulPickupManager::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USoulPickupManager, STATGROUP_Tickables);
+}
+
+// ========================================================================
+// 更新
+// ========================================================================
+
+void USoulPickupManager::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (Pickups.Num() == 0)
+	{
+		return;
+	}
+
+	DAWNLIGHT_SCOPE_CYCLE_COUNTER(STAT_DawnlightSoulPickupTick);
+
+	const APawn* Player = PlayerContext.IsValid() ? PlayerContext->GetPlayerPawn() : nullptr;
+	const FVector PlayerLocation = Player ? Player->GetActorLocation() : FVector::ZeroVector;
+	const float AttractionRadiusSq = FMath::Square(Settings.AttractionRadius);
+	const float CollectionRadiusSq = FMath::Square(Settings.CollectionRadius);
+
+	// 削除は末尾と入れ替えるので後ろから処理
+	for (int32 i = Pickups.Num() - 1; i >= 0; --i)
+	{
+		FSoulPickupInstance& Pickup = Pickups[i];
+		Pickup.Age += DeltaTime;
+
+		// 寿命切れ
+		if (Settings.LifeTime > 0.0f && Pickup.Age >= Settings.LifeTime)
+		{
+			ReleasePickup(i);
+			continue;
+		}
+
+		if (Player)
+		{
+			const float DistanceSq = FVector::DistSquared(Pickup.Location, PlayerLocation);
+			if (DistanceSq <= CollectionRadiusSq)
+			{
+				CollectPickup(i);
+				continue;
+			}
+
+			Pickup.bAttracting |= DistanceSq <= AttractionRadiusSq;
+		}
+		else
+		{
+			Pickup.bAttracting = false;
+		}
+
+		if (Pickup.bAttracting)
+		{
+			// プレイヤーに向かって移動
+			Pickup.Location += (PlayerLocation - Pickup.Location).GetSafeNormal() * Settings.AttractionSpeed * DeltaTime;
+		}
+		else
+		{
+			// Sin波で上下に浮遊しながら回転
+			Pickup.Location = Pickup.AnchorLocation + FVector(0.0f, 0.0f, FMath::Sin(Pickup.Age * Settings.FloatSpeed) * Settings.FloatAmplitude);
+			Pickup.Yaw = FRotator::NormalizeAxis(Pickup.Yaw + Settings.RotationSpeed * DeltaTime);
+		}
+
+		if (Pickup.InstanceIndex != INDEX_NONE)
+		{
+			InstanceTransforms[Pickup.InstanceIndex] = FTransform(FRotator(0.0f, Pickup.Yaw, 0.0f), Pickup.Location);
+		}
+	}
+
+	FlushInstanceTransforms();
+}
+
+void USoulPickupManager::FlushInstanceTransforms()
+{
+	// 全スロットを1回の呼び出しで更新し、描画状態もここで1回だけ更新する
+	if (InstanceComponent && InstanceTransforms.Num() > 0)
+	{
+		InstanceComponent->BatchUpdateInstancesTransforms(0, InstanceTransforms, true, true, true);
+	}
+}
+
+// ========================================================================
+// 描画
+// ========================================================================
+
+void USoulPickupManager::ConfigurePickups(const FSoulPickupSettings& InSettings, UStaticMesh* Mesh, int32 PrewarmCount)
+{
+	Settings = InSettings;
+
+	if (!Mesh)
+	{
+		return;
+	}
+
+	EnsureInstanceComponent();
+	if (!InstanceComponent)
+	{
+		return;
+	}
+
+	InstanceComponent->SetStaticMesh(Mesh);
+
+	// スロットを事前に確保してプールに入れる
+	const int32 NumToAdd = FMath::Max(PrewarmCount - InstanceComponent->GetInstanceCount(), 0);
+	for (int32 i = 0; i < NumToAdd; ++i)
+	{
+		FreeInstances.Add(InstanceComponent->AddInstance(HiddenInstanceTransform, true));
+		InstanceTransforms.Add(HiddenInstanceTransform);
+	}
+
+	UE_LOG(LogDawnlight, Log, TEXT("[SoulPickupManager] メッシュを設定: %s（プリウォーム: %d）"), *Mesh->GetName(), NumToAdd);
+}
+
+void USoulPickupManager::EnsureInstanceComponent()
+{
+	if (InstanceComponent)
+	{
+		return;
+	}
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.ObjectFlags |= RF_Transient;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	RenderActor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+	if (!RenderActor)
+	{
+		return;
+	}
+
+	InstanceComponent = NewObject<UInstancedStaticMeshComponent>(RenderActor, TEXT("SoulPickupInstances"));
+	InstanceComponent->SetMobility(EComponentMobility::Movable);
+	InstanceComponent->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	InstanceComponent->SetCastShadow(false);
+	InstanceComponent->SetNumCustomDataFloats(NumColorCustomData);
+	RenderActor->SetRootComponent(InstanceComponent);
+	InstanceComponent->RegisterComponent();
+}
+
+int32 USoulPickupManager::AcquireInstance(const FLinearColor& Color)
+{
+	if (!InstanceComponent || !InstanceComponent->GetStaticMesh())
+	{
+		return INDEX_NONE;
+	}
+
+	int32 InstanceIndex = INDEX_NONE;
+	if (FreeInstances.Num() > 0)
+	{
+		InstanceIndex = FreeInstances.Pop(EAllowShrinking::No);
+	}
+	else
+	{
+		InstanceIndex = InstanceComponent->AddInstance(HiddenInstanceTransform, true);
+		InstanceTransforms.Add(HiddenInstanceTransform);
+	}
+
+	InstanceComponent->SetCustomDataValue(InstanceIndex, 0, Color.R);
+	InstanceComponent->SetCustomDataValue(InstanceIndex, 1, Color.G);
+	InstanceComponent->SetCustomDataValue(InstanceIndex, 2, Color.B);
+
+	return InstanceIndex;
+}
+
+// ========================================================================
+// スポーン
+// ========================================================================
+
+void USoulPickupManager::SpawnPickup(USoulDataAsset* SoulData, FVector Location, bool bFromKill)
+{
+	if (!SoulData)
+	{
+		return;
+	}
+
+	AddPickup(SoulData, SoulData->SoulTag, Location, bFromKill);
+}
+
+void USoulPickupManager::SpawnPickupByTag(FGameplayTag SoulTag, FVector Location, bool bFromKill)
+{
+	if (!SoulTag.IsValid())
+	{
+		return;
+	}
+
+	AddPickup(nullptr, SoulTag, Location, bFromKill);
+}
+
+bool USoulPickupManager::DropSoulInWorld(const UObject* WorldContextObject, USoulDataAsset* SoulData, const FVector& Location, bool bFromKill)
+{
+	UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	if (!World || !SoulData)
+	{
+		return false;
+	}
+
+	if (USoulPickupManager* PickupManager = World->GetSubsystem<USoulPickupManager>())
+	{
+		PickupManager->SpawnPickup(SoulData, Location, bFromKill);
+		return true;
+	}
+
+	// マネージャーがない場合は魂を失わないよう即座に収集
+	if (USoulCollectionSubsystem* SoulSystem = World->GetSubsystem<USoulCollectionSubsystem>())
+	{
+		return SoulSystem->CollectSoulFromData(SoulData, Location, bFromKill);
+	}
+
+	return false;
+}
+
+void USoulPickupManager::AddPickup(USoulDataAsset* SoulData, const FGameplayTag& SoulTag, const FVector& Location, bool bFromKill)
+{
+	// 上限に達していたら最も古いものを収集して空ける（魂は失わない）
+	if (Pickups.Num() >= Settings.MaxPickups)
+	{
+		int32 OldestIndex = 0;
+		for (int32 i = 1; i < Pickups.Num(); ++i)
+		{
+			if (Pickups[i].Age > Pickups[OldestIndex].Age)
+			{
+				OldestIndex = i;
+			}
+		}
+		CollectPickup(OldestIndex);
+	}
+
+	FSoulPickupInstance& Pickup = Pickups.AddDefaulted_GetRef();
+	Pickup.SoulData = SoulData;
+	Pickup.SoulTag = SoulTag;
+	Pickup.AnchorLocation = Location;
+	Pickup.Location = Location;
+	Pickup.bFromKill = bFromKill;
+	Pickup.InstanceIndex = AcquireInstance(SoulData ? SoulData->SoulColor : FLinearColor::White);
+
+	INC_DWORD_STAT(STAT_DawnlightLivePickups);
+
+	UE_LOG(LogDawnlight, Verbose, TEXT("[SoulPickupManager] スポーン: %s（%d個）"), *SoulTag.ToString(), Pickups.Num());
+}
+
+void USoulPickupManager::CollectPickup(int32 Index)
+{
+	const FSoulPickupInstance& Pickup = Pickups[Index];
+
+	// SoulCollectionSubsystemに通知（イベントはフレーム末にまとめて処理される）
+	if (USoulCollectionSubsystem* SoulSystem = SoulCollection.Get())
+	{
+		if (Pickup.SoulData)
+		{
+			SoulSystem->CollectSoulFromData(Pickup.SoulData, Pickup.Location, Pickup.bFromKill);
+		}
+		else
+		{
+			SoulSystem->CollectSoul(Pickup.SoulTag, Pickup.Location, Pickup.bFromKill);
+		}
+	}
+
+	// 収集VFXを再生
+	if (Pickup.SoulData && !Pickup.SoulData->CollectNiagaraEffect.IsNull())
+	{
+		if (UNiagaraSystem* NiagaraAsset = UDawnlightAssetPreloader::ResolveAsset(this, Pickup.SoulData->CollectNiagaraEffect, TEXT("SoulPickupManager")))
+		{
+			UDawnlightVFXManager::SpawnAtLocationInWorld(this, NiagaraAsset, EDawnlightVFXCategory::SoulCollect, Pickup.Location);
+		}
+	}
+
+	ReleasePickup(Index);
+}
+
+void USoulPickupManager::ReleasePickup(int32 Index)
+{
+	const int32 InstanceIndex = Pickups[Index].InstanceIndex;
+	if (InstanceIndex != INDEX_NONE)
+	{
+		// 描画への反映は次の FlushInstanceTransforms でまとめて行う
+		InstanceTransforms[InstanceIndex] = HiddenInstanceTransform;
+		FreeInstances.Add(InstanceIndex);
+	}
+
+	Pickups.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+
+	DEC_DWORD_STAT(STAT_DawnlightLivePickups);
+}
+
+void USoulPickupManager::CollectAllPickups()
+{
+	for (int32 i = Pickups.Num() - 1; i >= 0; --i)
+	{
+		CollectPickup(i);
+	}
+
+	FlushInstanceTransforms();
+}
+
+void USoulPickupManager::ClearAllPickups()
+{
+	for (int32 i = Pickups.Num() - 1; i >= 0; --i)
+	{
+		ReleasePickup(i);
+	}
+
+	FlushInstanceTransforms();
+}
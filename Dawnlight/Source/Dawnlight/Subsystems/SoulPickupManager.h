@@ -0,0 +1,215 @@
+// Soul Reaper - Dawnlight Project
+// Copyright (c) 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GameplayTagContainer.h"
+#include "SoulPickupManager.generated.h"
+
+class USoulDataAsset;
+class UStaticMesh;
+class UInstancedStaticMeshComponent;
+class UPlayerContextSubsystem;
+class USoulCollectionSubsystem;
+
+/**
+ * 魂ピックアップ1個分のデータ
+ */
+USTRUCT()
+struct FSoulPickupInstance
+{
+	GENERATED_BODY()
+
+	/** 魂データ（ない場合は SoulTag で収集） */
+	UPROPERTY()
+	TObjectPtr<USoulDataAsset> SoulData;
+
+	/** 魂タイプタグ */
+	FGameplayTag SoulTag;
+
+	/** 浮遊の基準位置 */
+	FVector AnchorLocation = FVector::ZeroVector;
+
+	/** 現在位置 */
+	FVector Location = FVector::ZeroVector;
+
+	/** 経過時間（浮遊・寿命用） */
+	float Age = 0.0f;
+
+	/** 回転（ヨー） */
+	float Yaw = 0.0f;
+
+	/** インスタンスメッシュのインデックス（メッシュ未設定なら INDEX_NONE） */
+	int32 InstanceIndex = INDEX_NONE;
+
+	/** 吸い寄せ中か */
+	bool bAttracting = false;
+
+	/** キルによるドロップか（収集時にコンボに加算） */
+	bool bFromKill = false;
+};
+
+/**
+ * 魂ピックアップの調整値
+ *
+ * ワールドサブシステムにはデザイナーが編集できるデフォルトオブジェクトがないため、
+ * ゲームモードが保持して USoulPickupManager::ConfigurePickups で渡す
+ */
+USTRUCT(BlueprintType)
+struct FSoulPickupSettings
+{
+	GENERATED_BODY()
+
+	/** 浮遊の振幅 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "魂|ピックアップ", meta = (ClampMin = "0"))
+	float FloatAmplitude = 20.0f;
+
+	/** 浮遊の速度 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "魂|ピックアップ", meta = (ClampMin = "0"))
+	float FloatSpeed = 2.0f;
+
+	/** 回転速度（度/秒） */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "魂|ピックアップ")
+	float RotationSpeed = 90.0f;
+
+	/** 吸い寄せ半径 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "魂|ピックアップ", meta = (ClampMin = "0"))
+	float AttractionRadius = 300.0f;
+
+	/** 吸い寄せ速度 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "魂|ピックアップ", meta = (ClampMin = "0"))
+	float AttractionSpeed = 800.0f;
+
+	/** 収集半径 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "魂|ピックアップ", meta = (ClampMin = "0"))
+	float CollectionRadius = 50.0f;
+
+	/** 存在時間（0で無限） */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "魂|ピックアップ", meta = (ClampMin = "0"))
+	float LifeTime = 30.0f;
+
+	/** 同時に存在できる最大数（超えた場合は最も古いものを即座に収集） */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "魂|ピックアップ", meta = (ClampMin = "1"))
+	int32 MaxPickups = 256;
+};
+
+/**
+ * 魂ピックアップマネージャー
+ *
+ * 魂ピックアップをアクターではなく密な配列で管理し、1つのループでまとめて更新する
+ * - 浮遊・吸い寄せ・収集判定（キャッシュ済みプレイヤーとの距離の2乗）を一括処理
+ * - 描画はインスタンスメッシュ1つ（スロットはプールして再利用）
+ * - 寿命切れはフレームごとにまとめて削除（アクターごとのタイマーなし）
+ * - 動物の死亡時に AAnimalCharacter::DropSoul から DropSoulInWorld 経由でスポーンされる
+ */
+UCLASS()
+class DAWNLIGHT_API USoulPickupManager : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ========================================================================
+	// UWorldSubsystem インターフェース
+	// ========================================================================
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+	// ========================================================================
+	// FTickableGameObject インターフェース
+	// ========================================================================
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// ========================================================================
+	// 設定
+	// ========================================================================
+
+	/**
+	 * 調整値とピックアップのメッシュを設定
+	 * @param Mesh インスタンス描画するメッシュ（null の場合は描画なし、収集は有効）
+	 * @param PrewarmCount 事前に確保するインスタンス数
+	 */
+	void ConfigurePickups(const FSoulPickupSettings& InSettings, UStaticMesh* Mesh, int32 PrewarmCount);
+
+	// ========================================================================
+	// スポーン
+	// ========================================================================
+
+	/**
+	 * 魂データからピックアップをスポーン
+	 * @param bFromKill キルによるドロップか（収集時にコンボに加算）
+	 */
+	UFUNCTION(BlueprintCallable, Category = "魂|ピックアップ")
+	void SpawnPickup(USoulDataAsset* SoulData, FVector Location, bool bFromKill = false);
+
+	/** 魂タイプタグからピックアップをスポーン（DataAssetなし） */
+	UFUNCTION(BlueprintCallable, Category = "魂|ピックアップ")
+	void SpawnPickupByTag(FGameplayTag SoulTag, FVector Location, bool bFromKill = false);
+
+	/**
+	 * 魂をドロップ（マネージャーがあればピックアップ、なければ即座に収集）
+	 * @return ドロップまたは収集できたか
+	 */
+	static bool DropSoulInWorld(const UObject* WorldContextObject, USoulDataAsset* SoulData, const FVector& Location, bool bFromKill);
+
+	/** 全ピックアップをその場で収集（Night Phase終了時、取り残した魂を失わないように） */
+	UFUNCTION(BlueprintCallable, Category = "魂|ピックアップ")
+	void CollectAllPickups();
+
+	/** 全ピックアップを収集せずに削除 */
+	UFUNCTION(BlueprintCallable, Category = "魂|ピックアップ")
+	void ClearAllPickups();
+
+	/** 存在するピックアップ数 */
+	UFUNCTION(BlueprintPure, Category = "魂|ピックアップ")
+	int32 GetPickupCount() const { return Pickups.Num(); }
+
+private:
+	/** ピックアップを追加 */
+	void AddPickup(USoulDataAsset* SoulData, const FGameplayTag& SoulTag, const FVector& Location, bool bFromKill);
+
+	/** ピックアップを収集して削除 */
+	void CollectPickup(int32 Index);
+
+	/** ピックアップを削除（インスタンスはプールに戻す） */
+	void ReleasePickup(int32 Index);
+
+	/** インスタンスメッシュのスロットを取得 */
+	int32 AcquireInstance(const FLinearColor& Color);
+
+	/** 描画用のアクターとインスタンスメッシュを作成 */
+	void EnsureInstanceComponent();
+
+	/** InstanceTransforms をインスタンスメッシュへ一括反映 */
+	void FlushInstanceTransforms();
+
+	/** 調整値（ConfigurePickups で上書き） */
+	FSoulPickupSettings Settings;
+
+	/** ピックアップ（密な配列、削除は末尾と入れ替え） */
+	UPROPERTY()
+	TArray<FSoulPickupInstance> Pickups;
+
+	/** 空いているインスタンスのスロット */
+	TArray<int32> FreeInstances;
+
+	/** 全スロットの変換（インスタンス番号と一致、空きスロットは非表示の変換） */
+	TArray<FTransform> InstanceTransforms;
+
+	/** 描画用アクター */
+	UPROPERTY()
+	TObjectPtr<AActor> RenderActor;
+
+	/** インスタンスメッシュ */
+	UPROPERTY()
+	TObjectPtr<UInstancedStaticMeshComponent> InstanceComponent;
+
+	/** キャッシュ */
+	TWeakObjectPtr<UPlayerContextSubsystem> PlayerContext;
+	TWeakObjectPtr<USoulCollectionSubsystem> SoulCollection;
+};
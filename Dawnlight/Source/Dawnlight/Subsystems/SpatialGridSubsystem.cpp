@@ -0,0 +1,114 @@
+// Soul Reaper - Dawnlight Project
+// Copyright (c) 2025. All Rights Reserved.
+
+#include "SpatialGridSubsystem.h"
+#include "Dawnlight.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+USpatialGridSubsystem::USpatialGridSubsystem()
+	: Grid(CellSize)
+{
+}
+
+void USpatialGridSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	UE_LOG(LogDawnlight, Log, TEXT("[SpatialGridSubsystem] 初期化完了（セルサイズ: %.0f）"), CellSize);
+}
+
+void USpatialGridSubsystem::Deinitialize()
+{
+	Grid.Reset();
+
+	Super::Deinitialize();
+}
+
+bool USpatialGridSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// ゲームワールドでのみ作成
+	if (const UWorld* World = Cast<UWorld>(Outer))
+	{
+		return World->IsGameWorld();
+	}
+	return false;
+}
+
+void USpatialGridSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	Grid.RefreshFromActors();
+}
+
+TStatId USpatialGridSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USpatialGridSubsystem, STATGROUP_Tickables);
+}
+
+// ========================================================================
+// 登録
+// ========================================================================
+
+void USpatialGridSubsystem::RegisterActor(AActor* Actor, EDawnlightSpatialCategory Category)
+{
+	if (!IsValid(Actor) || Category == EDawnlightSpatialCategory::None)
+	{
+		return;
+	}
+
+	Grid.Add(Actor, Actor->GetActorLocation(), static_cast<uint8>(Category));
+}
+
+void USpatialGridSubsystem::UnregisterActor(AActor* Actor)
+{
+	Grid.Remove(Actor);
+}
+
+void USpatialGridSubsystem::RegisterWithWorld(AActor* Actor, EDawnlightSpatialCategory Category)
+{
+	if (UWorld* World = Actor ? Actor->GetWorld() : nullptr)
+	{
+		if (USpatialGridSubsystem* SpatialGrid = World->GetSubsystem<USpatialGridSubsystem>())
+		{
+			SpatialGrid->RegisterActor(Actor, Category);
+		}
+	}
+}
+
+void USpatialGridSubsystem::UnregisterFromWorld(AActor* Actor)
+{
+	if (UWorld* World = Actor ? Actor->GetWorld() : nullptr)
+	{
+		if (USpatialGridSubsystem* SpatialGrid = World->GetSubsystem<USpatialGridSubsystem>())
+		{
+			SpatialGrid->UnregisterActor(Actor);
+		}
+	}
+}
+
+// ========================================================================
+// クエリ
+// ========================================================================
+
+TArray<AActor*> USpatialGridSubsystem::FindActorsInRadius(FVector Center, float Radius, int32 CategoryMask) const
+{
+	TArray<AActor*> Result;
+	Grid.QueryRadius(Center, Radius, static_cast<uint8>(CategoryMask), Result);
+	return Result;
+}
+
+TArray<AActor*> USpatialGridSubsystem::FindNearestActors(FVector Center, int32 MaxCount, float MaxRadius, int32 CategoryMask) const
+{
+	TArray<AActor*> Result;
+	Grid.QueryNearest(Center, MaxCount, MaxRadius, static_cast<uint8>(CategoryMask), Result);
+	return Result;
+}
+
+TArray<AActor*> USpatialGridSubsystem::FindActorsInCone(FVector Origin, FVector Direction, float Radius, float HalfAngleDegrees, int32 CategoryMask) const
+{
+	TArray<AActor*> Result;
+	Grid.QueryCone(Origin, Direction, Radius, HalfAngleDegrees, static_cast<uint8>(CategoryMask), Result);
+	return Result;
+}
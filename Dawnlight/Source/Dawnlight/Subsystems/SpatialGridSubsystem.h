@@ -0,0 +1,91 @@
+// Soul Reaper - Dawnlight Project
+// Copyright (c) 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Utilities/DawnlightSpatialGrid.h"
+#include "SpatialGridSubsystem.generated.h"
+
+/**
+ * 空間グリッドサブシステム
+ *
+ * 敵・動物・プレイヤーの位置を均一グリッドで管理し、近接クエリを提供する
+ * - 毎フレーム、登録アクターの位置を差分更新（セルをまたいだ時のみ移動）
+ * - 半径・最近傍N件・扇形クエリ（線形探索や物理トレースの代替）
+ */
+UCLASS()
+class DAWNLIGHT_API USpatialGridSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	USpatialGridSubsystem();
+
+	// ========================================================================
+	// UWorldSubsystem インターフェース
+	// ========================================================================
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+	// ========================================================================
+	// FTickableGameObject インターフェース
+	// ========================================================================
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// ========================================================================
+	// 登録
+	// ========================================================================
+
+	/** アクターを登録 */
+	UFUNCTION(BlueprintCallable, Category = "空間グリッド")
+	void RegisterActor(AActor* Actor, EDawnlightSpatialCategory Category);
+
+	/** アクターの登録を解除 */
+	UFUNCTION(BlueprintCallable, Category = "空間グリッド")
+	void UnregisterActor(AActor* Actor);
+
+	/** 登録数 */
+	UFUNCTION(BlueprintPure, Category = "空間グリッド")
+	int32 GetRegisteredActorCount() const { return Grid.Num(); }
+
+	// ========================================================================
+	// クエリ
+	// ========================================================================
+
+	/** 半径内のアクターを取得（順不同） */
+	UFUNCTION(BlueprintCallable, Category = "空間グリッド")
+	TArray<AActor*> FindActorsInRadius(FVector Center, float Radius,
+		UPARAM(meta = (Bitmask, BitmaskEnum = "/Script/Dawnlight.EDawnlightSpatialCategory")) int32 CategoryMask) const;
+
+	/** 半径内で近い順に最大 MaxCount 件を取得 */
+	UFUNCTION(BlueprintCallable, Category = "空間グリッド")
+	TArray<AActor*> FindNearestActors(FVector Center, int32 MaxCount, float MaxRadius,
+		UPARAM(meta = (Bitmask, BitmaskEnum = "/Script/Dawnlight.EDawnlightSpatialCategory")) int32 CategoryMask) const;
+
+	/** 扇形内のアクターを取得（順不同） */
+	UFUNCTION(BlueprintCallable, Category = "空間グリッド")
+	TArray<AActor*> FindActorsInCone(FVector Origin, FVector Direction, float Radius, float HalfAngleDegrees,
+		UPARAM(meta = (Bitmask, BitmaskEnum = "/Script/Dawnlight.EDawnlightSpatialCategory")) int32 CategoryMask) const;
+
+	/** グリッドへの直接アクセス（毎フレーム呼ぶC++側のクエリ用、出力配列を使い回せる） */
+	const FDawnlightSpatialGrid& GetGrid() const { return Grid; }
+
+	/** アクターを登録（ワールドに空間グリッドがない場合は何もしない） */
+	static void RegisterWithWorld(AActor* Actor, EDawnlightSpatialCategory Category);
+
+	/** アクターの登録を解除（ワールドに空間グリッドがない場合は何もしない） */
+	static void UnregisterFromWorld(AActor* Actor);
+
+private:
+	/** セルの一辺の長さ（敵の攻撃範囲・動物の逃走範囲に近い値） */
+	static constexpr float CellSize = 500.0f;
+
+	/** 空間グリッド */
+	FDawnlightSpatialGrid Grid;
+};
@@ -0,0 +1,253 @@
+// Soul Reaper - Dawnlight Project
+// Copyright (c) 2025. All Rights Reserved.
+
+#include "SpawnSchedulerSubsystem.h"
+#include "Dawnlight.h"
+#include "DawnlightStats.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+
+DECLARE_CYCLE_STAT(TEXT("Spawn Request"), STAT_DawnlightSpawnRequest, STATGROUP_DawnlightSpawn);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Spawns Executed"), STAT_DawnlightSpawnsExecuted, STATGROUP_DawnlightSpawn);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Spawns Pending"), STAT_DawnlightSpawnsPending, STATGROUP_DawnlightSpawn);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Last Spawn Time (ms)"), STAT_DawnlightLastSpawnTimeMs, STATGROUP_DawnlightSpawn);
+
+namespace
+{
+	/** 平均処理時間の更新係数 */
+	constexpr float SpawnTimeSmoothing = 0.2f;
+
+	/** 消費済みの領域を詰め始める先頭位置（小さなキューでは詰めない） */
+	constexpr int32 MinCompactHead = 32;
+}
+
+void USpawnSchedulerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	UE_LOG(LogDawnlight, Log, TEXT("[SpawnSchedulerSubsystem] 初期化完了（予算: %.2fms/フレーム）"), FrameBudgetMs);
+}
+
+void USpawnSchedulerSubsystem::Deinitialize()
+{
+	for (FSpawnQueue& Queue : Queues)
+	{
+		Queue.Requests.Empty();
+		Queue.Head = 0;
+	}
+
+	Super::Deinitialize();
+}
+
+bool USpawnSchedulerSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// ゲームワールドでのみ作成
+	if (const UWorld* World = Cast<UWorld>(Outer))
+	{
+		return World->IsGameWorld();
+	}
+	return false;
+}
+
+TStatId USpawnSchedulerSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USpawnSchedulerSubsystem, STATGROUP_Tickables);
+}
+
+// ========================================================================
+// 更新
+// ========================================================================
+
+void USpawnSchedulerSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (GetTotalPendingSpawnCount() == 0)
+	{
+		SET_DWORD_STAT(STAT_DawnlightSpawnsPending, 0);
+		return;
+	}
+
+	const double BudgetSeconds = FrameBudgetMs / 1000.0;
+	const double StartTime = FPlatformTime::Seconds();
+	int32 SpawnedThisFrame = 0;
+
+	FSpawnRequest Request;
+	while (PopNextRequest(Request))
+	{
+		ExecuteRequest(Request);
+		++SpawnedThisFrame;
+
+		if (SpawnedThisFrame < MinSpawnsPerFrame)
+		{
+			continue;
+		}
+
+		// 次の1件が予算に収まらない見込みなら次のフレームに回す
+		const double Elapsed = FPlatformTime::Seconds() - StartTime;
+		if (Elapsed + AverageSpawnTimeMs / 1000.0 > BudgetSeconds)
+		{
+			break;
+		}
+	}
+
+	const int32 Remaining = GetTotalPendingSpawnCount();
+	if (Remaining > 0)
+	{
+		++CarriedOverFrameCount;
+
+		UE_LOG(LogDawnlight, Verbose, TEXT("[SpawnSchedulerSubsystem] %d件スポーン、%d件を次フレームに持ち越し"),
+			SpawnedThisFrame, Remaining);
+	}
+
+	SET_DWORD_STAT(STAT_DawnlightSpawnsPending, Remaining);
+}
+
+// ========================================================================
+// スポーン要求
+// ========================================================================
+
+void USpawnSchedulerSubsystem::EnqueueSpawn(ESpawnPriority Priority, UObject* Owner, TFunction<void()>&& SpawnFunc)
+{
+	if (!SpawnFunc)
+	{
+		return;
+	}
+
+	const int32 QueueIndex = FMath::Clamp(static_cast<int32>(Priority), 0, NumPriorities - 1);
+
+	FSpawnRequest& Request = Queues[QueueIndex].Requests.AddDefaulted_GetRef();
+	Request.Owner = Owner;
+	Request.SpawnFunc = MoveTemp(SpawnFunc);
+}
+
+void USpawnSchedulerSubsystem::EnqueueSpawnInWorld(UWorld* World, ESpawnPriority Priority, UObject* Owner, TFunction<void()>&& SpawnFunc)
+{
+	if (World)
+	{
+		if (USpawnSchedulerSubsystem* Scheduler = World->GetSubsystem<USpawnSchedulerSubsystem>())
+		{
+			Scheduler->EnqueueSpawn(Priority, Owner, MoveTemp(SpawnFunc));
+			return;
+		}
+	}
+
+	// サブシステムがない場合はスポーンを失わないよう即座に実行
+	if (SpawnFunc)
+	{
+		SpawnFunc();
+	}
+}
+
+int32 USpawnSchedulerSubsystem::CancelSpawns(const UObject* Owner)
+{
+	int32 Removed = 0;
+
+	for (FSpawnQueue& Queue : Queues)
+	{
+		Queue.Compact();
+		Removed += Queue.Requests.RemoveAll([Owner](const FSpawnRequest& Request)
+		{
+			return Request.Owner.Get() == Owner;
+		});
+	}
+
+	if (Removed > 0)
+	{
+		UE_LOG(LogDawnlight, Verbose, TEXT("[SpawnSchedulerSubsystem] スポーン要求を%d件破棄: %s"),
+			Removed, *GetNameSafe(Owner));
+	}
+
+	return Removed;
+}
+
+void USpawnSchedulerSubsystem::FlushAllSpawns()
+{
+	FSpawnRequest Request;
+	while (PopNextRequest(Request))
+	{
+		ExecuteRequest(Request);
+	}
+
+	SET_DWORD_STAT(STAT_DawnlightSpawnsPending, 0);
+}
+
+bool USpawnSchedulerSubsystem::PopNextRequest(FSpawnRequest& OutRequest)
+{
+	for (FSpawnQueue& Queue : Queues)
+	{
+		while (Queue.Num() > 0)
+		{
+			FSpawnRequest& Front = Queue.Requests[Queue.Head++];
+			OutRequest.Owner = Front.Owner;
+			OutRequest.SpawnFunc = MoveTemp(Front.SpawnFunc);
+			Front.Owner.Reset();
+
+			// 空になったら先頭に戻し、消費済みが半分を超えたら詰める（取り出しは償却O(1)）
+			if (Queue.Num() == 0)
+			{
+				Queue.Requests.Reset();
+				Queue.Head = 0;
+			}
+			else if (Queue.Head >= MinCompactHead && Queue.Head * 2 >= Queue.Requests.Num())
+			{
+				Queue.Compact();
+			}
+
+			if (OutRequest.Owner.IsValid())
+			{
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+void USpawnSchedulerSubsystem::FSpawnQueue::Compact()
+{
+	if (Head > 0)
+	{
+		Requests.RemoveAt(0, Head, EAllowShrinking::No);
+		Head = 0;
+	}
+}
+
+void USpawnSchedulerSubsystem::ExecuteRequest(FSpawnRequest& Request)
+{
+	SCOPE_CYCLE_COUNTER(STAT_DawnlightSpawnRequest);
+
+	const double StartTime = FPlatformTime::Seconds();
+	Request.SpawnFunc();
+	LastSpawnTimeMs = static_cast<float>((FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+	AverageSpawnTimeMs = AverageSpawnTimeMs > 0.0f
+		? FMath::Lerp(AverageSpawnTimeMs, LastSpawnTimeMs, SpawnTimeSmoothing)
+		: LastSpawnTimeMs;
+
+	INC_DWORD_STAT(STAT_DawnlightSpawnsExecuted);
+	SET_FLOAT_STAT(STAT_DawnlightLastSpawnTimeMs, LastSpawnTimeMs);
+
+	// 実行後にキャプチャを解放
+	Request.SpawnFunc.Reset();
+}
+
+// ========================================================================
+// 状態取得
+// ========================================================================
+
+int32 USpawnSchedulerSubsystem::GetPendingSpawnCount(ESpawnPriority Priority) const
+{
+	const int32 QueueIndex = static_cast<int32>(Priority);
+	return (QueueIndex >= 0 && QueueIndex < NumPriorities) ? Queues[QueueIndex].Num() : 0;
+}
+
+int32 USpawnSchedulerSubsystem::GetTotalPendingSpawnCount() const
+{
+	int32 Total = 0;
+	for (const FSpawnQueue& Queue : Queues)
+	{
+		Total += Queue.Num();
+	}
+	return Total;
+}
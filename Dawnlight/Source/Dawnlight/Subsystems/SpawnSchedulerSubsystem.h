@@ -0,0 +1,140 @@
+// Soul Reaper - Dawnlight Project
+// Copyright (c) 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SpawnSchedulerSubsystem.generated.h"
+
+/**
+ * スポーン優先度（値が小さいほど先に処理）
+ */
+UENUM(BlueprintType)
+enum class ESpawnPriority : uint8
+{
+	Boss			UMETA(DisplayName = "ボス"),
+	WaveEnemy		UMETA(DisplayName = "ウェーブの敵"),
+	Animal			UMETA(DisplayName = "動物")
+};
+
+/**
+ * スポーンスケジューラーサブシステム
+ *
+ * ウェーブの敵・動物のスポーン要求をキューに積み、1フレームの時間予算内で処理する
+ * - ボス → ウェーブの敵 → 動物 の順に処理
+ * - 予算を超える分は次のフレームに持ち越す（1フレーム最低 MinSpawnsPerFrame 件は処理）
+ * - スポーン1件ごとの処理時間を stat に記録（stat DawnlightSpawn）
+ */
+UCLASS()
+class DAWNLIGHT_API USpawnSchedulerSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ========================================================================
+	// UWorldSubsystem インターフェース
+	// ========================================================================
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+	// ========================================================================
+	// FTickableGameObject インターフェース
+	// ========================================================================
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// ========================================================================
+	// スポーン要求
+	// ========================================================================
+
+	/**
+	 * スポーン要求をキューに積む
+	 * @param Owner 要求元（破棄されていれば実行しない、CancelSpawns のキー）
+	 */
+	void EnqueueSpawn(ESpawnPriority Priority, UObject* Owner, TFunction<void()>&& SpawnFunc);
+
+	/** スポーン要求をキューに積む（ワールドにサブシステムがない場合は即座に実行） */
+	static void EnqueueSpawnInWorld(UWorld* World, ESpawnPriority Priority, UObject* Owner, TFunction<void()>&& SpawnFunc);
+
+	/**
+	 * 要求元のスポーン要求を全て破棄
+	 * @return 破棄した数
+	 */
+	int32 CancelSpawns(const UObject* Owner);
+
+	/** キュー内のスポーン要求を予算を無視して全て実行 */
+	void FlushAllSpawns();
+
+	// ========================================================================
+	// 状態取得
+	// ========================================================================
+
+	/** 優先度ごとの待機中の要求数 */
+	int32 GetPendingSpawnCount(ESpawnPriority Priority) const;
+
+	/** 待機中の要求の合計 */
+	int32 GetTotalPendingSpawnCount() const;
+
+	/** 直前のスポーン1件の処理時間（ミリ秒） */
+	float GetLastSpawnTimeMs() const { return LastSpawnTimeMs; }
+
+	/** スポーン1件の平均処理時間（ミリ秒、指数移動平均） */
+	float GetAverageSpawnTimeMs() const { return AverageSpawnTimeMs; }
+
+	/** 予算超過で要求を持ち越したフレーム数 */
+	int32 GetCarriedOverFrameCount() const { return CarriedOverFrameCount; }
+
+	// ========================================================================
+	// 設定
+	// ========================================================================
+
+	/** 1フレームにスポーンに使う時間（ミリ秒） */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "スポーン|設定", meta = (ClampMin = "0.1"))
+	float FrameBudgetMs = 1.0f;
+
+	/** 予算に関わらず1フレームに処理する最低件数（キューが止まらないように） */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "スポーン|設定", meta = (ClampMin = "1"))
+	int32 MinSpawnsPerFrame = 1;
+
+private:
+	/** スポーン要求 */
+	struct FSpawnRequest
+	{
+		TWeakObjectPtr<UObject> Owner;
+		TFunction<void()> SpawnFunc;
+	};
+
+	/** FIFOキュー（先頭インデックスで取り出し、消費済みの領域はまとめて詰める） */
+	struct FSpawnQueue
+	{
+		TArray<FSpawnRequest> Requests;
+
+		/** 次に取り出す要求の位置 */
+		int32 Head = 0;
+
+		int32 Num() const { return Requests.Num() - Head; }
+
+		/** 消費済みの領域を除去 */
+		void Compact();
+	};
+
+	static constexpr int32 NumPriorities = 3;
+
+	/** 優先度ごとのキュー */
+	FSpawnQueue Queues[NumPriorities];
+
+	/** 統計 */
+	float LastSpawnTimeMs = 0.0f;
+	float AverageSpawnTimeMs = 0.0f;
+	int32 CarriedOverFrameCount = 0;
+
+	/** 最も優先度の高い要求を取り出す（要求元が破棄されたものは捨てる） */
+	bool PopNextRequest(FSpawnRequest& OutRequest);
+
+	/** 要求を実行して処理時間を記録 */
+	void ExecuteRequest(FSpawnRequest& Request);
+};
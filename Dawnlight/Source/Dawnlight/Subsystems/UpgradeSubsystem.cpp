@@ -4,6 +4,44 @@
 #include "Data/UpgradeDataAsset.h"
 #include "Engine/AssetManager.h"
 #include "Dawnlight.h"
+#include "DawnlightStats.h"
+
+namespace
+{
+	/** Mask の立っているビットが全て Owned にも立っているか */
+	bool IsMaskSubsetOf(const TBitArray<>& Mask, const TBitArray<>& Owned)
+	{
+		const uint32* MaskWords = Mask.GetData();
+		const uint32* OwnedWords = Owned.GetData();
+		const int32 NumWords = FBitSet::CalculateNumWords(Mask.Num());
+
+		for (int32 Word = 0; Word < NumWords; ++Word)
+		{
+			if ((MaskWords[Word] & ~OwnedWords[Word]) != 0)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/** Mask と Owned に共通のビットがあるか */
+	bool IsMaskIntersecting(const TBitArray<>& Mask, const TBitArray<>& Owned)
+	{
+		const uint32* MaskWords = Mask.GetData();
+		const uint32* OwnedWords = Owned.GetData();
+		const int32 NumWords = FBitSet::CalculateNumWords(Mask.Num());
+
+		for (int32 Word = 0; Word < NumWords; ++Word)
+		{
+			if ((MaskWords[Word] & OwnedWords[Word]) != 0)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+}
 
 // ========================================================================
 // UWorldSubsystem インターフェース
@@ -13,8 +51,10 @@ void UUpgradeSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
 
-	// アップグレードアセットをロード
+	// アップグレードアセットをロードしてインデックスを構築
 	LoadAllUpgradeAssets();
+	BuildUpgradeIndex();
+	BuildSetBonusTracker();
 
 	// ステータスを初期化
 	for (int32 i = 0; i < static_cast<int32>(EStatModifierType::Max); ++i)
@@ -47,42 +87,22 @@ bool UUpgradeSubsystem::ShouldCreateSubsystem(UObject* Outer) const
 
 TArray<UUpgradeDataAsset*> UUpgradeSubsystem::GenerateUpgradeChoices(int32 WaveNumber, int32 ChoiceCount)
 {
+	DAWNLIGHT_SCOPE_CYCLE_COUNTER(STAT_DawnlightGenerateUpgradeChoices);
+
 	TArray<UUpgradeDataAsset*> Choices;
-	TSet<FName> UsedIDs;  // 重複防止
+	TBitArray<> PickedMask(false, AllUpgrades.Num());  // 重複防止
 
 	for (int32 i = 0; i < ChoiceCount; ++i)
 	{
-		// レアリティをロール
-		EUpgradeRarity Rarity = RollRarity(WaveNumber);
-
-		// 候補を取得
-		TArray<UUpgradeDataAsset*> Candidates = GetEligibleUpgrades(WaveNumber, Rarity);
-
-		// 既に選ばれたものを除外
-		Candidates.RemoveAll([&UsedIDs](UUpgradeDataAsset* Upgrade)
+		const int32 Index = SampleUpgradeIndex(WaveNumber, PickedMask);
+		if (Index == INDEX_NONE)
 		{
-			return UsedIDs.Contains(Upgrade->UpgradeID);
-		});
-
-		// 候補がない場合、レアリティを下げて再試行
-		while (Candidates.Num() == 0 && Rarity > EUpgradeRarity::Common)
-		{
-			Rarity = static_cast<EUpgradeRarity>(static_cast<int32>(Rarity) - 1);
-			Candidates = GetEligibleUpgrades(WaveNumber, Rarity);
-			Candidates.RemoveAll([&UsedIDs](UUpgradeDataAsset* Upgrade)
-			{
-				return UsedIDs.Contains(Upgrade->UpgradeID);
-			});
+			// 取得可能な候補が残っていない
+			break;
 		}
 
-		if (Candidates.Num() > 0)
-		{
-			// ランダムに1つ選択
-			int32 Index = FMath::RandRange(0, Candidates.Num() - 1);
-			UUpgradeDataAsset* Selected = Candidates[Index];
-			Choices.Add(Selected);
-			UsedIDs.Add(Selected->UpgradeID);
-		}
+		PickedMask[Index] = true;
+		Choices.Add(AllUpgrades[Index]);
 	}
 
 	// 最後に生成した選択肢を保存
@@ -146,10 +166,16 @@ bool UUpgradeSubsystem::AcquireUpgrade(UUpgradeDataAsset* Upgrade, int32 WaveNum
 		AcquiredUpgrades.Add(NewAcquired);
 	}
 
+	if (const int32* Index = UpgradeIndexByID.Find(Upgrade->UpgradeID))
+	{
+		MarkUpgradeAcquired(*Index, NewStackCount);
+	}
+
 	// ステータスを再計算
 	RecalculateStats();
 
 	// イベント発火
+	CSV_EVENT(Dawnlight, TEXT("Upgrade/%s"), *Upgrade->UpgradeID.ToString());
 	OnUpgradeAcquired.Broadcast(Upgrade, NewStackCount);
 
 	UE_LOG(LogDawnlight, Log, TEXT("[UpgradeSubsystem] アップグレード取得: %s (スタック: %d)"),
@@ -173,6 +199,12 @@ TArray<UUpgradeDataAsset*> UUpgradeSubsystem::RerollUpgradeChoices(int32 WaveNum
 
 bool UUpgradeSubsystem::HasUpgrade(FName UpgradeID) const
 {
+	if (const int32* Index = UpgradeIndexByID.Find(UpgradeID))
+	{
+		return OwnedMask[*Index];
+	}
+
+	// プール外のアップグレード
 	return AcquiredUpgrades.ContainsByPredicate([UpgradeID](const FAcquiredUpgrade& Acquired)
 	{
 		return Acquired.UpgradeData && Acquired.UpgradeData->UpgradeID == UpgradeID;
@@ -181,6 +213,12 @@ bool UUpgradeSubsystem::HasUpgrade(FName UpgradeID) const
 
 int32 UUpgradeSubsystem::GetUpgradeStackCount(FName UpgradeID) const
 {
+	if (const int32* Index = UpgradeIndexByID.Find(UpgradeID))
+	{
+		return StackCounts[*Index];
+	}
+
+	// プール外のアップグレード
 	const FAcquiredUpgrade* Found = AcquiredUpgrades.FindByPredicate([UpgradeID](const FAcquiredUpgrade& Acquired)
 	{
 		return Acquired.UpgradeData && Acquired.UpgradeData->UpgradeID == UpgradeID;
@@ -196,6 +234,12 @@ bool UUpgradeSubsystem::CanAcquireUpgrade(UUpgradeDataAsset* Upgrade) const
 		return false;
 	}
 
+	// プール内のアップグレードは事前計算したマスクで判定（ウェーブ要件は見ない）
+	if (const int32* Index = UpgradeIndexByID.Find(Upgrade->UpgradeID))
+	{
+		return IsUpgradeIndexEligible(*Index, MAX_int32);
+	}
+
 	// 前提条件チェック
 	for (const FName& PrereqID : Upgrade->PrerequisiteUpgradeIDs)
 	{
@@ -261,9 +305,6 @@ void UUpgradeSubsystem::RecalculateStats()
 		}
 	}
 
-	// セットボーナスを計算して加算
-	CalculateSetBonuses();
-
 	// イベント発火
 	OnStatsRecalculated.Broadcast();
 
@@ -283,57 +324,71 @@ float UUpgradeSubsystem::GetStatValue(EStatModifierType StatType) const
 void UUpgradeSubsystem::UpdateSoulCounts(const TMap<ESoulType, int32>& SoulCounts)
 {
 	CurrentSoulCounts = SoulCounts;
+	CalculateSetBonuses();
 	RecalculateStats();
 }
 
 void UUpgradeSubsystem::CalculateSetBonuses()
 {
-	TMap<ESoulType, int32> OldTiers = ActiveSetBonusTiers;
-	ActiveSetBonusTiers.Empty();
-
-	// 各セットボーナスデータを確認
-	for (const TObjectPtr<USoulSetBonusDataAsset>& SetBonus : AllSetBonuses)
+	// 収集数が変わったソウルタイプだけ段階を進める（全段階の再計算はしない）
+	for (int32 TypeIndex = 0; TypeIndex < static_cast<int32>(ESoulType::Max); ++TypeIndex)
 	{
-		if (!SetBonus)
+		if (!SetBonusTracker.HasThresholds(TypeIndex))
 		{
 			continue;
 		}
 
-		// 該当するソウルタイプの収集数を取得
-		const int32* CollectedCount = CurrentSoulCounts.Find(SetBonus->SoulType);
-		if (!CollectedCount || *CollectedCount <= 0)
+		const ESoulType SoulType = static_cast<ESoulType>(TypeIndex);
+		const int32 CollectedCount = CurrentSoulCounts.FindRef(SoulType);
+		if (CollectedCount == SetBonusTracker.GetCount(TypeIndex))
 		{
 			continue;
 		}
 
-		// 段階ごとに確認して、最高の段階を決定
-		int32 HighestTier = 0;
-		for (int32 TierIndex = 0; TierIndex < SetBonus->BonusTiers.Num(); TierIndex++)
+		const int32 NewTier = SetBonusTracker.UpdateCount(TypeIndex, CollectedCount, [this, SoulType, CollectedCount](int32 Slot, int32 Tier)
 		{
-			const FSetBonusTier& Tier = SetBonus->BonusTiers[TierIndex];
-			if (*CollectedCount >= Tier.RequiredCount)
-			{
-				HighestTier = TierIndex + 1;  // 1から始まる段階番号
-			}
-		}
+			const USoulSetBonusDataAsset* SetBonus = AllSetBonuses[SetBonusIndexBySoulType[Slot]];
+			UE_LOG(LogDawnlight, Log, TEXT("[UpgradeSubsystem] セットボーナス発動: %s 段階 %d (収集数: %d)"),
+				*SetBonus->SetName.ToString(), Tier, CollectedCount);
+
+			OnSetBonusActivated.Broadcast(SoulType, Tier);
+		});
 
 		// 発動した段階を記録
-		if (HighestTier > 0)
+		if (NewTier > 0)
 		{
-			ActiveSetBonusTiers.Add(SetBonus->SoulType, HighestTier);
-			UE_LOG(LogDawnlight, Log, TEXT("[UpgradeSubsystem] セットボーナス発動: %s 段階 %d (収集数: %d)"),
-				*SetBonus->SetName.ToString(), HighestTier, *CollectedCount);
+			ActiveSetBonusTiers.Add(SoulType, NewTier);
+		}
+		else
+		{
+			ActiveSetBonusTiers.Remove(SoulType);
 		}
 	}
+}
+
+void UUpgradeSubsystem::BuildSetBonusTracker()
+{
+	SetBonusTracker.Reset();
+	SetBonusIndexBySoulType.Init(INDEX_NONE, static_cast<int32>(ESoulType::Max));
 
-	// 新しく発動したボーナスをイベント発火
-	for (const auto& Pair : ActiveSetBonusTiers)
+	for (int32 i = 0; i < AllSetBonuses.Num(); ++i)
 	{
-		const int32* OldTier = OldTiers.Find(Pair.Key);
-		if (!OldTier || *OldTier < Pair.Value)
+		const USoulSetBonusDataAsset* SetBonus = AllSetBonuses[i];
+		if (!SetBonus || SetBonus->SoulType == ESoulType::None || SetBonus->SoulType == ESoulType::Max)
 		{
-			OnSetBonusActivated.Broadcast(Pair.Key, Pair.Value);
+			continue;
 		}
+
+		// 同じソウルタイプが複数ある場合は後から来た方を使う
+		const int32 TypeIndex = static_cast<int32>(SetBonus->SoulType);
+		SetBonusIndexBySoulType[TypeIndex] = i;
+
+		TArray<int32, TInlineAllocator<8>> Thresholds;
+		for (const FSetBonusTier& Tier : SetBonus->BonusTiers)
+		{
+			Thresholds.Add(Tier.RequiredCount);
+		}
+		SetBonusTracker.SetThresholds(TypeIndex, Thresholds);
 	}
 }
 
@@ -373,6 +428,8 @@ void UUpgradeSubsystem::ResetForNewLoop()
 	RerollCount = 0;
 	CurrentSoulCounts.Empty();
 	ActiveSetBonusTiers.Empty();
+	SetBonusTracker.ResetCounts();
+	ResetOwnershipMasks();
 
 	RecalculateStats();
 
@@ -386,6 +443,8 @@ void UUpgradeSubsystem::FullReset()
 	RerollCount = 0;
 	CurrentSoulCounts.Empty();
 	ActiveSetBonusTiers.Empty();
+	SetBonusTracker.ResetCounts();
+	ResetOwnershipMasks();
 
 	for (auto& Pair : CalculatedStats)
 	{
@@ -399,76 +458,85 @@ void UUpgradeSubsystem::FullReset()
 // 内部処理
 // ========================================================================
 
-EUpgradeRarity UUpgradeSubsystem::RollRarity(int32 WaveNumber) const
+int32 UUpgradeSubsystem::SampleUpgradeIndex(int32 WaveNumber, const TBitArray<>& PickedMask) const
 {
-	// ウェーブが進むほどレア度が上がりやすい
-	float LuckBonus = FMath::Min(WaveNumber * 2.0f, 20.0f);  // 最大20%ボーナス
-
-	float TotalWeight = 0.0f;
-	for (const auto& Pair : WeightSettings.RarityWeights)
+	if (SelectionTables.Num() == 0)
 	{
-		float Weight = Pair.Value;
-
-		// レア以上はウェーブボーナスを適用
-		if (Pair.Key >= EUpgradeRarity::Rare)
-		{
-			Weight += LuckBonus * 0.1f;
-		}
-
-		TotalWeight += Weight;
+		return INDEX_NONE;
 	}
 
-	float Roll = FMath::FRandRange(0.0f, TotalWeight);
-	float CurrentWeight = 0.0f;
+	const int32 LuckLevel = GetLuckLevel(WaveNumber);
+	const FDawnlightAliasTable& Table = SelectionTables[LuckLevel];
 
-	for (const auto& Pair : WeightSettings.RarityWeights)
+	// 大半のアップグレードが取得可能なうちは数回の抽選で決まる
+	for (int32 Attempt = 0; Attempt < MaxRejectionSamples; ++Attempt)
 	{
-		float Weight = Pair.Value;
-		if (Pair.Key >= EUpgradeRarity::Rare)
+		const int32 Index = Table.Sample();
+		if (Index == INDEX_NONE)
 		{
-			Weight += LuckBonus * 0.1f;
+			return INDEX_NONE;
 		}
 
-		CurrentWeight += Weight;
-		if (Roll <= CurrentWeight)
+		if (!PickedMask[Index] && IsUpgradeIndexEligible(Index, WaveNumber))
 		{
-			return Pair.Key;
+			return Index;
 		}
 	}
 
-	return EUpgradeRarity::Common;
-}
-
-TArray<UUpgradeDataAsset*> UUpgradeSubsystem::GetEligibleUpgrades(int32 WaveNumber, EUpgradeRarity Rarity) const
-{
-	TArray<UUpgradeDataAsset*> Eligible;
+	// 候補が少なく棄却が続いた場合は、取得可能なものだけで重み付き抽選
+	TArray<int32> Candidates;
+	TArray<float> CandidateWeights;
+	float TotalWeight = 0.0f;
 
-	for (UUpgradeDataAsset* Upgrade : AllUpgrades)
+	for (int32 Index = 0; Index < UpgradeIndex.Num(); ++Index)
 	{
-		if (!Upgrade)
+		if (PickedMask[Index] || !IsUpgradeIndexEligible(Index, WaveNumber))
 		{
 			continue;
 		}
 
-		// レアリティチェック
-		if (Upgrade->Rarity != Rarity)
+		const float Weight = GetSelectionWeight(Index, LuckLevel);
+		if (Weight > 0.0f)
 		{
-			continue;
+			Candidates.Add(Index);
+			CandidateWeights.Add(Weight);
+			TotalWeight += Weight;
 		}
+	}
+
+	if (Candidates.Num() == 0)
+	{
+		return INDEX_NONE;
+	}
 
-		// ウェーブ要件チェック
-		if (WaveNumber < Upgrade->MinWaveRequired)
+	float Roll = FMath::FRandRange(0.0f, TotalWeight);
+	for (int32 i = 0; i < Candidates.Num(); ++i)
+	{
+		Roll -= CandidateWeights[i];
+		if (Roll <= 0.0f)
 		{
-			continue;
+			return Candidates[i];
 		}
+	}
+
+	return Candidates.Last();
+}
+
+TArray<UUpgradeDataAsset*> UUpgradeSubsystem::GetEligibleUpgrades(int32 WaveNumber, EUpgradeRarity Rarity) const
+{
+	TArray<UUpgradeDataAsset*> Eligible;
+
+	if (!RarityBuckets.IsValidIndex(static_cast<int32>(Rarity)))
+	{
+		return Eligible;
+	}
 
-		// 取得可能かチェック
-		if (!CanAcquireUpgrade(Upgrade))
+	for (const int32 Index : RarityBuckets[static_cast<int32>(Rarity)])
+	{
+		if (IsUpgradeIndexEligible(Index, WaveNumber))
 		{
-			continue;
+			Eligible.Add(AllUpgrades[Index]);
 		}
-
-		Eligible.Add(Upgrade);
 	}
 
 	return Eligible;
@@ -504,3 +572,160 @@ void UUpgradeSubsystem::LoadAllUpgradeAssets()
 		}
 	}
 }
+
+// ========================================================================
+// 取得可否インデックス
+// ========================================================================
+
+void UUpgradeSubsystem::BuildUpgradeIndex()
+{
+	// ID重複は後から来た方を除外（所持判定がIDで一意になるように）
+	UpgradeIndexByID.Reset();
+	for (int32 i = 0; i < AllUpgrades.Num(); ++i)
+	{
+		const UUpgradeDataAsset* Upgrade = AllUpgrades[i];
+		if (!Upgrade || UpgradeIndexByID.Contains(Upgrade->UpgradeID))
+		{
+			if (Upgrade)
+			{
+				UE_LOG(LogDawnlight, Warning, TEXT("[UpgradeSubsystem] アップグレードIDが重複しています: %s"),
+					*Upgrade->UpgradeID.ToString());
+			}
+			AllUpgrades.RemoveAt(i--);
+			continue;
+		}
+
+		UpgradeIndexByID.Add(Upgrade->UpgradeID, i);
+	}
+
+	const int32 NumUpgrades = AllUpgrades.Num();
+
+	// 前提・排他条件をマスク化
+	UpgradeIndex.Reset();
+	UpgradeIndex.SetNum(NumUpgrades);
+	RarityBuckets.Reset();
+	RarityBuckets.SetNum(static_cast<int32>(EUpgradeRarity::Max));
+
+	for (int32 i = 0; i < NumUpgrades; ++i)
+	{
+		const UUpgradeDataAsset* Upgrade = AllUpgrades[i];
+		FUpgradeIndexEntry& Entry = UpgradeIndex[i];
+		Entry.PrerequisiteMask.Init(false, NumUpgrades);
+		Entry.ExclusionMask.Init(false, NumUpgrades);
+		Entry.MinWaveRequired = Upgrade->MinWaveRequired;
+
+		for (const FName& PrereqID : Upgrade->PrerequisiteUpgradeIDs)
+		{
+			if (const int32* PrereqIndex = UpgradeIndexByID.Find(PrereqID))
+			{
+				Entry.PrerequisiteMask[*PrereqIndex] = true;
+				Entry.bHasPrerequisites = true;
+			}
+			else
+			{
+				// プールにない前提は満たせない
+				Entry.bHasUnresolvedPrerequisite = true;
+			}
+		}
+
+		for (const FName& ExclusiveID : Upgrade->ExclusiveUpgradeIDs)
+		{
+			if (const int32* ExclusiveIndex = UpgradeIndexByID.Find(ExclusiveID))
+			{
+				Entry.ExclusionMask[*ExclusiveIndex] = true;
+				Entry.bHasExclusions = true;
+			}
+		}
+
+		if (RarityBuckets.IsValidIndex(static_cast<int32>(Upgrade->Rarity)))
+		{
+			RarityBuckets[static_cast<int32>(Upgrade->Rarity)].Add(i);
+		}
+	}
+
+	// ウェーブボーナス段階ごとに抽選テーブルを構築
+	SelectionTables.Reset();
+	SelectionTables.SetNum(MaxLuckWave + 1);
+
+	TArray<float> Weights;
+	Weights.SetNumUninitialized(NumUpgrades);
+
+	for (int32 LuckLevel = 0; LuckLevel <= MaxLuckWave; ++LuckLevel)
+	{
+		for (int32 i = 0; i < NumUpgrades; ++i)
+		{
+			Weights[i] = GetSelectionWeight(i, LuckLevel);
+		}
+		SelectionTables[LuckLevel].Build(Weights);
+	}
+
+	ResetOwnershipMasks();
+}
+
+void UUpgradeSubsystem::ResetOwnershipMasks()
+{
+	const int32 NumUpgrades = AllUpgrades.Num();
+
+	OwnedMask.Init(false, NumUpgrades);
+	MaxedMask.Init(false, NumUpgrades);
+	StackCounts.Reset();
+	StackCounts.SetNumZeroed(NumUpgrades);
+}
+
+void UUpgradeSubsystem::MarkUpgradeAcquired(int32 Index, int32 StackCount)
+{
+	const UUpgradeDataAsset* Upgrade = AllUpgrades[Index];
+
+	OwnedMask[Index] = true;
+	StackCounts[Index] = StackCount;
+	MaxedMask[Index] = !Upgrade->bStackable || StackCount >= Upgrade->MaxStacks;
+}
+
+bool UUpgradeSubsystem::IsUpgradeIndexEligible(int32 Index, int32 WaveNumber) const
+{
+	const FUpgradeIndexEntry& Entry = UpgradeIndex[Index];
+
+	if (MaxedMask[Index] || Entry.bHasUnresolvedPrerequisite || WaveNumber < Entry.MinWaveRequired)
+	{
+		return false;
+	}
+
+	// 前提は全て所持、排他は1つも所持していない
+	if (Entry.bHasPrerequisites && !IsMaskSubsetOf(Entry.PrerequisiteMask, OwnedMask))
+	{
+		return false;
+	}
+	if (Entry.bHasExclusions && IsMaskIntersecting(Entry.ExclusionMask, OwnedMask))
+	{
+		return false;
+	}
+
+	return true;
+}
+
+float UUpgradeSubsystem::GetRarityWeight(EUpgradeRarity Rarity, int32 LuckLevel) const
+{
+	float Weight = WeightSettings.RarityWeights.FindRef(Rarity);
+
+	// ウェーブが進むほどレア以上が出やすい（最大20%ボーナス）
+	if (Rarity >= EUpgradeRarity::Rare)
+	{
+		const float LuckBonus = FMath::Min(LuckLevel * 2.0f, 20.0f);
+		Weight += LuckBonus * 0.1f;
+	}
+
+	return FMath::Max(Weight, 0.0f);
+}
+
+float UUpgradeSubsystem::GetSelectionWeight(int32 Index, int32 LuckLevel) const
+{
+	const EUpgradeRarity Rarity = AllUpgrades[Index]->Rarity;
+	const int32 BucketIndex = static_cast<int32>(Rarity);
+	if (!RarityBuckets.IsValidIndex(BucketIndex) || RarityBuckets[BucketIndex].Num() == 0)
+	{
+		return 0.0f;
+	}
+
+	// レアリティを引いてからバケット内で一様に選ぶのと同じ分布
+	return GetRarityWeight(Rarity, LuckLevel) / RarityBuckets[BucketIndex].Num();
+}
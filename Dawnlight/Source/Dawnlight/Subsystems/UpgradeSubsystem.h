@@ -7,6 +7,8 @@
 #include "Data/UpgradeTypes.h"
 #include "Data/SoulTypes.h"
 #include "Data/UpgradeDataAsset.h"
+#include "Utilities/DawnlightAliasTable.h"
+#include "Utilities/SetBonusTierTracker.h"
 #include "UpgradeSubsystem.generated.h"
 
 /**
@@ -30,6 +32,32 @@ struct FAcquiredUpgrade
 	int32 AcquiredAtWave = 0;
 };
 
+/**
+ * アップグレードごとの事前計算済み取得条件
+ *
+ * ビットはアップグレードの密なインデックス（AllUpgrades の添字）に対応
+ */
+struct FUpgradeIndexEntry
+{
+	/** 前提アップグレードのマスク（全て所持していれば可） */
+	TBitArray<> PrerequisiteMask;
+
+	/** 排他アップグレードのマスク（1つでも所持していれば不可） */
+	TBitArray<> ExclusionMask;
+
+	/** 出現に必要な最小ウェーブ番号 */
+	int32 MinWaveRequired = 1;
+
+	/** 前提条件があるか（ない場合はマスク判定を省略） */
+	bool bHasPrerequisites = false;
+
+	/** 排他条件があるか（ない場合はマスク判定を省略） */
+	bool bHasExclusions = false;
+
+	/** 前提IDがプールに存在しない（常に取得不可） */
+	bool bHasUnresolvedPrerequisite = false;
+};
+
 /**
  * アップグレード選択イベント
  * Note: Dynamic delegatesはTArrayやTMapの複雑な型をパラメータにできないため、
@@ -47,6 +75,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnStatsRecalculated);
  *
  * 機能:
  * - ウェーブクリア後のランダムアップグレード選択肢生成
+ *   （所持・前提・排他をビットマスクで判定し、エイリアステーブルで O(1) 抽選）
  * - アップグレード取得・管理
  * - ソウルセットボーナス計算
  * - 最終ステータス計算
@@ -108,6 +137,10 @@ public:
 	UFUNCTION(BlueprintPure, Category = "アップグレード")
 	TArray<FAcquiredUpgrade> GetAcquiredUpgrades() const { return AcquiredUpgrades; }
 
+	/** 登録されている全アップグレードを取得 */
+	UFUNCTION(BlueprintPure, Category = "アップグレード")
+	TArray<UUpgradeDataAsset*> GetAllUpgrades() const { return AllUpgrades; }
+
 	/** 特定のアップグレードを持っているか確認 */
 	UFUNCTION(BlueprintPure, Category = "アップグレード")
 	bool HasUpgrade(FName UpgradeID) const;
@@ -188,18 +221,50 @@ protected:
 	// 内部処理
 	// ========================================================================
 
-	/** レアリティに基づいてアップグレードを選択 */
-	EUpgradeRarity RollRarity(int32 WaveNumber) const;
+	/**
+	 * レアリティ抽選と候補選択を1回のエイリアス抽選で行う
+	 * 取得不可・選択済みは棄却し、棄却が続く場合は取得可能なものだけで重み付き抽選する
+	 * @return AllUpgrades のインデックス（候補がない場合は INDEX_NONE）
+	 */
+	int32 SampleUpgradeIndex(int32 WaveNumber, const TBitArray<>& PickedMask) const;
 
 	/** 条件を満たすアップグレード候補を取得 */
 	TArray<UUpgradeDataAsset*> GetEligibleUpgrades(int32 WaveNumber, EUpgradeRarity Rarity) const;
 
-	/** セットボーナスを計算 */
+	/** 収集数からセットボーナスの段階を進める（新しく到達した段階を通知） */
 	void CalculateSetBonuses();
 
+	/** セットボーナスの閾値を段階トラッカーに登録 */
+	void BuildSetBonusTracker();
+
 	/** 登録されている全アップグレードをロード */
 	void LoadAllUpgradeAssets();
 
+	// ========================================================================
+	// 取得可否インデックス
+	// ========================================================================
+
+	/** 密なID・前提/排他マスク・レアリティ別バケット・抽選テーブルを構築 */
+	void BuildUpgradeIndex();
+
+	/** 所持マスクとスタック数をクリア */
+	void ResetOwnershipMasks();
+
+	/** 取得を所持マスクに反映 */
+	void MarkUpgradeAcquired(int32 Index, int32 StackCount);
+
+	/** インデックスのアップグレードが取得可能か（WaveNumber が MAX_int32 ならウェーブ要件を無視） */
+	bool IsUpgradeIndexEligible(int32 Index, int32 WaveNumber) const;
+
+	/** ウェーブ番号から抽選テーブルの段階を取得 */
+	static int32 GetLuckLevel(int32 WaveNumber) { return FMath::Clamp(WaveNumber, 0, MaxLuckWave); }
+
+	/** レアリティの出現重み（ウェーブボーナス込み） */
+	float GetRarityWeight(EUpgradeRarity Rarity, int32 LuckLevel) const;
+
+	/** アップグレード1つあたりの抽選重み（レアリティ重みをバケット内で等分） */
+	float GetSelectionWeight(int32 Index, int32 LuckLevel) const;
+
 private:
 	/** 全アップグレードデータ（AssetManagerからロード） */
 	UPROPERTY()
@@ -229,9 +294,46 @@ private:
 	UPROPERTY()
 	TMap<ESoulType, int32> ActiveSetBonusTiers;
 
+	/** セットボーナスの段階（ESoulType をスロットとして使用） */
+	FSetBonusTierTracker SetBonusTracker;
+
+	/** ESoulType → AllSetBonuses のインデックス（ログ用） */
+	TArray<int32> SetBonusIndexBySoulType;
+
 	/** リロール回数（コスト計算用） */
 	int32 RerollCount = 0;
 
 	/** 重み設定 */
 	FUpgradeWeight WeightSettings;
+
+	// ========================================================================
+	// 取得可否インデックス
+	// ========================================================================
+
+	/** ウェーブボーナスが上限に達するウェーブ番号 */
+	static constexpr int32 MaxLuckWave = 10;
+
+	/** フォールバックに切り替えるまでの棄却回数 */
+	static constexpr int32 MaxRejectionSamples = 16;
+
+	/** アップグレードIDから密なインデックスへの対応 */
+	TMap<FName, int32> UpgradeIndexByID;
+
+	/** アップグレードごとの取得条件（AllUpgrades と同じ並び） */
+	TArray<FUpgradeIndexEntry> UpgradeIndex;
+
+	/** レアリティ別のインデックス一覧 */
+	TArray<TArray<int32>> RarityBuckets;
+
+	/** 所持しているアップグレード */
+	TBitArray<> OwnedMask;
+
+	/** これ以上取得できないアップグレード（スタック不可で所持済み・スタック上限） */
+	TBitArray<> MaxedMask;
+
+	/** インデックスごとのスタック数 */
+	TArray<int32> StackCounts;
+
+	/** ウェーブボーナス段階ごとの抽選テーブル（全アップグレード対象） */
+	TArray<FDawnlightAliasTable> SelectionTables;
 };
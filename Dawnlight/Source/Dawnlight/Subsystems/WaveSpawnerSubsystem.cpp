@@ -3,8 +3,13 @@
 
 #include "WaveSpawnerSubsystem.h"
 #include "Dawnlight.h"
+#include "DawnlightStats.h"
 #include "Data/EnemyDataAsset.h"
 #include "Characters/EnemyCharacter.h"
+#include "Subsystems/ActorPoolSubsystem.h"
+#include "Subsystems/DawnlightAssetPreloader.h"
+#include "Subsystems/SpawnSchedulerSubsystem.h"
+#include "Data/WaveScheduleDataAsset.h"
 #include "Engine/World.h"
 #include "TimerManager.h"
 
@@ -28,14 +33,58 @@ void UWaveSpawnerSubsystem::Deinitialize()
 void UWaveSpawnerSubsystem::InitializeWaveSystem(const TArray<FWaveConfig>& InWaveConfigs)
 {
 	WaveConfigs = InWaveConfigs;
+
+	if (!FMath::IsNearlyEqual(EnemyCountMultiplier, 1.0f))
+	{
+		for (FWaveConfig& Config : WaveConfigs)
+		{
+			Config.TotalEnemies = FMath::Max(1, FMath::RoundToInt(Config.TotalEnemies * EnemyCountMultiplier));
+			Config.MaxConcurrentEnemies = FMath::Max(1, FMath::RoundToInt(Config.MaxConcurrentEnemies * EnemyCountMultiplier));
+		}
+
+		UE_LOG(LogDawnlight, Log, TEXT("[WaveSpawnerSubsystem] 敵数倍率 x%.2f を適用"), EnemyCountMultiplier);
+	}
+
 	CurrentWaveNumber = 0;
 	CurrentWaveState = EWaveState::NotStarted;
 	EnemiesSpawnedThisWave = 0;
+	CancelPendingSpawns();
 	AliveEnemies.Empty();
+	WaveTimelines.Reset();
 
 	UE_LOG(LogDawnlight, Log, TEXT("[WaveSpawnerSubsystem] ウェーブシステム初期化: %d ウェーブ"), WaveConfigs.Num());
 }
 
+void UWaveSpawnerSubsystem::InitializeWaveSchedule(UWaveScheduleDataAsset* Schedule, int32 LoopIndex)
+{
+	if (!Schedule)
+	{
+		UE_LOG(LogDawnlight, Warning, TEXT("[WaveSpawnerSubsystem] ウェーブスケジュールがありません"));
+		return;
+	}
+
+	InitializeWaveSystem(Schedule->GetWaveConfigs(LoopIndex));
+
+	WaveTimelines.SetNum(WaveConfigs.Num());
+	for (int32 WaveIndex = 0; WaveIndex < WaveConfigs.Num(); ++WaveIndex)
+	{
+		const FWaveSpawnTimeline* Baked = Schedule->GetWaveTimeline(LoopIndex, WaveIndex);
+		if (Baked && Baked->Events.Num() == WaveConfigs[WaveIndex].TotalEnemies)
+		{
+			WaveTimelines[WaveIndex] = *Baked;
+		}
+		else
+		{
+			// 敵数倍率で敵数が変わった（または未ベイク）場合は同じシードで再ベイク
+			UWaveScheduleDataAsset::BakeWave(WaveConfigs[WaveIndex], Schedule->GetWaveSeed(LoopIndex, WaveIndex),
+				Schedule->FirstSpawnDelay, Schedule->DefaultEnemyData, WaveTimelines[WaveIndex]);
+		}
+	}
+
+	UE_LOG(LogDawnlight, Log, TEXT("[WaveSpawnerSubsystem] ウェーブスケジュール適用: %s (ループ %d)"),
+		*Schedule->GetName(), LoopIndex + 1);
+}
+
 void UWaveSpawnerSubsystem::StartFirstWave()
 {
 	if (WaveConfigs.Num() == 0)
@@ -44,6 +93,8 @@ void UWaveSpawnerSubsystem::StartFirstWave()
 		return;
 	}
 
+	CancelPendingSpawns();
+
 	CurrentWaveNumber = 1;
 	EnemiesSpawnedThisWave = 0;
 	CurrentWaveState = EWaveState::InProgress;
@@ -58,17 +109,11 @@ void UWaveSpawnerSubsystem::StartFirstWave()
 		CurrentWaveNumber, Config->TotalEnemies, Config->MaxConcurrentEnemies);
 
 	// ウェーブ開始イベント
+	CSV_EVENT(Dawnlight, TEXT("WaveStart/%d"), CurrentWaveNumber);
 	OnWaveStarted.Broadcast(CurrentWaveNumber);
 
 	// スポーンタイマーを開始
-	GetWorld()->GetTimerManager().SetTimer(
-		SpawnTimerHandle,
-		this,
-		&UWaveSpawnerSubsystem::SpawnEnemy,
-		Config->SpawnInterval,
-		true,
-		0.5f  // 最初のスポーンは少し遅延
-	);
+	BeginWaveSpawning(*Config);
 }
 
 void UWaveSpawnerSubsystem::StartNextWave()
@@ -80,6 +125,8 @@ void UWaveSpawnerSubsystem::StartNextWave()
 		return;
 	}
 
+	CancelPendingSpawns();
+
 	CurrentWaveNumber++;
 	EnemiesSpawnedThisWave = 0;
 	CurrentWaveState = EWaveState::InProgress;
@@ -94,23 +141,18 @@ void UWaveSpawnerSubsystem::StartNextWave()
 		CurrentWaveNumber, Config->TotalEnemies, Config->MaxConcurrentEnemies);
 
 	// ウェーブ開始イベント
+	CSV_EVENT(Dawnlight, TEXT("WaveStart/%d"), CurrentWaveNumber);
 	OnWaveStarted.Broadcast(CurrentWaveNumber);
 
 	// スポーンタイマーを開始
-	GetWorld()->GetTimerManager().SetTimer(
-		SpawnTimerHandle,
-		this,
-		&UWaveSpawnerSubsystem::SpawnEnemy,
-		Config->SpawnInterval,
-		true,
-		0.5f
-	);
+	BeginWaveSpawning(*Config);
 }
 
 void UWaveSpawnerSubsystem::EndCurrentWave(bool bSuccess)
 {
 	// スポーンタイマーを停止
 	GetWorld()->GetTimerManager().ClearTimer(SpawnTimerHandle);
+	CancelPendingSpawns();
 
 	CurrentWaveState = bSuccess ? EWaveState::Completed : EWaveState::Failed;
 
@@ -118,6 +160,7 @@ void UWaveSpawnerSubsystem::EndCurrentWave(bool bSuccess)
 		CurrentWaveNumber, bSuccess ? TEXT("成功") : TEXT("失敗"));
 
 	// ウェーブ完了イベント
+	CSV_EVENT(Dawnlight, TEXT("WaveEnd/%d/%s"), CurrentWaveNumber, bSuccess ? TEXT("Success") : TEXT("Failed"));
 	OnWaveCompleted.Broadcast(CurrentWaveNumber, bSuccess);
 
 	// 全ウェーブ完了判定
@@ -133,13 +176,14 @@ void UWaveSpawnerSubsystem::StopAllWaves()
 	{
 		World->GetTimerManager().ClearTimer(SpawnTimerHandle);
 	}
+	CancelPendingSpawns();
 
-	// 生存中の敵を全て削除
+	// 生存中の敵を全てプールに返却
 	for (const TWeakObjectPtr<AEnemyCharacter>& Enemy : AliveEnemies)
 	{
 		if (Enemy.IsValid())
 		{
-			Enemy->Destroy();
+			Enemy->ReturnToPool();
 		}
 	}
 	AliveEnemies.Empty();
@@ -182,7 +226,7 @@ bool UWaveSpawnerSubsystem::AreAllWavesCompleted() const
 	return CurrentWaveNumber >= WaveConfigs.Num() && CurrentWaveState == EWaveState::Completed;
 }
 
-void UWaveSpawnerSubsystem::SpawnEnemy()
+void UWaveSpawnerSubsystem::RequestEnemySpawn()
 {
 	const FWaveConfig* Config = GetCurrentWaveConfig();
 	if (!Config)
@@ -190,10 +234,10 @@ void UWaveSpawnerSubsystem::SpawnEnemy()
 		return;
 	}
 
-	// スポーン上限チェック
-	if (EnemiesSpawnedThisWave >= Config->TotalEnemies)
+	// スポーン上限チェック（スケジューラーで待機中の分も含める）
+	if (EnemiesSpawnedThisWave + PendingEnemySpawns >= Config->TotalEnemies)
 	{
-		// 全ての敵をスポーン済み
+		// 全ての敵をスポーン済み（または要求済み）
 		GetWorld()->GetTimerManager().ClearTimer(SpawnTimerHandle);
 		return;
 	}
@@ -205,28 +249,113 @@ void UWaveSpawnerSubsystem::SpawnEnemy()
 		return !Enemy.IsValid();
 	});
 
-	if (AliveEnemies.Num() >= Config->MaxConcurrentEnemies)
+	if (AliveEnemies.Num() + PendingEnemySpawns >= Config->MaxConcurrentEnemies)
 	{
 		// 同時存在上限に達している
 		return;
 	}
 
-	// スポーン位置を取得
-	FVector SpawnLocation = GetRandomSpawnLocation();
+	// 敵データを選択（タイムラインがあればカーソルを進めるだけ）
+	UEnemyDataAsset* EnemyData = nullptr;
+	EEnemyColorVariant Variant = EEnemyColorVariant::Default;
+	int32 SpawnPointIndex = INDEX_NONE;
+	bool bTimelineEvent = false;
+
+	if (const FWaveSpawnTimeline* Timeline = GetCurrentTimeline())
+	{
+		if (!Timeline->Events.IsValidIndex(TimelineCursor))
+		{
+			return;
+		}
+
+		// 同時存在上限で遅れた分はそのまま後ろにずれる
+		const FWaveSpawnEvent& Event = Timeline->Events[TimelineCursor];
+		const float Elapsed = GetWorld()->GetTimeSeconds() - WaveStartTime;
+		if (Elapsed + Config->SpawnInterval * 0.5f < Event.Time)
+		{
+			return;
+		}
+
+		EnemyData = Event.EnemyData ? Event.EnemyData.Get() : DefaultEnemyData.Get();
+		Variant = Event.Variant;
+		SpawnPointIndex = Event.SpawnPointIndex;
+		bTimelineEvent = true;
+		++TimelineCursor;
+	}
+	else
+	{
+		EnemyData = SelectEnemyData();
+	}
 
-	// 敵データを選択
-	UEnemyDataAsset* EnemyData = SelectEnemyData();
 	if (!EnemyData)
 	{
 		UE_LOG(LogDawnlight, Warning, TEXT("[WaveSpawnerSubsystem] 敵データがありません"));
+		if (bTimelineEvent)
+		{
+			CountDroppedTimelineSpawn(CurrentWaveNumber);
+		}
+		return;
+	}
+
+	// ボスは優先度を上げる
+	const ESpawnPriority Priority = EnemyData->EnemyType == EEnemyType::DawnBoss
+		? ESpawnPriority::Boss
+		: ESpawnPriority::WaveEnemy;
+
+	++PendingEnemySpawns;
+
+	TWeakObjectPtr<UEnemyDataAsset> WeakEnemyData = EnemyData;
+	const int32 WaveNumber = CurrentWaveNumber;
+	USpawnSchedulerSubsystem::EnqueueSpawnInWorld(GetWorld(), Priority, this, [this, WeakEnemyData, Variant, SpawnPointIndex, WaveNumber, bTimelineEvent]()
+	{
+		PendingEnemySpawns = FMath::Max(0, PendingEnemySpawns - 1);
+		if (!SpawnEnemy(WeakEnemyData.Get(), Variant, SpawnPointIndex, WaveNumber) && bTimelineEvent)
+		{
+			CountDroppedTimelineSpawn(WaveNumber);
+		}
+	});
+}
+
+void UWaveSpawnerSubsystem::CountDroppedTimelineSpawn(int32 WaveNumber)
+{
+	// 要求後にウェーブが切り替わった場合は数えない
+	if (WaveNumber != CurrentWaveNumber || CurrentWaveState != EWaveState::InProgress)
+	{
 		return;
 	}
 
+	EnemiesSpawnedThisWave++;
+
+	UE_LOG(LogDawnlight, Warning, TEXT("[WaveSpawnerSubsystem] タイムラインのスポーンに失敗したためスキップ (%d/%d)"),
+		EnemiesSpawnedThisWave, GetCurrentWaveConfig() ? GetCurrentWaveConfig()->TotalEnemies : 0);
+
+	CheckWaveCompletion();
+}
+
+bool UWaveSpawnerSubsystem::SpawnEnemy(UEnemyDataAsset* EnemyData, EEnemyColorVariant Variant, int32 SpawnPointIndex, int32 WaveNumber)
+{
+	DAWNLIGHT_SCOPE_CYCLE_COUNTER(STAT_DawnlightSpawnEnemy);
+
+	// 要求後にウェーブが切り替わった
+	if (!EnemyData || WaveNumber != CurrentWaveNumber || CurrentWaveState != EWaveState::InProgress)
+	{
+		return false;
+	}
+
+	const FWaveConfig* Config = GetCurrentWaveConfig();
+	if (!Config)
+	{
+		return false;
+	}
+
+	// スポーン位置を取得（要求時からプレイヤーが移動しているため実行時に決める）
+	const FVector SpawnLocation = GetSpawnLocation(SpawnPointIndex);
+
 	// 敵クラスを取得
 	UClass* EnemyClass = nullptr;
-	if (EnemyData->EnemyBlueprintClass.IsValid())
+	if (!EnemyData->EnemyBlueprintClass.IsNull())
 	{
-		EnemyClass = EnemyData->EnemyBlueprintClass.LoadSynchronous();
+		EnemyClass = UDawnlightAssetPreloader::ResolveClass(this, EnemyData->EnemyBlueprintClass, TEXT("WaveSpawner"));
 	}
 
 	if (!EnemyClass)
@@ -235,40 +364,133 @@ void UWaveSpawnerSubsystem::SpawnEnemy()
 		EnemyClass = AEnemyCharacter::StaticClass();
 	}
 
-	// スポーン
-	FActorSpawnParameters SpawnParams;
-	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+	// プールから取得（空の場合は新規スポーン）
+	UActorPoolSubsystem* Pool = GetWorld()->GetSubsystem<UActorPoolSubsystem>();
+	if (!Pool)
+	{
+		return false;
+	}
 
-	AEnemyCharacter* NewEnemy = GetWorld()->SpawnActor<AEnemyCharacter>(
+	AEnemyCharacter* NewEnemy = Pool->AcquireActor<AEnemyCharacter>(
 		EnemyClass,
-		SpawnLocation,
-		FRotator::ZeroRotator,
-		SpawnParams
+		FTransform(FRotator::ZeroRotator, SpawnLocation),
+		[EnemyData](AEnemyCharacter* Enemy)
+		{
+			// BeginPlay/プール取得時の初期化で使用されるため先に設定
+			Enemy->EnemyData = EnemyData;
+		}
 	);
 
-	if (NewEnemy)
+	if (!NewEnemy)
 	{
-		// 敵データを設定
-		NewEnemy->EnemyData = EnemyData;
+		return false;
+	}
+
+	// ウェーブ倍率とカラーバリアントの倍率を適用
+	float VariantHealthMultiplier = 1.0f;
+	float VariantDamageMultiplier = 1.0f;
+	if (Variant != EEnemyColorVariant::Default)
+	{
+		const FEnemyVariantConfig VariantConfig = EnemyData->GetVariantConfig(Variant);
+		VariantHealthMultiplier = VariantConfig.HealthMultiplier;
+		VariantDamageMultiplier = VariantConfig.DamageMultiplier;
+	}
+
+	NewEnemy->MaxHealth = EnemyData->MaxHealth * Config->HealthMultiplier * VariantHealthMultiplier;
+	NewEnemy->CurrentHealth = NewEnemy->MaxHealth;
+	NewEnemy->AttackDamage = EnemyData->AttackDamage * Config->DamageMultiplier * VariantDamageMultiplier;
+
+	// 死亡時のデリゲートにバインド
+	NewEnemy->OnEnemyDeathDelegate.AddDynamic(this, &UWaveSpawnerSubsystem::OnEnemyDied);
+
+	// 追跡
+	AliveEnemies.Add(NewEnemy);
+	EnemiesSpawnedThisWave++;
+
+	UE_LOG(LogDawnlight, Verbose, TEXT("[WaveSpawnerSubsystem] 敵スポーン: %s (%d/%d)"),
+		*EnemyData->DisplayName.ToString(), EnemiesSpawnedThisWave, Config->TotalEnemies);
 
-		// ウェーブ倍率を適用
-		NewEnemy->MaxHealth = EnemyData->MaxHealth * Config->HealthMultiplier;
-		NewEnemy->CurrentHealth = NewEnemy->MaxHealth;
-		NewEnemy->AttackDamage = EnemyData->AttackDamage * Config->DamageMultiplier;
+	// イベント
+	OnEnemySpawned.Broadcast(NewEnemy);
 
-		// 死亡時のデリゲートにバインド
-		NewEnemy->OnEnemyDeathDelegate.AddDynamic(this, &UWaveSpawnerSubsystem::OnEnemyDied);
+	return true;
+}
 
-		// 追跡
-		AliveEnemies.Add(NewEnemy);
-		EnemiesSpawnedThisWave++;
+void UWaveSpawnerSubsystem::BeginWaveSpawning(const FWaveConfig& Config)
+{
+	TimelineCursor = 0;
+	WaveStartTime = GetWorld()->GetTimeSeconds();
 
-		UE_LOG(LogDawnlight, Verbose, TEXT("[WaveSpawnerSubsystem] 敵スポーン: %s (%d/%d)"),
-			*EnemyData->DisplayName.ToString(), EnemiesSpawnedThisWave, Config->TotalEnemies);
+	// 最初のスポーンは少し遅延（タイムラインがあれば最初のイベントの時刻）
+	float FirstDelay = 0.5f;
+	if (const FWaveSpawnTimeline* Timeline = GetCurrentTimeline())
+	{
+		if (Timeline->Events.Num() > 0)
+		{
+			FirstDelay = Timeline->Events[0].Time;
+		}
+	}
 
-		// イベント
-		OnEnemySpawned.Broadcast(NewEnemy);
+	GetWorld()->GetTimerManager().SetTimer(
+		SpawnTimerHandle,
+		this,
+		&UWaveSpawnerSubsystem::RequestEnemySpawn,
+		Config.SpawnInterval,
+		true,
+		FMath::Max(FirstDelay, KINDA_SMALL_NUMBER)
+	);
+}
+
+const FWaveSpawnTimeline* UWaveSpawnerSubsystem::GetCurrentTimeline() const
+{
+	const int32 WaveIndex = CurrentWaveNumber - 1;
+	return WaveTimelines.IsValidIndex(WaveIndex) ? &WaveTimelines[WaveIndex] : nullptr;
+}
+
+void UWaveSpawnerSubsystem::CancelPendingSpawns()
+{
+	if (UWorld* World = GetWorld())
+	{
+		if (USpawnSchedulerSubsystem* Scheduler = World->GetSubsystem<USpawnSchedulerSubsystem>())
+		{
+			Scheduler->CancelSpawns(this);
+		}
+	}
+
+	PendingEnemySpawns = 0;
+}
+
+FVector UWaveSpawnerSubsystem::GetSpawnLocation(int32 SpawnPointIndex) const
+{
+	if (SpawnPointIndex == INDEX_NONE)
+	{
+		return GetRandomSpawnLocation();
+	}
+
+	if (SpawnPoints.Num() > 0)
+	{
+		return SpawnPoints[SpawnPointIndex % SpawnPoints.Num()];
+	}
+
+	// スポーンポイントがない場合はプレイヤーの周囲（番号から角度を決める）
+	if (UWorld* World = GetWorld())
+	{
+		if (APlayerController* PC = World->GetFirstPlayerController())
+		{
+			if (APawn* Player = PC->GetPawn())
+			{
+				const float SpawnDistance = 800.0f;
+				const float Angle = FMath::DegreesToRadians(static_cast<float>(SpawnPointIndex % 360));
+
+				return Player->GetActorLocation() + FVector(
+					FMath::Cos(Angle) * SpawnDistance,
+					FMath::Sin(Angle) * SpawnDistance,
+					0.0f
+				);
+			}
+		}
 	}
+	return FVector::ZeroVector;
 }
 
 FVector UWaveSpawnerSubsystem::GetRandomSpawnLocation() const
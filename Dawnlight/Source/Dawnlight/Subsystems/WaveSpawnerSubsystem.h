@@ -6,9 +6,11 @@
 #include "CoreMinimal.h"
 #include "Subsystems/WorldSubsystem.h"
 #include "GameplayTagContainer.h"
+#include "Data/EnemyDataAsset.h"
 #include "WaveSpawnerSubsystem.generated.h"
 
 class UEnemyDataAsset;
+class UWaveScheduleDataAsset;
 class AEnemyCharacter;
 
 /**
@@ -48,6 +50,43 @@ struct FWaveConfig
 	TArray<TObjectPtr<UEnemyDataAsset>> AvailableEnemies;
 };
 
+/**
+ * ベイク済みのスポーンイベント
+ */
+USTRUCT(BlueprintType)
+struct DAWNLIGHT_API FWaveSpawnEvent
+{
+	GENERATED_BODY()
+
+	/** ウェーブ開始からの時間（秒、同時存在上限で遅れることがある） */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ウェーブ")
+	float Time = 0.0f;
+
+	/** 敵データ（null の場合はスポーナーのデフォルト敵データ） */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ウェーブ")
+	TObjectPtr<UEnemyDataAsset> EnemyData;
+
+	/** スポーンポイント番号（レベルのスポーンポイント数で剰余を取る） */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ウェーブ")
+	int32 SpawnPointIndex = 0;
+
+	/** カラーバリアント */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ウェーブ")
+	EEnemyColorVariant Variant = EEnemyColorVariant::Default;
+};
+
+/**
+ * 1ウェーブ分のスポーンタイムライン（時間順）
+ */
+USTRUCT(BlueprintType)
+struct DAWNLIGHT_API FWaveSpawnTimeline
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ウェーブ")
+	TArray<FWaveSpawnEvent> Events;
+};
+
 /**
  * ウェーブ状態
  */
@@ -82,6 +121,8 @@ class DAWNLIGHT_API UWaveSpawnerSubsystem : public UWorldSubsystem
 {
 	GENERATED_BODY()
 
+	friend class FDawnlightBenchmarkDeterminismTest;
+
 public:
 	// ========================================================================
 	// UWorldSubsystem インターフェース
@@ -95,10 +136,24 @@ public:
 	// ウェーブ管理
 	// ========================================================================
 
-	/** ウェーブシステムを初期化 */
+	/** ウェーブシステムを初期化（敵データはスポーン時に抽選） */
 	UFUNCTION(BlueprintCallable, Category = "ウェーブ")
 	void InitializeWaveSystem(const TArray<FWaveConfig>& InWaveConfigs);
 
+	/**
+	 * ウェーブスケジュールで初期化（ベイク済みタイムラインのカーソルを進めるだけでスポーン）
+	 * 敵数倍率が設定されている場合は倍率適用後の設定を同じシードで再ベイクする
+	 */
+	UFUNCTION(BlueprintCallable, Category = "ウェーブ")
+	void InitializeWaveSchedule(UWaveScheduleDataAsset* Schedule, int32 LoopIndex = 0);
+
+	/**
+	 * 敵数の倍率を設定（ストレステスト用）
+	 * 次回の InitializeWaveSystem から TotalEnemies / MaxConcurrentEnemies に適用される
+	 */
+	UFUNCTION(BlueprintCallable, Category = "ウェーブ")
+	void SetEnemyCountMultiplier(float Multiplier) { EnemyCountMultiplier = FMath::Max(Multiplier, 0.01f); }
+
 	/** 最初のウェーブを開始 */
 	UFUNCTION(BlueprintCallable, Category = "ウェーブ")
 	void StartFirstWave();
@@ -201,6 +256,22 @@ protected:
 	/** このウェーブでスポーンした敵の数 */
 	int32 EnemiesSpawnedThisWave;
 
+	/** スポーンスケジューラーで待機中の敵の数（上限チェックに含める） */
+	int32 PendingEnemySpawns = 0;
+
+	/** ウェーブごとのスポーンタイムライン（空の場合はスポーン時に抽選） */
+	UPROPERTY()
+	TArray<FWaveSpawnTimeline> WaveTimelines;
+
+	/** 現在のウェーブのタイムライン上の次のイベント */
+	int32 TimelineCursor = 0;
+
+	/** 現在のウェーブの開始時刻 */
+	float WaveStartTime = 0.0f;
+
+	/** 敵数の倍率（ストレステスト用） */
+	float EnemyCountMultiplier = 1.0f;
+
 	/** スポーンポイント */
 	TArray<FVector> SpawnPoints;
 
@@ -219,12 +290,36 @@ protected:
 	// 内部処理
 	// ========================================================================
 
-	/** 敵をスポーン */
-	void SpawnEnemy();
+	/** 敵のスポーンを要求（スポーンタイマーから呼ばれ、実際のスポーンはスケジューラーで行う） */
+	void RequestEnemySpawn();
+
+	/**
+	 * 敵をスポーン（スケジューラーから呼ばれる）
+	 * @return スポーンできたか
+	 */
+	bool SpawnEnemy(UEnemyDataAsset* EnemyData, EEnemyColorVariant Variant, int32 SpawnPointIndex, int32 WaveNumber);
+
+	/**
+	 * スポーンできなかったタイムラインのイベントをスポーン済みとして数える
+	 * （イベントは消費済みで再試行されないため、数えないとウェーブが完了しない）
+	 */
+	void CountDroppedTimelineSpawn(int32 WaveNumber);
+
+	/** 現在のウェーブを開始（タイマーとタイムラインのカーソルをリセット） */
+	void BeginWaveSpawning(const FWaveConfig& Config);
+
+	/** 現在のウェーブのタイムライン（ない場合は null） */
+	const FWaveSpawnTimeline* GetCurrentTimeline() const;
+
+	/** 待機中のスポーン要求を破棄 */
+	void CancelPendingSpawns();
 
 	/** スポーン位置を取得（ランダム） */
 	FVector GetRandomSpawnLocation() const;
 
+	/** スポーン位置を取得（INDEX_NONE の場合はランダム） */
+	FVector GetSpawnLocation(int32 SpawnPointIndex) const;
+
 	/** 敵が倒された時の処理 */
 	UFUNCTION()
 	void OnEnemyDied(AEnemyCharacter* Enemy);
@@ -0,0 +1,76 @@
+// Soul Reaper - Dawnlight Project
+// Copyright (c) 2025. All Rights Reserved.
+
+#include "Subsystems/DawnlightBenchmarkSubsystem.h"
+#include "Subsystems/AnimalHerdSubsystem.h"
+#include "Subsystems/AnimalSpawnerSubsystem.h"
+#include "Subsystems/WaveSpawnerSubsystem.h"
+#include "Engine/World.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDawnlightBenchmarkDeterminismTest, "Dawnlight.Benchmark.SeededRunsMatch",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FDawnlightBenchmarkDeterminismTest::RunTest(const FString& Parameters)
+{
+	// 1回の実行で記録するスポーン数
+	constexpr int32 NumSpawns = 64;
+
+	constexpr int32 Seed = 12345;
+	constexpr int32 OtherSeed = 54321;
+
+	// スポーナー・群れのサブシステムはゲームワールドでのみ作成される
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	if (!TestNotNull(TEXT("テスト用ワールド"), World))
+	{
+		return false;
+	}
+
+	UAnimalSpawnerSubsystem* AnimalSpawner = World->GetSubsystem<UAnimalSpawnerSubsystem>();
+	UWaveSpawnerSubsystem* WaveSpawner = World->GetSubsystem<UWaveSpawnerSubsystem>();
+	UAnimalHerdSubsystem* Herd = World->GetSubsystem<UAnimalHerdSubsystem>();
+	if (!TestNotNull(TEXT("AnimalSpawnerSubsystem"), AnimalSpawner)
+		|| !TestNotNull(TEXT("WaveSpawnerSubsystem"), WaveSpawner)
+		|| !TestNotNull(TEXT("AnimalHerdSubsystem"), Herd))
+	{
+		World->DestroyWorld(false);
+		return false;
+	}
+
+	// 動物はエリア内のランダム位置、敵はスポーンポイントからランダム選択
+	AnimalSpawner->SetSpawnArea(FVector::ZeroVector, 3000.0f);
+	for (int32 i = 0; i < 8; ++i)
+	{
+		WaveSpawner->AddSpawnPoint(FVector(i * 500.0f, -i * 250.0f, 0.0f));
+	}
+
+	// ベンチマークと同じ手順でシードを固定し、スポーン位置・徘徊の乱数を順に記録
+	auto RecordRun = [&](int32 RunSeed)
+	{
+		UDawnlightBenchmarkSubsystem::SeedRandomStreams(*World, RunSeed);
+
+		TArray<FVector> Sequence;
+		for (int32 i = 0; i < NumSpawns; ++i)
+		{
+			Sequence.Add(AnimalSpawner->GetRandomSpawnLocation());
+			Sequence.Add(WaveSpawner->GetRandomSpawnLocation());
+			Sequence.Add(FVector(Herd->WanderStream.FRand(), 0.0f, 0.0f));
+		}
+		return Sequence;
+	};
+
+	const TArray<FVector> FirstRun = RecordRun(Seed);
+	const TArray<FVector> SecondRun = RecordRun(Seed);
+	const TArray<FVector> OtherRun = RecordRun(OtherSeed);
+
+	TestEqual(TEXT("記録数"), SecondRun.Num(), FirstRun.Num());
+	TestTrue(TEXT("同じシードの2回の実行は同じスポーン順になる"), FirstRun == SecondRun);
+	TestTrue(TEXT("違うシードではスポーン順が変わる"), FirstRun != OtherRun);
+
+	World->DestroyWorld(false);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
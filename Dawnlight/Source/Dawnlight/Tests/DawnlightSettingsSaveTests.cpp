@@ -0,0 +1,60 @@
+// Soul Reaper - Dawnlight Project
+// Copyright (c) 2025. All Rights Reserved.
+
+#include "UI/UISubsystem.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "Misc/AutomationTest.h"
+#include "TimerManager.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDawnlightSettingsSaveDebounceTest, "Dawnlight.Settings.RapidChangesWriteOnce",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FDawnlightSettingsSaveDebounceTest::RunTest(const FString& Parameters)
+{
+	// スライダー操作1回分の変更通知数
+	constexpr int32 NumRapidChanges = 60;
+
+	// デバウンス時間より十分長い経過時間
+	constexpr float ElapsedAfterChanges = 2.0f;
+
+	UGameInstance* GameInstance = NewObject<UGameInstance>(GEngine);
+	GameInstance->InitializeStandalone();
+
+	UUISubsystem* UISubsystem = GameInstance->GetSubsystem<UUISubsystem>();
+	if (!TestNotNull(TEXT("UISubsystem"), UISubsystem))
+	{
+		return false;
+	}
+
+	// 書き込まれるのは起動時に読み込んだ設定そのもの
+	const int32 WritesBefore = UISubsystem->GetSettingsWriteCount();
+
+	for (int32 i = 0; i < NumRapidChanges; ++i)
+	{
+		UISubsystem->RequestSaveSettings();
+	}
+
+	TestEqual(TEXT("デバウンス中は書き込まない"), UISubsystem->GetSettingsWriteCount(), WritesBefore);
+	TestTrue(TEXT("未保存の変更がある"), UISubsystem->HasPendingSettingsSave());
+
+	GameInstance->GetTimerManager().Tick(ElapsedAfterChanges);
+
+	TestEqual(TEXT("連続した変更は1回の書き込みにまとまる"), UISubsystem->GetSettingsWriteCount(), WritesBefore + 1);
+
+	// 終了処理で書き込みの完了を待つ
+	UWorld* World = GameInstance->GetWorld();
+	GameInstance->Shutdown();
+	if (World)
+	{
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
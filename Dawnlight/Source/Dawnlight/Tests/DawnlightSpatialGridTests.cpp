@@ -0,0 +1,235 @@
+// Soul Reaper - Dawnlight Project
+// Copyright (c) 2025. All Rights Reserved.
+
+#include "Utilities/DawnlightSpatialGrid.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace DawnlightSpatialGridTests
+{
+	constexpr float CellSize = 500.0f;
+	constexpr float WorldExtent = 2000.0f;
+	constexpr int32 NumRandomPoints = 400;
+	constexpr int32 NumQueries = 200;
+
+	/** テスト用の点（グリッドに登録したものと同じ位置・カテゴリ） */
+	struct FPoint
+	{
+		AActor* Actor = nullptr;
+		FVector Location = FVector::ZeroVector;
+		uint8 CategoryMask = 0;
+	};
+
+	/** 乱数の位置（一部はセル境界ちょうどに置く） */
+	FVector RandomLocation(const FRandomStream& Stream)
+	{
+		FVector Location(
+			Stream.FRandRange(-WorldExtent, WorldExtent),
+			Stream.FRandRange(-WorldExtent, WorldExtent),
+			Stream.FRandRange(-200.0f, 200.0f));
+
+		const int32 BorderMode = Stream.RandRange(0, 3);
+		if (BorderMode & 1)
+		{
+			Location.X = FMath::RoundToFloat(Location.X / CellSize) * CellSize;
+		}
+		if (BorderMode & 2)
+		{
+			Location.Y = FMath::RoundToFloat(Location.Y / CellSize) * CellSize;
+		}
+		return Location;
+	}
+
+	uint8 RandomQueryMask(const FRandomStream& Stream)
+	{
+		switch (Stream.RandRange(0, 3))
+		{
+		case 0:		return static_cast<uint8>(EDawnlightSpatialCategory::Enemy);
+		case 1:		return static_cast<uint8>(EDawnlightSpatialCategory::Animal);
+		case 2:		return static_cast<uint8>(EDawnlightSpatialCategory::Player);
+		default:	return DawnlightSpatialCategory_All;
+		}
+	}
+
+	// ========================================================================
+	// 線形探索（正解）
+	// ========================================================================
+
+	void BruteForceRadius(const TArray<FPoint>& Points, const FVector& Center, float Radius, uint8 CategoryMask, TArray<AActor*>& OutActors)
+	{
+		for (const FPoint& Point : Points)
+		{
+			if ((Point.CategoryMask & CategoryMask) != 0 && FVector::DistSquared(Center, Point.Location) <= FMath::Square(Radius))
+			{
+				OutActors.Add(Point.Actor);
+			}
+		}
+	}
+
+	void BruteForceNearestDistances(const TArray<FPoint>& Points, const FVector& Center, int32 MaxCount, float MaxRadius, uint8 CategoryMask, TArray<float>& OutDistancesSq)
+	{
+		for (const FPoint& Point : Points)
+		{
+			const float DistanceSq = FVector::DistSquared(Center, Point.Location);
+			if ((Point.CategoryMask & CategoryMask) != 0 && DistanceSq <= FMath::Square(MaxRadius))
+			{
+				OutDistancesSq.Add(DistanceSq);
+			}
+		}
+
+		OutDistancesSq.Sort();
+		OutDistancesSq.SetNum(FMath::Min(MaxCount, OutDistancesSq.Num()));
+	}
+
+	void BruteForceCone(const TArray<FPoint>& Points, const FVector& Origin, const FVector& Direction, float Radius, float HalfAngleDegrees, uint8 CategoryMask, TArray<AActor*>& OutActors)
+	{
+		const FVector Forward = Direction.GetSafeNormal();
+		const float CosHalfAngle = FMath::Cos(FMath::DegreesToRadians(HalfAngleDegrees));
+
+		for (const FPoint& Point : Points)
+		{
+			const FVector ToPoint = Point.Location - Origin;
+			const float DistanceSq = ToPoint.SizeSquared();
+			if ((Point.CategoryMask & CategoryMask) == 0 || DistanceSq > FMath::Square(Radius))
+			{
+				continue;
+			}
+
+			if (DistanceSq <= KINDA_SMALL_NUMBER || FVector::DotProduct(ToPoint / FMath::Sqrt(DistanceSq), Forward) >= CosHalfAngle)
+			{
+				OutActors.Add(Point.Actor);
+			}
+		}
+	}
+
+	/** 順不同の結果が同じ集合か */
+	bool SameActorSet(TArray<AActor*> A, TArray<AActor*> B)
+	{
+		if (A.Num() != B.Num())
+		{
+			return false;
+		}
+
+		A.Sort();
+		B.Sort();
+		return A == B;
+	}
+
+	/** 全クエリをランダムに実行して線形探索と比較 */
+	void CompareQueries(FAutomationTestBase& Test, const FDawnlightSpatialGrid& Grid, const TArray<FPoint>& Points, const FRandomStream& Stream, const TCHAR* Phase)
+	{
+		TArray<AActor*> GridResult;
+		TArray<AActor*> Expected;
+
+		for (int32 QueryIndex = 0; QueryIndex < NumQueries; ++QueryIndex)
+		{
+			const FVector Center = RandomLocation(Stream);
+			const float Radius = Stream.FRandRange(1.0f, 1500.0f);
+			const uint8 Mask = RandomQueryMask(Stream);
+
+			// 半径
+			GridResult.Reset();
+			Expected.Reset();
+			Grid.QueryRadius(Center, Radius, Mask, GridResult);
+			BruteForceRadius(Points, Center, Radius, Mask, Expected);
+			Test.TestTrue(FString::Printf(TEXT("%s: QueryRadius #%d"), Phase, QueryIndex), SameActorSet(GridResult, Expected));
+
+			// 最近傍（同じ距離の点は順序が入れ替わり得るため距離で比較）
+			const int32 MaxCount = Stream.RandRange(1, 16);
+			GridResult.Reset();
+			Grid.QueryNearest(Center, MaxCount, Radius, Mask, GridResult);
+
+			TArray<float> ExpectedDistancesSq;
+			BruteForceNearestDistances(Points, Center, MaxCount, Radius, Mask, ExpectedDistancesSq);
+
+			bool bNearestMatches = GridResult.Num() == ExpectedDistancesSq.Num();
+			for (int32 i = 0; bNearestMatches && i < GridResult.Num(); ++i)
+			{
+				const FPoint* Point = Points.FindByPredicate([&GridResult, i](const FPoint& Candidate) { return Candidate.Actor == GridResult[i]; });
+				bNearestMatches = Point && FMath::IsNearlyEqual(FVector::DistSquared(Center, Point->Location), ExpectedDistancesSq[i], 1.0f);
+			}
+			Test.TestTrue(FString::Printf(TEXT("%s: QueryNearest #%d"), Phase, QueryIndex), bNearestMatches);
+
+			// 最近傍1件
+			TArray<float> ExpectedNearestSq;
+			BruteForceNearestDistances(Points, Center, 1, Radius, Mask, ExpectedNearestSq);
+
+			float NearestDistanceSq = 0.0f;
+			const AActor* Nearest = Grid.FindNearest(Center, Radius, Mask, &NearestDistanceSq);
+			Test.TestTrue(FString::Printf(TEXT("%s: FindNearest #%d"), Phase, QueryIndex), ExpectedNearestSq.Num() > 0
+				? (Nearest && FMath::IsNearlyEqual(NearestDistanceSq, ExpectedNearestSq[0], 1.0f))
+				: (!Nearest && NearestDistanceSq == MAX_FLT));
+
+			// 扇形
+			const FVector Direction(Stream.FRandRange(-1.0f, 1.0f), Stream.FRandRange(-1.0f, 1.0f), Stream.FRandRange(-0.2f, 0.2f));
+			if (Direction.IsNearlyZero())
+			{
+				continue;
+			}
+
+			const float HalfAngle = Stream.FRandRange(0.0f, 180.0f);
+			GridResult.Reset();
+			Expected.Reset();
+			Grid.QueryCone(Center, Direction, Radius, HalfAngle, Mask, GridResult);
+			BruteForceCone(Points, Center, Direction, Radius, HalfAngle, Mask, Expected);
+			Test.TestTrue(FString::Printf(TEXT("%s: QueryCone #%d"), Phase, QueryIndex), SameActorSet(GridResult, Expected));
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDawnlightSpatialGridBruteForceTest, "Dawnlight.SpatialGrid.MatchesBruteForce",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FDawnlightSpatialGridBruteForceTest::RunTest(const FString& Parameters)
+{
+	using namespace DawnlightSpatialGridTests;
+
+	// グリッドは弱参照の有効性を見るため、実際のアクターを使う
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	if (!TestNotNull(TEXT("テスト用ワールド"), World))
+	{
+		return false;
+	}
+
+	const FRandomStream Stream(20250101);
+	FDawnlightSpatialGrid Grid(CellSize);
+	TArray<FPoint> Points;
+
+	for (int32 i = 0; i < NumRandomPoints; ++i)
+	{
+		FPoint& Point = Points.AddDefaulted_GetRef();
+		Point.Actor = World->SpawnActor<AActor>();
+		Point.Location = RandomLocation(Stream);
+		Point.CategoryMask = static_cast<uint8>((i % 10 == 0) ? EDawnlightSpatialCategory::Player
+			: (i % 2 == 0) ? EDawnlightSpatialCategory::Enemy : EDawnlightSpatialCategory::Animal);
+		Grid.Add(Point.Actor, Point.Location, Point.CategoryMask);
+	}
+
+	TestEqual(TEXT("登録数"), Grid.Num(), Points.Num());
+	CompareQueries(*this, Grid, Points, Stream, TEXT("追加後"));
+
+	// 移動（セルをまたぐ移動・またがない移動）と削除の後も一致すること
+	for (int32 i = 0; i < Points.Num(); i += 3)
+	{
+		Points[i].Location = (i % 2 == 0) ? RandomLocation(Stream) : Points[i].Location + FVector(1.0f, -1.0f, 0.0f);
+		Grid.Update(Points[i].Actor, Points[i].Location);
+	}
+
+	for (int32 i = Points.Num() - 1; i >= 0; i -= 5)
+	{
+		TestTrue(TEXT("削除"), Grid.Remove(Points[i].Actor));
+		Points.RemoveAtSwap(i);
+	}
+
+	TestEqual(TEXT("削除後の登録数"), Grid.Num(), Points.Num());
+	CompareQueries(*this, Grid, Points, Stream, TEXT("更新後"));
+
+	World->DestroyWorld(false);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -3,10 +3,26 @@
 #include "UIAnimationComponent.h"
 #include "Components/Widget.h"
 #include "Blueprint/UserWidget.h"
-#include "Animation/UMGSequencePlayer.h"
-#include "Animation/WidgetAnimation.h"
+#include "UI/Utilities/UITweenEngine.h"
 #include "Dawnlight.h"
 
+namespace
+{
+	/** 補間トゥイーンを作成 */
+	FUITween MakeTween(UWidget* Widget, EUITweenProperty Property, const FVector2D& From, const FVector2D& To, float Duration, float Delay, EUIEaseType Ease)
+	{
+		FUITween Tween;
+		Tween.Widget = Widget;
+		Tween.Property = Property;
+		Tween.From = From;
+		Tween.To = To;
+		Tween.Duration = Duration;
+		Tween.Delay = Delay;
+		Tween.Ease = Ease;
+		return Tween;
+	}
+}
+
 UUIAnimationComponent::UUIAnimationComponent()
 {
 	PrimaryComponentTick.bCanEverTick = false;
@@ -23,49 +39,8 @@ void UUIAnimationComponent::PlayFadeIn(UWidget* Widget, float Duration, float De
 	Widget->SetRenderOpacity(0.0f);
 	Widget->SetVisibility(ESlateVisibility::Visible);
 
-	// タイマーで遅延後にアニメーション開始
-	if (UWorld* World = Widget->GetWorld())
-	{
-		FTimerHandle TimerHandle;
-		FTimerDelegate TimerDelegate;
-
-		TimerDelegate.BindLambda([Widget, Duration]()
-		{
-			if (!IsValid(Widget))
-			{
-				return;
-			}
-
-			// 簡易的なフェードイン（TickベースでなくTimerベースで実装）
-			const int32 Steps = FMath::Max(1, FMath::RoundToInt(Duration * 30.0f)); // 30fps相当
-			const float StepDuration = Duration / Steps;
-			const float OpacityStep = 1.0f / Steps;
-
-			for (int32 i = 0; i <= Steps; ++i)
-			{
-				FTimerHandle StepHandle;
-				const float TargetOpacity = FMath::Clamp(OpacityStep * i, 0.0f, 1.0f);
-
-				if (UWorld* StepWorld = Widget->GetWorld())
-				{
-					StepWorld->GetTimerManager().SetTimer(
-						StepHandle,
-						[Widget, TargetOpacity]()
-						{
-							if (IsValid(Widget))
-							{
-								Widget->SetRenderOpacity(TargetOpacity);
-							}
-						},
-						StepDuration * i,
-						false
-					);
-				}
-			}
-		});
-
-		World->GetTimerManager().SetTimer(TimerHandle, TimerDelegate, Delay > 0.0f ? Delay : 0.001f, false);
-	}
+	FUITweenEngine::Get().AddTween(MakeTween(Widget, EUITweenProperty::Opacity,
+		FVector2D(0.0f, 0.0f), FVector2D(1.0f, 0.0f), Duration, Delay, EUIEaseType::Linear));
 }
 
 void UUIAnimationComponent::PlayFadeOut(UWidget* Widget, float Duration, float Delay)
@@ -75,53 +50,20 @@ void UUIAnimationComponent::PlayFadeOut(UWidget* Widget, float Duration, float D
 		return;
 	}
 
-	if (UWorld* World = Widget->GetWorld())
-	{
-		FTimerHandle TimerHandle;
-		FTimerDelegate TimerDelegate;
+	FUITween Tween = MakeTween(Widget, EUITweenProperty::Opacity,
+		FVector2D(1.0f, 0.0f), FVector2D(0.0f, 0.0f), Duration, Delay, EUIEaseType::Linear);
 
-		TimerDelegate.BindLambda([Widget, Duration]()
+	// 完了時に非表示に
+	TWeakObjectPtr<UWidget> WeakWidget(Widget);
+	Tween.OnComplete = [WeakWidget]()
+	{
+		if (UWidget* FadedWidget = WeakWidget.Get())
 		{
-			if (!IsValid(Widget))
-			{
-				return;
-			}
-
-			const int32 Steps = FMath::Max(1, FMath::RoundToInt(Duration * 30.0f));
-			const float StepDuration = Duration / Steps;
-			const float OpacityStep = 1.0f / Steps;
-
-			for (int32 i = 0; i <= Steps; ++i)
-			{
-				FTimerHandle StepHandle;
-				const float TargetOpacity = FMath::Clamp(1.0f - (OpacityStep * i), 0.0f, 1.0f);
-
-				if (UWorld* StepWorld = Widget->GetWorld())
-				{
-					StepWorld->GetTimerManager().SetTimer(
-						StepHandle,
-						[Widget, TargetOpacity, i, Steps]()
-						{
-							if (IsValid(Widget))
-							{
-								Widget->SetRenderOpacity(TargetOpacity);
-
-								// 最後のステップで非表示に
-								if (i == Steps)
-								{
-									Widget->SetVisibility(ESlateVisibility::Collapsed);
-								}
-							}
-						},
-						StepDuration * i,
-						false
-					);
-				}
-			}
-		});
-
-		World->GetTimerManager().SetTimer(TimerHandle, TimerDelegate, Delay > 0.0f ? Delay : 0.001f, false);
-	}
+			FadedWidget->SetVisibility(ESlateVisibility::Collapsed);
+		}
+	};
+
+	FUITweenEngine::Get().AddTween(MoveTemp(Tween));
 }
 
 void UUIAnimationComponent::PlaySlideIn(UWidget* Widget, EUIAnimationType Direction, float Distance, float Duration, float Delay)
@@ -156,49 +98,12 @@ void UUIAnimationComponent::PlaySlideIn(UWidget* Widget, EUIAnimationType Direct
 	Widget->SetRenderOpacity(0.0f);
 	Widget->SetVisibility(ESlateVisibility::Visible);
 
-	if (UWorld* World = Widget->GetWorld())
-	{
-		FTimerHandle TimerHandle;
-		FTimerDelegate TimerDelegate;
-
-		TimerDelegate.BindLambda([Widget, StartOffset, Duration]()
-		{
-			if (!IsValid(Widget))
-			{
-				return;
-			}
-
-			const int32 Steps = FMath::Max(1, FMath::RoundToInt(Duration * 30.0f));
-			const float StepDuration = Duration / Steps;
-
-			for (int32 i = 0; i <= Steps; ++i)
-			{
-				FTimerHandle StepHandle;
-				const float Alpha = static_cast<float>(i) / Steps;
-				// EaseOutCubic
-				const float EasedAlpha = 1.0f - FMath::Pow(1.0f - Alpha, 3.0f);
-
-				if (UWorld* StepWorld = Widget->GetWorld())
-				{
-					StepWorld->GetTimerManager().SetTimer(
-						StepHandle,
-						[Widget, StartOffset, EasedAlpha]()
-						{
-							if (IsValid(Widget))
-							{
-								Widget->SetRenderTranslation(FMath::Lerp(StartOffset, FVector2D::ZeroVector, EasedAlpha));
-								Widget->SetRenderOpacity(EasedAlpha);
-							}
-						},
-						StepDuration * i,
-						false
-					);
-				}
-			}
-		});
-
-		World->GetTimerManager().SetTimer(TimerHandle, TimerDelegate, Delay > 0.0f ? Delay : 0.001f, false);
-	}
+	// 移動と不透明度を同じイージングで補間
+	FUITweenEngine& TweenEngine = FUITweenEngine::Get();
+	TweenEngine.AddTween(MakeTween(Widget, EUITweenProperty::Translation,
+		StartOffset, FVector2D::ZeroVector, Duration, Delay, EUIEaseType::EaseOutCubic));
+	TweenEngine.AddTween(MakeTween(Widget, EUITweenProperty::Opacity,
+		FVector2D(0.0f, 0.0f), FVector2D(1.0f, 0.0f), Duration, Delay, EUIEaseType::EaseOutCubic));
 }
 
 void UUIAnimationComponent::PlayScaleAnimation(UWidget* Widget, float StartScale, float EndScale, float Duration, float Delay)
@@ -210,49 +115,9 @@ void UUIAnimationComponent::PlayScaleAnimation(UWidget* Widget, float StartScale
 
 	Widget->SetRenderScale(FVector2D(StartScale, StartScale));
 
-	if (UWorld* World = Widget->GetWorld())
-	{
-		FTimerHandle TimerHandle;
-		FTimerDelegate TimerDelegate;
-
-		TimerDelegate.BindLambda([Widget, StartScale, EndScale, Duration]()
-		{
-			if (!IsValid(Widget))
-			{
-				return;
-			}
-
-			const int32 Steps = FMath::Max(1, FMath::RoundToInt(Duration * 30.0f));
-			const float StepDuration = Duration / Steps;
-
-			for (int32 i = 0; i <= Steps; ++i)
-			{
-				FTimerHandle StepHandle;
-				const float Alpha = static_cast<float>(i) / Steps;
-				// EaseOutBack for bounce effect
-				const float EasedAlpha = 1.0f + 2.70158f * FMath::Pow(Alpha - 1.0f, 3.0f) + 1.70158f * FMath::Pow(Alpha - 1.0f, 2.0f);
-
-				if (UWorld* StepWorld = Widget->GetWorld())
-				{
-					StepWorld->GetTimerManager().SetTimer(
-						StepHandle,
-						[Widget, StartScale, EndScale, EasedAlpha]()
-						{
-							if (IsValid(Widget))
-							{
-								const float CurrentScale = FMath::Lerp(StartScale, EndScale, FMath::Clamp(EasedAlpha, 0.0f, 1.0f));
-								Widget->SetRenderScale(FVector2D(CurrentScale, CurrentScale));
-							}
-						},
-						StepDuration * i,
-						false
-					);
-				}
-			}
-		});
-
-		World->GetTimerManager().SetTimer(TimerHandle, TimerDelegate, Delay > 0.0f ? Delay : 0.001f, false);
-	}
+	// EaseOutBack でバウンス効果
+	FUITweenEngine::Get().AddTween(MakeTween(Widget, EUITweenProperty::Scale,
+		FVector2D(StartScale, StartScale), FVector2D(EndScale, EndScale), Duration, Delay, EUIEaseType::Back));
 }
 
 void UUIAnimationComponent::PlayButtonHover(UWidget* Widget, bool bIsHovered, float Scale, float Duration)
@@ -263,36 +128,13 @@ void UUIAnimationComponent::PlayButtonHover(UWidget* Widget, bool bIsHovered, fl
 	}
 
 	const float TargetScale = bIsHovered ? Scale : 1.0f;
-	const FVector2D CurrentScale = Widget->GetRenderTransform().Scale;
-	const float StartScale = CurrentScale.X;
 
-	if (UWorld* World = Widget->GetWorld())
-	{
-		const int32 Steps = FMath::Max(1, FMath::RoundToInt(Duration * 60.0f)); // 60fps for smooth hover
-		const float StepDuration = Duration / Steps;
+	// 現在のスケールから補間（ホバー中の切り替えでも飛ばない）
+	FUITween Tween = MakeTween(Widget, EUITweenProperty::Scale,
+		FVector2D::ZeroVector, FVector2D(TargetScale, TargetScale), Duration, 0.0f, EUIEaseType::EaseOut);
+	Tween.bFromCurrent = true;
 
-		for (int32 i = 0; i <= Steps; ++i)
-		{
-			FTimerHandle StepHandle;
-			const float Alpha = static_cast<float>(i) / Steps;
-			// EaseOutQuad
-			const float EasedAlpha = 1.0f - (1.0f - Alpha) * (1.0f - Alpha);
-
-			World->GetTimerManager().SetTimer(
-				StepHandle,
-				[Widget, StartScale, TargetScale, EasedAlpha]()
-				{
-					if (IsValid(Widget))
-					{
-						const float CurrentScaleValue = FMath::Lerp(StartScale, TargetScale, EasedAlpha);
-						Widget->SetRenderScale(FVector2D(CurrentScaleValue, CurrentScaleValue));
-					}
-				},
-				StepDuration * i,
-				false
-			);
-		}
-	}
+	FUITweenEngine::Get().AddTween(MoveTemp(Tween));
 }
 
 void UUIAnimationComponent::PlayButtonPress(UWidget* Widget, float Scale, float Duration)
@@ -303,24 +145,21 @@ void UUIAnimationComponent::PlayButtonPress(UWidget* Widget, float Scale, float
 	}
 
 	// 押下 -> 元に戻る の2段階アニメーション
-	PlayScaleAnimation(Widget, 1.0f, Scale, Duration * 0.5f, 0.0f);
+	FUITween PressTween = MakeTween(Widget, EUITweenProperty::Scale,
+		FVector2D(1.0f, 1.0f), FVector2D(Scale, Scale), Duration * 0.5f, 0.0f, EUIEaseType::Back);
 
-	if (UWorld* World = Widget->GetWorld())
+	TWeakObjectPtr<UWidget> WeakWidget(Widget);
+	PressTween.OnComplete = [WeakWidget, Duration]()
 	{
-		FTimerHandle TimerHandle;
-		World->GetTimerManager().SetTimer(
-			TimerHandle,
-			[Widget, Duration]()
-			{
-				if (IsValid(Widget))
-				{
-					PlayScaleAnimation(Widget, Widget->GetRenderTransform().Scale.X, 1.0f, Duration * 0.5f, 0.0f);
-				}
-			},
-			Duration * 0.5f,
-			false
-		);
-	}
+		FUITween ReleaseTween = MakeTween(WeakWidget.Get(), EUITweenProperty::Scale,
+			FVector2D::ZeroVector, FVector2D(1.0f, 1.0f), Duration * 0.5f, 0.0f, EUIEaseType::Back);
+		ReleaseTween.bFromCurrent = true;
+
+		FUITweenEngine::Get().AddTween(MoveTemp(ReleaseTween));
+	};
+
+	Widget->SetRenderScale(FVector2D(1.0f, 1.0f));
+	FUITweenEngine::Get().AddTween(MoveTemp(PressTween));
 }
 
 void UUIAnimationComponent::PlayStaggeredAnimation(const TArray<UWidget*>& Widgets, EUIAnimationType AnimationType, float StaggerDelay, float Duration)
@@ -347,25 +186,12 @@ void UUIAnimationComponent::PlayStaggeredAnimation(const TArray<UWidget*>& Widge
 			PlaySlideIn(Widget, AnimationType, 100.0f, Duration, Delay);
 			break;
 		case EUIAnimationType::ScaleIn:
+			// 遅延の間は非表示、開始と同時に表示してスケール
 			Widget->SetRenderOpacity(0.0f);
 			Widget->SetVisibility(ESlateVisibility::Visible);
-			if (UWorld* World = Widget->GetWorld())
-			{
-				FTimerHandle TimerHandle;
-				World->GetTimerManager().SetTimer(
-					TimerHandle,
-					[Widget, Duration]()
-					{
-						if (IsValid(Widget))
-						{
-							Widget->SetRenderOpacity(1.0f);
-							PlayScaleAnimation(Widget, 0.5f, 1.0f, Duration, 0.0f);
-						}
-					},
-					Delay,
-					false
-				);
-			}
+			FUITweenEngine::Get().AddTween(MakeTween(Widget, EUITweenProperty::Opacity,
+				FVector2D(1.0f, 0.0f), FVector2D(1.0f, 0.0f), 0.0f, Delay, EUIEaseType::Linear));
+			PlayScaleAnimation(Widget, 0.5f, 1.0f, Duration, Delay);
 			break;
 		default:
 			break;
@@ -380,39 +206,12 @@ void UUIAnimationComponent::PlayPulse(UWidget* Widget, float MinScale, float Max
 		return;
 	}
 
-	if (UWorld* World = Widget->GetWorld())
-	{
-		const int32 Steps = FMath::Max(1, FMath::RoundToInt(Duration * 30.0f));
-		const float StepDuration = Duration / Steps;
+	FUITween Tween = MakeTween(Widget, EUITweenProperty::Scale,
+		FVector2D(MinScale, MinScale), FVector2D(MaxScale, MaxScale), Duration, 0.0f, EUIEaseType::Linear);
+	Tween.Mode = EUITweenMode::Pulse;
+	Tween.bLoop = bLoop;
 
-		for (int32 i = 0; i <= Steps; ++i)
-		{
-			FTimerHandle StepHandle;
-			const float Alpha = static_cast<float>(i) / Steps;
-			// Sin wave for pulse
-			const float PulseAlpha = (FMath::Sin(Alpha * PI * 2.0f - PI * 0.5f) + 1.0f) * 0.5f;
-
-			World->GetTimerManager().SetTimer(
-				StepHandle,
-				[Widget, MinScale, MaxScale, PulseAlpha, bLoop, Duration, i, Steps]()
-				{
-					if (IsValid(Widget))
-					{
-						const float CurrentScale = FMath::Lerp(MinScale, MaxScale, PulseAlpha);
-						Widget->SetRenderScale(FVector2D(CurrentScale, CurrentScale));
-
-						// ループの場合、最後のステップで再度呼び出し
-						if (bLoop && i == Steps)
-						{
-							PlayPulse(Widget, MinScale, MaxScale, Duration, true);
-						}
-					}
-				},
-				StepDuration * i,
-				false
-			);
-		}
-	}
+	FUITweenEngine::Get().AddTween(MoveTemp(Tween));
 }
 
 void UUIAnimationComponent::PlayShake(UWidget* Widget, float Intensity, float Duration)
@@ -422,47 +221,12 @@ void UUIAnimationComponent::PlayShake(UWidget* Widget, float Intensity, float Du
 		return;
 	}
 
-	const FVector2D OriginalTranslation = Widget->GetRenderTransform().Translation;
-
-	if (UWorld* World = Widget->GetWorld())
-	{
-		const int32 Steps = FMath::Max(1, FMath::RoundToInt(Duration * 60.0f));
-		const float StepDuration = Duration / Steps;
+	// 現在の位置を中心に揺らし、最後は元の位置に戻す
+	FUITween Tween = MakeTween(Widget, EUITweenProperty::Translation,
+		Widget->GetRenderTransform().Translation, FVector2D(Intensity, 0.0f), Duration, 0.0f, EUIEaseType::Linear);
+	Tween.Mode = EUITweenMode::Shake;
 
-		for (int32 i = 0; i <= Steps; ++i)
-		{
-			FTimerHandle StepHandle;
-			const float Alpha = static_cast<float>(i) / Steps;
-			// 減衰するシェイク
-			const float DecayedIntensity = Intensity * (1.0f - Alpha);
-
-			World->GetTimerManager().SetTimer(
-				StepHandle,
-				[Widget, OriginalTranslation, DecayedIntensity, i, Steps]()
-				{
-					if (IsValid(Widget))
-					{
-						if (i == Steps)
-						{
-							// 最後は元の位置に戻す
-							Widget->SetRenderTranslation(OriginalTranslation);
-						}
-						else
-						{
-							// ランダムなオフセットを適用
-							const FVector2D ShakeOffset(
-								FMath::RandRange(-DecayedIntensity, DecayedIntensity),
-								FMath::RandRange(-DecayedIntensity, DecayedIntensity)
-							);
-							Widget->SetRenderTranslation(OriginalTranslation + ShakeOffset);
-						}
-					}
-				},
-				StepDuration * i,
-				false
-			);
-		}
-	}
+	FUITweenEngine::Get().AddTween(MoveTemp(Tween));
 }
 
 void UUIAnimationComponent::PlayGlow(UWidget* Widget, FLinearColor GlowColor, float Duration)
@@ -479,8 +243,9 @@ void UUIAnimationComponent::StopAllAnimations(UWidget* Widget)
 		return;
 	}
 
-	// タイマーベースのアニメーションは個別のタイマーハンドルを管理する必要がある
-	// 現在の実装では、ウィジェットをリセット
+	// 再生中のトゥイーンを破棄してウィジェットをリセット
+	FUITweenEngine::Get().CancelTweensForWidget(Widget);
+
 	Widget->SetRenderOpacity(1.0f);
 	Widget->SetRenderScale(FVector2D(1.0f, 1.0f));
 	Widget->SetRenderTranslation(FVector2D::ZeroVector);
@@ -488,7 +253,5 @@ void UUIAnimationComponent::StopAllAnimations(UWidget* Widget)
 
 bool UUIAnimationComponent::IsAnimating(UWidget* Widget)
 {
-	// 現在の簡易実装ではアニメーション状態を追跡していない
-	// より高度な実装では、アクティブなタイマーを追跡する必要がある
-	return false;
+	return FUITweenEngine::Get().IsAnimating(Widget);
 }
@@ -1,6 +1,7 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "DangerVignetteWidget.h"
+#include "DawnlightStats.h"
 #include "Components/Image.h"
 #include "Materials/MaterialInstanceDynamic.h"
 
@@ -38,6 +39,8 @@ void UDangerVignetteWidget::NativeConstruct()
 
 void UDangerVignetteWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
 {
+	DAWNLIGHT_SCOPE_CYCLE_COUNTER(STAT_DawnlightHUDTick);
+
 	Super::NativeTick(MyGeometry, InDeltaTime);
 
 	// 目標値を計算
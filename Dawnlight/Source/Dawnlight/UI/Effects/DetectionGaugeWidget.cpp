@@ -1,6 +1,7 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "DetectionGaugeWidget.h"
+#include "DawnlightStats.h"
 #include "Components/ProgressBar.h"
 #include "Components/Image.h"
 #include "Components/TextBlock.h"
@@ -34,6 +35,8 @@ void UDetectionGaugeWidget::NativeConstruct()
 
 void UDetectionGaugeWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
 {
+	DAWNLIGHT_SCOPE_CYCLE_COUNTER(STAT_DawnlightHUDTick);
+
 	Super::NativeTick(MyGeometry, InDeltaTime);
 
 	// ゲージ更新
@@ -1,6 +1,7 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "NightProgressWidget.h"
+#include "DawnlightStats.h"
 #include "Components/Image.h"
 #include "Components/TextBlock.h"
 #include "Components/ProgressBar.h"
@@ -62,6 +63,8 @@ void UNightProgressWidget::NativeConstruct()
 
 void UNightProgressWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
 {
+	DAWNLIGHT_SCOPE_CYCLE_COUNTER(STAT_DawnlightHUDTick);
+
 	Super::NativeTick(MyGeometry, InDeltaTime);
 
 	// タイマー更新
@@ -2,9 +2,16 @@
 
 #include "LevelTransitionSubsystem.h"
 #include "Dawnlight.h"
+#include "Core/DawnlightGameMode.h"
+#include "LoadingScreenWidget.h"
 #include "Blueprint/UserWidget.h"
 #include "Kismet/GameplayStatics.h"
+#include "Engine/AssetManager.h"
+#include "Engine/GameInstance.h"
+#include "Engine/StreamableManager.h"
 #include "Engine/World.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
 #include "TimerManager.h"
 
 void ULevelTransitionSubsystem::Initialize(FSubsystemCollectionBase& Collection)
@@ -19,6 +26,17 @@ void ULevelTransitionSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 
 void ULevelTransitionSubsystem::Deinitialize()
 {
+	// 進行中の遷移を停止
+	if (UGameInstance* GameInstance = GetGameInstance())
+	{
+		GameInstance->GetTimerManager().ClearAllTimersForObject(this);
+	}
+	FCoreUObjectDelegates::PostLoadMapWithWorld.Remove(PostLoadMapHandle);
+	PostLoadMapHandle.Reset();
+
+	LoadedMapPackage = nullptr;
+	LoopAssetPreloadHandle.Reset();
+
 	// ローディング画面をクリーンアップ
 	if (LoadingScreenWidget)
 	{
@@ -58,31 +76,31 @@ void ULevelTransitionSubsystem::TransitionToLevel(const FName& LevelName, bool b
 
 	bIsTransitioning = true;
 	PendingLevelName = LevelName;
+	PendingPackageName = NAME_None;
+	LoadedMapPackage = nullptr;
+	bMapPackageLoaded = false;
+	bOpenLevelIssued = false;
 
 	UE_LOG(LogDawnlight, Log, TEXT("[LevelTransitionSubsystem] レベル遷移開始: %s"), *LevelName.ToString());
 
 	// 遷移開始を通知
 	OnLevelTransitionStarted.Broadcast(LevelName.ToString());
 
+	LoadingStartTime = FPlatformTime::Seconds();
+
 	if (bShowLoadingScreen)
 	{
 		ShowLoadingScreen();
-		LoadingStartTime = FPlatformTime::Seconds();
+		SetLoadingProgress(0.0f);
 
 		// 少し待ってから実際の遷移を開始（ローディング画面の表示を確保）
-		if (UWorld* World = GetGameInstance()->GetWorld())
-		{
-			World->GetTimerManager().SetTimer(
-				LoadingTimerHandle,
-				FTimerDelegate::CreateLambda([this, LevelName]() { ExecuteLevelTransition(LevelName); }),
-				0.1f,
-				false
-			);
-		}
-		else
-		{
-			ExecuteLevelTransition(LevelName);
-		}
+		// ワールドをまたいで動くため、タイマーはゲームインスタンスのものを使う
+		GetGameInstance()->GetTimerManager().SetTimer(
+			LoadingTimerHandle,
+			FTimerDelegate::CreateUObject(this, &ULevelTransitionSubsystem::ExecuteLevelTransition, LevelName),
+			0.1f,
+			false
+		);
 	}
 	else
 	{
@@ -157,6 +175,12 @@ void ULevelTransitionSubsystem::HideLoadingScreen()
 void ULevelTransitionSubsystem::SetLoadingProgress(float Progress)
 {
 	float ClampedProgress = FMath::Clamp(Progress, 0.0f, 1.0f);
+
+	if (ULoadingScreenWidget* LoadingScreen = Cast<ULoadingScreenWidget>(LoadingScreenWidget))
+	{
+		LoadingScreen->SetProgress(ClampedProgress);
+	}
+
 	OnLoadingProgressChanged.Broadcast(ClampedProgress);
 }
 
@@ -166,45 +190,191 @@ void ULevelTransitionSubsystem::ExecuteLevelTransition(const FName& LevelName)
 	if (!World)
 	{
 		UE_LOG(LogDawnlight, Error, TEXT("[LevelTransitionSubsystem] ワールドが見つかりません"));
-		bIsTransitioning = false;
+		AbortTransition();
+		return;
+	}
+
+	// マップと並行して次のループで使うアセットを読み込む
+	StartLoopAssetPreload(World, LevelName);
+
+	if (!ResolveMapPackageName(LevelName, PendingPackageName))
+	{
+		// パッケージが見つからない場合は従来どおり OpenLevel に任せる
+		UE_LOG(LogDawnlight, Warning, TEXT("[LevelTransitionSubsystem] マップパッケージを解決できないため同期ロードします: %s"), *LevelName.ToString());
+		PendingPackageName = LevelName;
+		bMapPackageLoaded = true;
+		OpenLoadedLevel();
+		return;
+	}
+
+	// 進捗の更新を開始してからロードを要求（完了コールバックが即時に来ても良いように）
+	GetGameInstance()->GetTimerManager().SetTimer(
+		ProgressTimerHandle,
+		this,
+		&ULevelTransitionSubsystem::UpdateLoadingProgress,
+		ProgressUpdateInterval,
+		true
+	);
+
+	LoadPackageAsync(
+		PendingPackageName.ToString(),
+		FLoadPackageAsyncDelegate::CreateUObject(this, &ULevelTransitionSubsystem::OnAsyncLoadComplete)
+	);
+
+	UE_LOG(LogDawnlight, Log, TEXT("[LevelTransitionSubsystem] マップの非同期ロード開始: %s"), *PendingPackageName.ToString());
+}
+
+void ULevelTransitionSubsystem::OnAsyncLoadComplete(const FName& PackageName, UPackage* LoadedPackage, EAsyncLoadingResult::Type Result)
+{
+	// 中断済み、または別の遷移のロード結果は無視
+	if (!bIsTransitioning || bOpenLevelIssued || PackageName != PendingPackageName)
+	{
 		return;
 	}
 
-	// プログレスを50%に設定
-	SetLoadingProgress(0.5f);
+	if (Result != EAsyncLoadingResult::Succeeded || !LoadedPackage)
+	{
+		UE_LOG(LogDawnlight, Error, TEXT("[LevelTransitionSubsystem] マップの非同期ロードに失敗: %s"), *PackageName.ToString());
+		AbortTransition();
+		return;
+	}
+
+	LoadedMapPackage = LoadedPackage;
+	bMapPackageLoaded = true;
+
+	UE_LOG(LogDawnlight, Log, TEXT("[LevelTransitionSubsystem] マップの非同期ロード完了: %s (%.2f秒)"),
+		*PackageName.ToString(), FPlatformTime::Seconds() - LoadingStartTime);
+
+	// 最小表示時間を過ぎていればすぐに切り替える
+	UpdateLoadingProgress();
+}
+
+void ULevelTransitionSubsystem::UpdateLoadingProgress()
+{
+	if (!bIsTransitioning || bOpenLevelIssued)
+	{
+		return;
+	}
 
-	// 通常のレベル遷移を使用
-	// 非同期ロードが必要な場合は、FStreamableManager or LoadPackageAsyncを使用
-	UGameplayStatics::OpenLevel(World, LevelName);
+	if (!bMapPackageLoaded)
+	{
+		// 見つからない場合（要求直後など）は -1 が返る
+		const float Percentage = GetAsyncLoadPercentage(PendingPackageName);
+		if (Percentage >= 0.0f)
+		{
+			SetLoadingProgress(Percentage / 100.0f);
+		}
+		return;
+	}
 
-	// プログレスを100%に設定
 	SetLoadingProgress(1.0f);
 
-	// 最小表示時間を確保
-	double ElapsedTime = FPlatformTime::Seconds() - LoadingStartTime;
-	double RemainingTime = MinLoadingDisplayTime - ElapsedTime;
+	// ローディング画面を出している場合は最小表示時間を確保（この間もバンドルの先読みは進む）
+	const double ElapsedTime = FPlatformTime::Seconds() - LoadingStartTime;
+	if (LoadingScreenWidget && ElapsedTime < MinLoadingDisplayTime)
+	{
+		return;
+	}
+
+	OpenLoadedLevel();
+}
+
+void ULevelTransitionSubsystem::OpenLoadedLevel()
+{
+	UWorld* World = GetGameInstance()->GetWorld();
+	if (!World)
+	{
+		UE_LOG(LogDawnlight, Error, TEXT("[LevelTransitionSubsystem] ワールドが見つかりません"));
+		AbortTransition();
+		return;
+	}
+
+	GetGameInstance()->GetTimerManager().ClearTimer(ProgressTimerHandle);
+	bOpenLevelIssued = true;
 
-	if (RemainingTime > 0 && LoadingScreenWidget)
+	// 新しいワールドの準備ができたら遷移を完了する
+	FCoreUObjectDelegates::PostLoadMapWithWorld.Remove(PostLoadMapHandle);
+	PostLoadMapHandle = FCoreUObjectDelegates::PostLoadMapWithWorld.AddUObject(this, &ULevelTransitionSubsystem::OnPostLoadMap);
+
+	// パッケージは常駐済みのため、ここでの読み込みはメモリ上のものが使われる
+	UGameplayStatics::OpenLevel(World, PendingPackageName);
+}
+
+void ULevelTransitionSubsystem::StartLoopAssetPreload(UWorld* World, const FName& LevelName)
+{
+	// 前回の遷移で保持していたものは新しいワールドのプリローダーへ引き継がれているため解放
+	if (LoopAssetPreloadHandle.IsValid())
 	{
-		World->GetTimerManager().SetTimer(
-			LoadingTimerHandle,
-			this,
-			&ULevelTransitionSubsystem::FinishLoadingAfterMinTime,
-			RemainingTime,
-			false
-		);
+		LoopAssetPreloadHandle->ReleaseHandle();
+		LoopAssetPreloadHandle.Reset();
 	}
-	else
+
+	// メインメニューではループ用アセットを使わない
+	if (LevelName == MainMenuLevelName || !UAssetManager::IsInitialized())
+	{
+		return;
+	}
+
+	// データアセット自体はGameModeのハード参照で常駐しているため、ソフト参照先だけを読む
+	const ADawnlightGameMode* GameMode = World->GetAuthGameMode<ADawnlightGameMode>();
+	if (!GameMode)
+	{
+		return;
+	}
+
+	TArray<FSoftObjectPath> Paths;
+	GameMode->GatherLoopAssetPaths(Paths);
+	if (Paths.Num() == 0)
+	{
+		return;
+	}
+
+	// ゲームインスタンス側で保持し、旧ワールドのプリローダー解放後もGCされないようにする
+	LoopAssetPreloadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		Paths,
+		FStreamableDelegate(),
+		FStreamableManager::DefaultAsyncLoadPriority,
+		false,
+		false,
+		TEXT("LevelTransitionLoopAssets")
+	);
+
+	UE_LOG(LogDawnlight, Verbose, TEXT("[LevelTransitionSubsystem] ループ用アセットの先読み開始: %d件"), Paths.Num());
+}
+
+bool ULevelTransitionSubsystem::ResolveMapPackageName(const FName& LevelName, FName& OutPackageName)
+{
+	FString PackageName = LevelName.ToString();
+
+	// 「L_MainMenu」のような短い名前は /Game/... のパッケージ名に解決
+	if (FPackageName::IsShortPackageName(PackageName))
 	{
-		FinishLoadingAfterMinTime();
+		FString LongPackageName;
+		if (!FPackageName::SearchForPackageOnDisk(PackageName + FPackageName::GetMapPackageExtension(), &LongPackageName))
+		{
+			return false;
+		}
+		PackageName = LongPackageName;
+	}
+
+	if (!FPackageName::DoesPackageExist(PackageName))
+	{
+		return false;
 	}
+
+	OutPackageName = FName(*PackageName);
+	return true;
 }
 
-void ULevelTransitionSubsystem::OnAsyncLoadComplete()
+void ULevelTransitionSubsystem::OnPostLoadMap(UWorld* LoadedWorld)
 {
-	// 非同期ロード完了時の処理
-	// 現在は同期ロードを使用しているため、この関数は呼ばれない
-	SetLoadingProgress(1.0f);
+	FCoreUObjectDelegates::PostLoadMapWithWorld.Remove(PostLoadMapHandle);
+	PostLoadMapHandle.Reset();
+
+	// 以降はワールドがパッケージを保持する
+	LoadedMapPackage = nullptr;
+
+	// 最小表示時間は OpenLevel の前に確保済み
 	FinishLoadingAfterMinTime();
 }
 
@@ -216,5 +386,27 @@ void ULevelTransitionSubsystem::FinishLoadingAfterMinTime()
 	// 遷移完了を通知
 	OnLevelTransitionCompleted.Broadcast(PendingLevelName.ToString());
 
-	UE_LOG(LogDawnlight, Log, TEXT("[LevelTransitionSubsystem] レベル遷移完了: %s"), *PendingLevelName.ToString());
+	UE_LOG(LogDawnlight, Log, TEXT("[LevelTransitionSubsystem] レベル遷移完了: %s (%.2f秒)"),
+		*PendingLevelName.ToString(), FPlatformTime::Seconds() - LoadingStartTime);
+}
+
+void ULevelTransitionSubsystem::AbortTransition()
+{
+	if (UGameInstance* GameInstance = GetGameInstance())
+	{
+		GameInstance->GetTimerManager().ClearTimer(LoadingTimerHandle);
+		GameInstance->GetTimerManager().ClearTimer(ProgressTimerHandle);
+	}
+
+	FCoreUObjectDelegates::PostLoadMapWithWorld.Remove(PostLoadMapHandle);
+	PostLoadMapHandle.Reset();
+
+	LoadedMapPackage = nullptr;
+	bMapPackageLoaded = false;
+	bOpenLevelIssued = false;
+
+	HideLoadingScreen();
+	bIsTransitioning = false;
+
+	UE_LOG(LogDawnlight, Warning, TEXT("[LevelTransitionSubsystem] レベル遷移を中断: %s"), *PendingLevelName.ToString());
 }
@@ -4,9 +4,13 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "UObject/PrimaryAssetId.h"
+#include "UObject/UObjectGlobals.h"
 #include "LevelTransitionSubsystem.generated.h"
 
 class UUserWidget;
+class UPackage;
+struct FStreamableHandle;
 
 // デリゲート宣言
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnLevelTransitionStarted, const FString&, LevelName);
@@ -18,8 +22,9 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnLoadingProgressChanged, float, Pr
  *
  * シーン/レベルの遷移を管理
  * - ローディング画面の表示
- * - 非同期レベルロード
- * - 遷移アニメーション
+ * - 非同期レベルロード（マップパッケージを LoadPackageAsync で読み込み、常駐してから OpenLevel）
+ * - 実際のロード進捗をローディング画面へ反映
+ * - 最小表示時間の間に次のループで使うアセットバンドルを先読み
  */
 UCLASS()
 class DAWNLIGHT_API ULevelTransitionSubsystem : public UGameInstanceSubsystem
@@ -124,15 +129,58 @@ private:
 	/** 遷移先レベル名 */
 	FName PendingLevelName;
 
+	/** 遷移先マップのパッケージ名（/Game/... 形式） */
+	FName PendingPackageName;
+
+	/** 読み込み済みのマップパッケージ（OpenLevel までGCされないよう保持） */
+	UPROPERTY()
+	TObjectPtr<UPackage> LoadedMapPackage;
+
+	/** マップパッケージが常駐したか */
+	bool bMapPackageLoaded = false;
+
+	/** OpenLevel を発行済みか（以降はマップロード完了待ち） */
+	bool bOpenLevelIssued = false;
+
+	/** ループ用アセットの先読みハンドル（次の遷移開始まで保持） */
+	TSharedPtr<FStreamableHandle> LoopAssetPreloadHandle;
+
+	/** マップロード完了デリゲートハンドル */
+	FDelegateHandle PostLoadMapHandle;
+
 	/** 非同期ロード完了ハンドラ */
-	void OnAsyncLoadComplete();
+	void OnAsyncLoadComplete(const FName& PackageName, UPackage* LoadedPackage, EAsyncLoadingResult::Type Result);
 
 	/** 実際のレベル遷移を実行 */
 	void ExecuteLevelTransition(const FName& LevelName);
 
+	/** 非同期ロードの進捗を反映し、準備ができたら OpenLevel する */
+	void UpdateLoadingProgress();
+
+	/** 常駐済みのマップに切り替える */
+	void OpenLoadedLevel();
+
+	/** 現在のGameModeが参照する次のループ用アセットの先読みを開始 */
+	void StartLoopAssetPreload(UWorld* World, const FName& LevelName);
+
+	/** レベル名からマップのパッケージ名を解決 */
+	static bool ResolveMapPackageName(const FName& LevelName, FName& OutPackageName);
+
+	/** 新しいマップのロード完了時 */
+	void OnPostLoadMap(UWorld* LoadedWorld);
+
 	/** 最小表示時間経過後にローディングを終了 */
 	void FinishLoadingAfterMinTime();
 
+	/** 遷移を中断して状態を戻す */
+	void AbortTransition();
+
 	/** タイマーハンドル */
 	FTimerHandle LoadingTimerHandle;
+
+	/** 進捗更新タイマーハンドル */
+	FTimerHandle ProgressTimerHandle;
+
+	/** 進捗更新間隔（秒） */
+	static constexpr float ProgressUpdateInterval = 0.05f;
 };
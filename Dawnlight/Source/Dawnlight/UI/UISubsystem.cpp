@@ -4,6 +4,9 @@
 #include "DawnlightSaveGame.h"
 #include "Dawnlight.h"
 #include "Kismet/GameplayStatics.h"
+#include "Engine/GameInstance.h"
+#include "Async/Async.h"
+#include "TimerManager.h"
 #include "GameFramework/GameUserSettings.h"
 #include "AudioDevice.h"
 #include "AudioMixerDevice.h"
@@ -30,8 +33,37 @@ void UUISubsystem::Initialize(FSubsystemCollectionBase& Collection)
 
 void UUISubsystem::Deinitialize()
 {
-	// 終了時に設定を保存
-	SaveSettings();
+	if (UGameInstance* GameInstance = GetGameInstance())
+	{
+		GameInstance->GetTimerManager().ClearTimer(SaveDebounceTimerHandle);
+	}
+
+	// 同じスロットへの書き込みが重ならないよう、進行中の書き込みを待つ
+	if (SaveTask.IsValid())
+	{
+		SaveTask.Wait();
+		SaveTask = UE::Tasks::FTask();
+	}
+	bSaveInFlight = false;
+
+	// 未保存の変更は終了前に同期で書き込む
+	if (bSettingsDirty)
+	{
+		TArray<uint8> SaveData;
+		if (SerializeSettings(SaveData))
+		{
+			++SettingsWriteCount;
+			if (UGameplayStatics::SaveDataToSlot(SaveData, UDawnlightSaveGame::SaveSlotName, UDawnlightSaveGame::UserIndex))
+			{
+				UE_LOG(LogDawnlight, Log, TEXT("[UISubsystem] 終了時に設定を保存しました: %s"), *UDawnlightSaveGame::SaveSlotName);
+			}
+			else
+			{
+				UE_LOG(LogDawnlight, Error, TEXT("[UISubsystem] 終了時の設定保存に失敗しました"));
+			}
+		}
+		bSettingsDirty = false;
+	}
 
 	UE_LOG(LogDawnlight, Log, TEXT("[UISubsystem] 終了処理完了"));
 
@@ -57,7 +89,7 @@ void UUISubsystem::ApplySettings(const FDawnlightAllSettings& NewSettings)
 	ApplyAudioToEngine(CurrentSettings.Audio);
 
 	OnSettingsChanged.Broadcast(CurrentSettings);
-	SaveSettings();
+	RequestSaveSettings();
 
 	UE_LOG(LogDawnlight, Log, TEXT("[UISubsystem] 全設定を適用しました"));
 }
@@ -68,7 +100,7 @@ void UUISubsystem::ApplyAudioSettings(const FDawnlightAudioSettings& AudioSettin
 	ApplyAudioToEngine(AudioSettings);
 
 	OnSettingsChanged.Broadcast(CurrentSettings);
-	SaveSettings();
+	RequestSaveSettings();
 
 	UE_LOG(LogDawnlight, Log, TEXT("[UISubsystem] オーディオ設定を適用: Master=%.2f, Music=%.2f, SFX=%.2f"),
 		AudioSettings.MasterVolume, AudioSettings.MusicVolume, AudioSettings.SFXVolume);
@@ -80,7 +112,7 @@ void UUISubsystem::ApplyGraphicsSettings(const FDawnlightGraphicsSettings& Graph
 	ApplyGraphicsToEngine(GraphicsSettings);
 
 	OnSettingsChanged.Broadcast(CurrentSettings);
-	SaveSettings();
+	RequestSaveSettings();
 
 	UE_LOG(LogDawnlight, Log, TEXT("[UISubsystem] グラフィック設定を適用: %dx%d, VSync=%d"),
 		GraphicsSettings.Resolution.X, GraphicsSettings.Resolution.Y, GraphicsSettings.bVSync);
@@ -91,7 +123,7 @@ void UUISubsystem::ApplyControlSettings(const FDawnlightControlSettings& Control
 	CurrentSettings.Controls = ControlSettings;
 
 	OnSettingsChanged.Broadcast(CurrentSettings);
-	SaveSettings();
+	RequestSaveSettings();
 
 	UE_LOG(LogDawnlight, Log, TEXT("[UISubsystem] 操作設定を適用: Sensitivity=%.2f, InvertY=%d"),
 		ControlSettings.MouseSensitivity, ControlSettings.bInvertY);
@@ -102,7 +134,7 @@ void UUISubsystem::ApplyGameplaySettings(const FDawnlightGameplaySettings& Gamep
 	CurrentSettings.Gameplay = GameplaySettings;
 
 	OnSettingsChanged.Broadcast(CurrentSettings);
-	SaveSettings();
+	RequestSaveSettings();
 
 	UE_LOG(LogDawnlight, Log, TEXT("[UISubsystem] ゲームプレイ設定を適用: Subtitles=%d, Hints=%d"),
 		GameplaySettings.bShowSubtitles, GameplaySettings.bShowHints);
@@ -116,7 +148,7 @@ void UUISubsystem::ResetToDefaultSettings()
 	ApplyAudioToEngine(CurrentSettings.Audio);
 
 	OnSettingsChanged.Broadcast(CurrentSettings);
-	SaveSettings();
+	RequestSaveSettings();
 
 	UE_LOG(LogDawnlight, Log, TEXT("[UISubsystem] 全設定をデフォルトにリセットしました"));
 }
@@ -147,12 +179,87 @@ void UUISubsystem::ResetCategoryToDefault(ESettingsCategory Category)
 	}
 
 	OnSettingsChanged.Broadcast(CurrentSettings);
-	SaveSettings();
+	RequestSaveSettings();
 
 	UE_LOG(LogDawnlight, Log, TEXT("[UISubsystem] カテゴリ %d の設定をリセットしました"), static_cast<int32>(Category));
 }
 
 bool UUISubsystem::SaveSettings()
+{
+	if (UGameInstance* GameInstance = GetGameInstance())
+	{
+		GameInstance->GetTimerManager().ClearTimer(SaveDebounceTimerHandle);
+	}
+
+	bSettingsDirty = true;
+	return FlushPendingSave();
+}
+
+void UUISubsystem::RequestSaveSettings()
+{
+	bSettingsDirty = true;
+
+	// 変更のたびにタイマーを延長し、操作が落ち着いてから1回だけ書き込む
+	if (UGameInstance* GameInstance = GetGameInstance())
+	{
+		GameInstance->GetTimerManager().SetTimer(
+			SaveDebounceTimerHandle,
+			FTimerDelegate::CreateWeakLambda(this, [this]() { FlushPendingSave(); }),
+			SaveDebounceSeconds,
+			false
+		);
+	}
+	else
+	{
+		FlushPendingSave();
+	}
+}
+
+bool UUISubsystem::FlushPendingSave()
+{
+	if (!bSettingsDirty)
+	{
+		return true;
+	}
+
+	// 書き込み中の場合は完了時に最新の設定で書き直す
+	if (bSaveInFlight)
+	{
+		return true;
+	}
+
+	// シリアライズはゲームスレッドで行い、ファイル書き込みのみバックグラウンドで行う
+	TArray<uint8> SaveData;
+	if (!SerializeSettings(SaveData))
+	{
+		return false;
+	}
+
+	bSettingsDirty = false;
+	bSaveInFlight = true;
+	++SettingsWriteCount;
+
+	TWeakObjectPtr<UUISubsystem> WeakThis(this);
+	SaveTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [WeakThis, SaveData = MoveTemp(SaveData)]()
+	{
+		const bool bSuccess = UGameplayStatics::SaveDataToSlot(
+			SaveData,
+			UDawnlightSaveGame::SaveSlotName,
+			UDawnlightSaveGame::UserIndex);
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, bSuccess]()
+		{
+			if (UUISubsystem* StrongThis = WeakThis.Get())
+			{
+				StrongThis->OnSettingsSaveFinished(bSuccess);
+			}
+		});
+	});
+
+	return true;
+}
+
+bool UUISubsystem::SerializeSettings(TArray<uint8>& OutData) const
 {
 	UDawnlightSaveGame* SaveGameInstance = Cast<UDawnlightSaveGame>(
 		UGameplayStatics::CreateSaveGameObject(UDawnlightSaveGame::StaticClass()));
@@ -167,10 +274,24 @@ bool UUISubsystem::SaveSettings()
 	SaveGameInstance->SettingsVersion = UDawnlightSaveGame::GetCurrentVersion();
 	SaveGameInstance->LastSaveTime = FDateTime::Now();
 
-	bool bSuccess = UGameplayStatics::SaveGameToSlot(
-		SaveGameInstance,
-		UDawnlightSaveGame::SaveSlotName,
-		UDawnlightSaveGame::UserIndex);
+	if (!UGameplayStatics::SaveGameToMemory(SaveGameInstance, OutData))
+	{
+		UE_LOG(LogDawnlight, Error, TEXT("[UISubsystem] 設定のシリアライズに失敗しました"));
+		return false;
+	}
+
+	return true;
+}
+
+void UUISubsystem::OnSettingsSaveFinished(bool bSuccess)
+{
+	// 終了処理で既に完了を待った場合
+	if (!bSaveInFlight)
+	{
+		return;
+	}
+
+	bSaveInFlight = false;
 
 	if (bSuccess)
 	{
@@ -181,7 +302,15 @@ bool UUISubsystem::SaveSettings()
 		UE_LOG(LogDawnlight, Error, TEXT("[UISubsystem] 設定の保存に失敗しました"));
 	}
 
-	return bSuccess;
+	// 書き込み中に変更があり、デバウンス待ちでもなければ続けて書き込む
+	if (bSettingsDirty)
+	{
+		const UGameInstance* GameInstance = GetGameInstance();
+		if (!GameInstance || !GameInstance->GetTimerManager().IsTimerActive(SaveDebounceTimerHandle))
+		{
+			FlushPendingSave();
+		}
+	}
 }
 
 bool UUISubsystem::LoadSettings()
@@ -302,7 +431,7 @@ void UUISubsystem::ApplyQualityPreset(EGraphicsQuality Quality)
 	UserSettings->ApplySettings(false);
 
 	OnSettingsChanged.Broadcast(CurrentSettings);
-	SaveSettings();
+	RequestSaveSettings();
 
 	UE_LOG(LogDawnlight, Log, TEXT("[UISubsystem] 品質プリセットを適用: %d"), QualityLevel);
 }
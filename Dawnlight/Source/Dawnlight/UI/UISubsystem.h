@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "DawnlightUITypes.h"
+#include "Tasks/Task.h"
 #include "UISubsystem.generated.h"
 
 class UDawnlightSaveGame;
@@ -19,7 +20,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnScreenChanged, EDawnlightScreenTy
  *
  * アウトゲームUIの管理と設定の永続化を担当
  * - 画面遷移管理
- * - 設定の読み込み/保存
+ * - 設定の読み込み/保存（変更はデバウンスしてバックグラウンドで書き込み）
  * - グラフィック設定の適用
  * - オーディオ設定の適用
  */
@@ -104,10 +105,25 @@ public:
 	// 設定の永続化
 	// ========================================================================
 
-	/** 設定をファイルに保存 */
+	/**
+	 * 設定を即座に保存（書き込みはバックグラウンド、進行中の書き込みがあれば完了後に行う）
+	 * @return 設定のシリアライズに失敗した場合は false（ファイル書き込みの結果はログに出力）
+	 */
 	UFUNCTION(BlueprintCallable, Category = "設定")
 	bool SaveSettings();
 
+	/** 設定の保存を予約（一定時間変更がなければまとめて1回書き込む） */
+	UFUNCTION(BlueprintCallable, Category = "設定")
+	void RequestSaveSettings();
+
+	/** 未保存の変更があるか */
+	UFUNCTION(BlueprintPure, Category = "設定")
+	bool HasPendingSettingsSave() const { return bSettingsDirty || bSaveInFlight; }
+
+	/** 起動後に発行した書き込み回数 */
+	UFUNCTION(BlueprintPure, Category = "設定")
+	int32 GetSettingsWriteCount() const { return SettingsWriteCount; }
+
 	/** 設定をファイルから読み込み */
 	UFUNCTION(BlueprintCallable, Category = "設定")
 	bool LoadSettings();
@@ -147,6 +163,40 @@ private:
 	/** 現在の設定 */
 	FDawnlightAllSettings CurrentSettings;
 
+	// ========================================================================
+	// 保存のデバウンス
+	// ========================================================================
+
+	/** 最後の変更から書き込みまでの待ち時間（スライダー操作をまとめる） */
+	static constexpr float SaveDebounceSeconds = 0.5f;
+
+	/** 書き込んでいない変更があるか */
+	bool bSettingsDirty = false;
+
+	/** バックグラウンドで書き込み中か */
+	bool bSaveInFlight = false;
+
+	/** 発行した書き込み回数 */
+	int32 SettingsWriteCount = 0;
+
+	/** デバウンス用タイマー */
+	FTimerHandle SaveDebounceTimerHandle;
+
+	/** 書き込みタスク（終了時に完了を待つ） */
+	UE::Tasks::FTask SaveTask;
+
+	/**
+	 * 未保存の変更をバックグラウンドで書き込む
+	 * @return 書き込みを開始できなかった場合（シリアライズ失敗）は false
+	 */
+	bool FlushPendingSave();
+
+	/** 現在の設定をセーブデータのバイト列にする */
+	bool SerializeSettings(TArray<uint8>& OutData) const;
+
+	/** 書き込み完了時（ゲームスレッド） */
+	void OnSettingsSaveFinished(bool bSuccess);
+
 	/** グラフィック設定をエンジンに適用 */
 	void ApplyGraphicsToEngine(const FDawnlightGraphicsSettings& Settings);
 
@@ -3,6 +3,23 @@
 #include "UIAnimationLibrary.h"
 #include "Components/Widget.h"
 #include "Blueprint/UserWidget.h"
+#include "UITweenEngine.h"
+
+namespace
+{
+	/** 遅延なしの補間トゥイーンを作成 */
+	FUITween MakeTween(UWidget* Widget, EUITweenProperty Property, const FVector2D& From, const FVector2D& To, float Duration, EUIEaseType Ease)
+	{
+		FUITween Tween;
+		Tween.Widget = Widget;
+		Tween.Property = Property;
+		Tween.From = From;
+		Tween.To = To;
+		Tween.Duration = Duration;
+		Tween.Ease = Ease;
+		return Tween;
+	}
+}
 
 // ========================================================================
 // イージング関数
@@ -37,6 +54,9 @@ float UUIAnimationLibrary::CalculateEase(float Alpha, EUIEaseType EaseType)
 	case EUIEaseType::Back:
 		return EaseBack(Alpha);
 
+	case EUIEaseType::EaseOutCubic:
+		return 1.0f - FMath::Pow(1.0f - Alpha, 3.0f);
+
 	default:
 		return Alpha;
 	}
@@ -108,13 +128,15 @@ void UUIAnimationLibrary::AnimatePopIn(UWidget* Widget, float Duration)
 		return;
 	}
 
-	// 初期状態を設定（実際のアニメーションはTimerやTweenライブラリで実行）
-	// ここでは即時に最終状態を設定
-	Widget->SetRenderScale(FVector2D(1.0f, 1.0f));
-	Widget->SetRenderOpacity(1.0f);
+	// 0から弾むように拡大しつつフェードイン
+	Widget->SetRenderScale(FVector2D::ZeroVector);
+	Widget->SetRenderOpacity(0.0f);
 
-	// TODO: TimerManagerを使ったアニメーション実装
-	// または、WidgetAnimationをBPで作成して使用
+	FUITweenEngine& TweenEngine = FUITweenEngine::Get();
+	TweenEngine.AddTween(MakeTween(Widget, EUITweenProperty::Scale,
+		FVector2D::ZeroVector, FVector2D(1.0f, 1.0f), Duration, EUIEaseType::Back));
+	TweenEngine.AddTween(MakeTween(Widget, EUITweenProperty::Opacity,
+		FVector2D(0.0f, 0.0f), FVector2D(1.0f, 0.0f), Duration * 0.5f, EUIEaseType::EaseOut));
 }
 
 void UUIAnimationLibrary::AnimatePopOut(UWidget* Widget, float Duration)
@@ -124,8 +146,18 @@ void UUIAnimationLibrary::AnimatePopOut(UWidget* Widget, float Duration)
 		return;
 	}
 
-	Widget->SetRenderScale(FVector2D(0.0f, 0.0f));
-	Widget->SetRenderOpacity(0.0f);
+	// 現在の状態から縮小しつつフェードアウト
+	FUITween ScaleTween = MakeTween(Widget, EUITweenProperty::Scale,
+		FVector2D::ZeroVector, FVector2D::ZeroVector, Duration, EUIEaseType::EaseIn);
+	ScaleTween.bFromCurrent = true;
+
+	FUITween OpacityTween = MakeTween(Widget, EUITweenProperty::Opacity,
+		FVector2D::ZeroVector, FVector2D::ZeroVector, Duration, EUIEaseType::EaseIn);
+	OpacityTween.bFromCurrent = true;
+
+	FUITweenEngine& TweenEngine = FUITweenEngine::Get();
+	TweenEngine.AddTween(MoveTemp(ScaleTween));
+	TweenEngine.AddTween(MoveTemp(OpacityTween));
 }
 
 void UUIAnimationLibrary::AnimateHoverScale(UWidget* Widget, bool bIsHovered, float Scale, float Duration)
@@ -135,8 +167,11 @@ void UUIAnimationLibrary::AnimateHoverScale(UWidget* Widget, bool bIsHovered, fl
 		return;
 	}
 
-	FVector2D TargetScale = bIsHovered ? FVector2D(Scale, Scale) : FVector2D(1.0f, 1.0f);
-	Widget->SetRenderScale(TargetScale);
+	const FVector2D TargetScale = bIsHovered ? FVector2D(Scale, Scale) : FVector2D(1.0f, 1.0f);
+
+	FUITween Tween = MakeTween(Widget, EUITweenProperty::Scale, FVector2D::ZeroVector, TargetScale, Duration, EUIEaseType::EaseOut);
+	Tween.bFromCurrent = true;
+	FUITweenEngine::Get().AddTween(MoveTemp(Tween));
 }
 
 void UUIAnimationLibrary::AnimatePressScale(UWidget* Widget, bool bIsPressed, float Scale, float Duration)
@@ -146,8 +181,11 @@ void UUIAnimationLibrary::AnimatePressScale(UWidget* Widget, bool bIsPressed, fl
 		return;
 	}
 
-	FVector2D TargetScale = bIsPressed ? FVector2D(Scale, Scale) : FVector2D(1.0f, 1.0f);
-	Widget->SetRenderScale(TargetScale);
+	const FVector2D TargetScale = bIsPressed ? FVector2D(Scale, Scale) : FVector2D(1.0f, 1.0f);
+
+	FUITween Tween = MakeTween(Widget, EUITweenProperty::Scale, FVector2D::ZeroVector, TargetScale, Duration, EUIEaseType::EaseOut);
+	Tween.bFromCurrent = true;
+	FUITweenEngine::Get().AddTween(MoveTemp(Tween));
 }
 
 // ========================================================================
@@ -161,9 +199,11 @@ void UUIAnimationLibrary::AnimateShake(UWidget* Widget, float Intensity, float D
 		return;
 	}
 
-	// シェイク効果はTickベースで実装が必要
-	// ここでは初期位置に戻す
-	Widget->SetRenderTranslation(FVector2D::ZeroVector);
+	// 現在の位置を中心に減衰しながら揺らす
+	FUITween Tween = MakeTween(Widget, EUITweenProperty::Translation,
+		Widget->GetRenderTransform().Translation, FVector2D(Intensity, 0.0f), Duration, EUIEaseType::Linear);
+	Tween.Mode = EUITweenMode::Shake;
+	FUITweenEngine::Get().AddTween(MoveTemp(Tween));
 }
 
 void UUIAnimationLibrary::AnimateBounce(UWidget* Widget, float Intensity, float Duration)
@@ -173,8 +213,11 @@ void UUIAnimationLibrary::AnimateBounce(UWidget* Widget, float Intensity, float
 		return;
 	}
 
-	// バウンス効果はTickベースで実装が必要
-	Widget->SetRenderTranslation(FVector2D::ZeroVector);
+	// 現在の位置から上に弾み、高さを減衰させる
+	FUITween Tween = MakeTween(Widget, EUITweenProperty::Translation,
+		Widget->GetRenderTransform().Translation, FVector2D(Intensity, 0.0f), Duration, EUIEaseType::Linear);
+	Tween.Mode = EUITweenMode::Bounce;
+	FUITweenEngine::Get().AddTween(MoveTemp(Tween));
 }
 
 // ========================================================================
@@ -22,7 +22,8 @@ enum class EUIEaseType : uint8
 	EaseInOut     UMETA(DisplayName = "Ease In/Out"),
 	Bounce        UMETA(DisplayName = "Bounce"),
 	Elastic       UMETA(DisplayName = "Elastic"),
-	Back          UMETA(DisplayName = "Back (Overshoot)")
+	Back          UMETA(DisplayName = "Back (Overshoot)"),
+	EaseOutCubic  UMETA(DisplayName = "Ease Out (Cubic)")
 };
 
 /**
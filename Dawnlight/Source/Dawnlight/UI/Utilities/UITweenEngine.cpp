@@ -0,0 +1,278 @@
+// Soul Reaper - Dawnlight Project
+// Copyright (c) 2025. All Rights Reserved.
+
+#include "UITweenEngine.h"
+#include "DawnlightStats.h"
+#include "Components/Widget.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Active Tweens"), STAT_DawnlightActiveTweens, STATGROUP_DawnlightUI);
+DECLARE_CYCLE_STAT(TEXT("Tween Tick"), STAT_DawnlightTweenTick, STATGROUP_DawnlightUI);
+
+TUniquePtr<FUITweenEngine> FUITweenEngine::Instance;
+
+FUITweenEngine::FUITweenEngine()
+{
+	ShakeStream.GenerateNewSeed();
+}
+
+FUITweenEngine& FUITweenEngine::Get()
+{
+	if (!Instance)
+	{
+		Instance.Reset(new FUITweenEngine());
+	}
+	return *Instance;
+}
+
+void FUITweenEngine::Shutdown()
+{
+	Instance.Reset();
+}
+
+// ========================================================================
+// トゥイーン操作
+// ========================================================================
+
+void FUITweenEngine::AddTween(FUITween&& Tween)
+{
+	const UWidget* Widget = Tween.Widget.Get();
+	if (!Widget)
+	{
+		return;
+	}
+
+	// 同じプロパティを奪い合わないよう既存のトゥイーンを置き換える
+	CancelTweensForWidget(Widget, Tween.Property);
+
+	Tween.Elapsed = 0.0f;
+	Tween.bStarted = false;
+	Tweens.Add(MoveTemp(Tween));
+}
+
+void FUITweenEngine::CancelTweensForWidget(const UWidget* Widget, bool bSnapToEnd)
+{
+	if (!Widget)
+	{
+		return;
+	}
+
+	TArray<TFunction<void()>, TInlineAllocator<4>> CompletedCallbacks;
+
+	for (int32 i = Tweens.Num() - 1; i >= 0; --i)
+	{
+		FUITween& Tween = Tweens[i];
+		if (Tween.Widget.Get() != Widget)
+		{
+			continue;
+		}
+
+		if (bSnapToEnd)
+		{
+			UWidget* MutableWidget = Tween.Widget.Get();
+			if (!Tween.bStarted && Tween.bFromCurrent)
+			{
+				Tween.From = GetPropertyValue(MutableWidget, Tween.Property);
+			}
+			ApplyTween(Tween, MutableWidget, 1.0f);
+
+			if (Tween.OnComplete)
+			{
+				CompletedCallbacks.Add(MoveTemp(Tween.OnComplete));
+			}
+		}
+
+		Tweens.RemoveAtSwap(i, EAllowShrinking::No);
+	}
+
+	// コールバック内で新しいトゥイーンが追加されても良いよう、削除後に呼ぶ
+	for (TFunction<void()>& Callback : CompletedCallbacks)
+	{
+		Callback();
+	}
+}
+
+void FUITweenEngine::CancelTweensForWidget(const UWidget* Widget, EUITweenProperty Property)
+{
+	for (int32 i = Tweens.Num() - 1; i >= 0; --i)
+	{
+		if (Tweens[i].Widget.Get() == Widget && Tweens[i].Property == Property)
+		{
+			Tweens.RemoveAtSwap(i, EAllowShrinking::No);
+		}
+	}
+}
+
+bool FUITweenEngine::IsAnimating(const UWidget* Widget) const
+{
+	if (!Widget)
+	{
+		return false;
+	}
+
+	return Tweens.ContainsByPredicate([Widget](const FUITween& Tween)
+	{
+		return Tween.Widget.Get() == Widget;
+	});
+}
+
+// ========================================================================
+// FTickableGameObject インターフェース
+// ========================================================================
+
+void FUITweenEngine::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_DawnlightTweenTick);
+	INC_DWORD_STAT_BY(STAT_DawnlightActiveTweens, Tweens.Num());
+
+	TArray<TFunction<void()>, TInlineAllocator<4>> CompletedCallbacks;
+
+	// 削除で末尾と入れ替わるため後ろから走査
+	for (int32 i = Tweens.Num() - 1; i >= 0; --i)
+	{
+		FUITween& Tween = Tweens[i];
+
+		UWidget* Widget = Tween.Widget.Get();
+		if (!Widget)
+		{
+			Tweens.RemoveAtSwap(i, EAllowShrinking::No);
+			continue;
+		}
+
+		Tween.Elapsed += DeltaTime;
+		if (Tween.Elapsed < Tween.Delay)
+		{
+			continue;
+		}
+
+		if (!Tween.bStarted)
+		{
+			Tween.bStarted = true;
+			if (Tween.bFromCurrent)
+			{
+				Tween.From = GetPropertyValue(Widget, Tween.Property);
+			}
+		}
+
+		const float ActiveTime = Tween.Elapsed - Tween.Delay;
+
+		if (Tween.bLoop)
+		{
+			const float LoopAlpha = Tween.Duration > 0.0f ? FMath::Fmod(ActiveTime, Tween.Duration) / Tween.Duration : 1.0f;
+			ApplyTween(Tween, Widget, LoopAlpha);
+			continue;
+		}
+
+		const float Alpha = Tween.Duration > 0.0f ? FMath::Min(ActiveTime / Tween.Duration, 1.0f) : 1.0f;
+		ApplyTween(Tween, Widget, Alpha);
+
+		if (Alpha >= 1.0f)
+		{
+			if (Tween.OnComplete)
+			{
+				CompletedCallbacks.Add(MoveTemp(Tween.OnComplete));
+			}
+			Tweens.RemoveAtSwap(i, EAllowShrinking::No);
+		}
+	}
+
+	// コールバック内で新しいトゥイーンが追加されても良いよう、走査後に呼ぶ
+	for (TFunction<void()>& Callback : CompletedCallbacks)
+	{
+		Callback();
+	}
+}
+
+TStatId FUITweenEngine::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(FUITweenEngine, STATGROUP_Tickables);
+}
+
+// ========================================================================
+// 内部処理
+// ========================================================================
+
+void FUITweenEngine::ApplyTween(FUITween& Tween, UWidget* Widget, float Alpha) const
+{
+	FVector2D Value = Tween.To;
+
+	switch (Tween.Mode)
+	{
+	case EUITweenMode::Interpolate:
+		Value = Tween.From + (Tween.To - Tween.From) * UUIAnimationLibrary::CalculateEase(Alpha, Tween.Ease);
+		break;
+
+	case EUITweenMode::Pulse:
+		{
+			// 最小値から始まり最小値に戻るSin波
+			const float PulseAlpha = (FMath::Sin(Alpha * PI * 2.0f - PI * 0.5f) + 1.0f) * 0.5f;
+			Value = FMath::Lerp(Tween.From, Tween.To, PulseAlpha);
+		}
+		break;
+
+	case EUITweenMode::Shake:
+		if (Alpha >= 1.0f)
+		{
+			Value = Tween.From;
+		}
+		else
+		{
+			// 減衰するランダムオフセット
+			const float DecayedIntensity = Tween.To.X * (1.0f - Alpha);
+			Value = Tween.From + FVector2D(
+				ShakeStream.FRandRange(-DecayedIntensity, DecayedIntensity),
+				ShakeStream.FRandRange(-DecayedIntensity, DecayedIntensity)
+			);
+		}
+		break;
+
+	case EUITweenMode::Bounce:
+		if (Alpha >= 1.0f)
+		{
+			Value = Tween.From;
+		}
+		else
+		{
+			// 3回弾みながら高さが減衰
+			const float Height = Tween.To.X * (1.0f - Alpha) * FMath::Abs(FMath::Sin(Alpha * PI * 3.0f));
+			Value = Tween.From - FVector2D(0.0f, Height);
+		}
+		break;
+	}
+
+	SetPropertyValue(Widget, Tween.Property, Value);
+}
+
+FVector2D FUITweenEngine::GetPropertyValue(const UWidget* Widget, EUITweenProperty Property)
+{
+	switch (Property)
+	{
+	case EUITweenProperty::Opacity:
+		return FVector2D(Widget->GetRenderOpacity(), 0.0f);
+
+	case EUITweenProperty::Scale:
+		return Widget->GetRenderTransform().Scale;
+
+	case EUITweenProperty::Translation:
+		return Widget->GetRenderTransform().Translation;
+	}
+
+	return FVector2D::ZeroVector;
+}
+
+void FUITweenEngine::SetPropertyValue(UWidget* Widget, EUITweenProperty Property, const FVector2D& Value)
+{
+	switch (Property)
+	{
+	case EUITweenProperty::Opacity:
+		Widget->SetRenderOpacity(Value.X);
+		break;
+
+	case EUITweenProperty::Scale:
+		Widget->SetRenderScale(Value);
+		break;
+
+	case EUITweenProperty::Translation:
+		Widget->SetRenderTranslation(Value);
+		break;
+	}
+}
@@ -0,0 +1,156 @@
+// Soul Reaper - Dawnlight Project
+// Copyright (c) 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Tickable.h"
+#include "Math/RandomStream.h"
+#include "UIAnimationLibrary.h"
+
+class UWidget;
+
+/**
+ * トゥイーンで変化させるウィジェットのプロパティ
+ */
+enum class EUITweenProperty : uint8
+{
+	/** レンダー不透明度（X成分のみ使用） */
+	Opacity,
+	/** レンダースケール */
+	Scale,
+	/** レンダー移動量 */
+	Translation
+};
+
+/**
+ * トゥイーンの評価方法
+ */
+enum class EUITweenMode : uint8
+{
+	/** From → To をイージングで補間 */
+	Interpolate,
+	/** From と To の間をSin波で往復（ループ向け） */
+	Pulse,
+	/** From を中心に To.X の強さで減衰するランダム揺れ（最後は From に戻る） */
+	Shake,
+	/** From を中心に To.X の高さで減衰しながら上に弾む（最後は From に戻る） */
+	Bounce
+};
+
+/**
+ * 1つのトゥイーンの定義
+ */
+struct FUITween
+{
+	/** 対象ウィジェット */
+	TWeakObjectPtr<UWidget> Widget;
+
+	/** 対象プロパティ */
+	EUITweenProperty Property = EUITweenProperty::Opacity;
+
+	/** 評価方法 */
+	EUITweenMode Mode = EUITweenMode::Interpolate;
+
+	/** イージング（Interpolate のみ） */
+	EUIEaseType Ease = EUIEaseType::Linear;
+
+	/** 開始値（bFromCurrent の場合は遅延終了時に現在値で上書き） */
+	FVector2D From = FVector2D::ZeroVector;
+
+	/** 終了値 */
+	FVector2D To = FVector2D::ZeroVector;
+
+	/** 再生時間（秒） */
+	float Duration = 0.3f;
+
+	/** 開始までの遅延（秒） */
+	float Delay = 0.0f;
+
+	/** 遅延終了時の現在値を開始値にするか */
+	bool bFromCurrent = false;
+
+	/** 終了せずに繰り返すか */
+	bool bLoop = false;
+
+	/** 完了時のコールバック（キャンセル時は呼ばれない） */
+	TFunction<void()> OnComplete;
+
+	/** 経過時間（遅延を含む） */
+	float Elapsed = 0.0f;
+
+	/** 開始値を確定済みか */
+	bool bStarted = false;
+};
+
+/**
+ * UIトゥイーンエンジン
+ *
+ * 全UIアニメーションを1つの FTickableGameObject でまとめて更新する
+ * - アクティブなトゥイーンを連続配列で保持し、1フレームに1回だけ走査
+ * - ステップごとにタイマーを登録する方式を置き換え、タイマーマネージャーの負荷をなくす
+ * - ポーズ中も更新（ポーズメニュー等のため）
+ * - ウィジェット単位・プロパティ単位でキャンセル可能
+ *
+ * 同じウィジェットの同じプロパティに新しいトゥイーンを追加すると、既存のものは置き換えられる
+ */
+class DAWNLIGHT_API FUITweenEngine : public FTickableGameObject
+{
+public:
+	/** エンジンを取得（初回呼び出し時に作成） */
+	static FUITweenEngine& Get();
+
+	/** エンジンを破棄（モジュール終了時） */
+	static void Shutdown();
+
+	// ========================================================================
+	// トゥイーン操作
+	// ========================================================================
+
+	/** トゥイーンを追加 */
+	void AddTween(FUITween&& Tween);
+
+	/** ウィジェットのトゥイーンを全てキャンセル（bSnapToEnd なら終了値を適用） */
+	void CancelTweensForWidget(const UWidget* Widget, bool bSnapToEnd = false);
+
+	/** ウィジェットの特定プロパティのトゥイーンをキャンセル */
+	void CancelTweensForWidget(const UWidget* Widget, EUITweenProperty Property);
+
+	/** ウィジェットにアクティブなトゥイーンがあるか */
+	bool IsAnimating(const UWidget* Widget) const;
+
+	/** アクティブなトゥイーン数 */
+	int32 GetActiveTweenCount() const { return Tweens.Num(); }
+
+	// ========================================================================
+	// FTickableGameObject インターフェース
+	// ========================================================================
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual ETickableTickType GetTickableTickType() const override { return ETickableTickType::Conditional; }
+	virtual bool IsTickable() const override { return Tweens.Num() > 0; }
+	virtual bool IsTickableWhenPaused() const override { return true; }
+	virtual bool IsTickableInEditor() const override { return false; }
+
+private:
+	FUITweenEngine();
+
+	/** トゥイーンの値を評価してウィジェットに適用 */
+	void ApplyTween(FUITween& Tween, UWidget* Widget, float Alpha) const;
+
+	/** プロパティの現在値を取得 */
+	static FVector2D GetPropertyValue(const UWidget* Widget, EUITweenProperty Property);
+
+	/** プロパティに値を設定 */
+	static void SetPropertyValue(UWidget* Widget, EUITweenProperty Property, const FVector2D& Value);
+
+	/** アクティブなトゥイーン（順不同） */
+	TArray<FUITween> Tweens;
+
+	/** シェイクのオフセット用の乱数（ゲームプレイの乱数を消費しない） */
+	FRandomStream ShakeStream;
+
+	/** シングルトン */
+	static TUniquePtr<FUITweenEngine> Instance;
+};
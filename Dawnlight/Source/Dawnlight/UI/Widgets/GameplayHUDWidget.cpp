@@ -3,6 +3,7 @@
 
 #include "GameplayHUDWidget.h"
 #include "Dawnlight.h"
+#include "DawnlightStats.h"
 #include "Components/ProgressBar.h"
 #include "Components/TextBlock.h"
 #include "Components/Image.h"
@@ -64,6 +65,8 @@ void UGameplayHUDWidget::NativeDestruct()
 
 void UGameplayHUDWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
 {
+	DAWNLIGHT_SCOPE_CYCLE_COUNTER(STAT_DawnlightHUDTick);
+
 	Super::NativeTick(MyGeometry, InDeltaTime);
 
 	// ViewModelがある場合は、時間系のみ毎フレーム同期
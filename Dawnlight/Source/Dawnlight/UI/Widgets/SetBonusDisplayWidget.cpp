@@ -3,8 +3,10 @@
 
 #include "SetBonusDisplayWidget.h"
 #include "Dawnlight.h"
+#include "DawnlightStats.h"
 #include "Subsystems/UpgradeSubsystem.h"
 #include "Subsystems/SoulCollectionSubsystem.h"
+#include "Subsystems/DawnlightAssetPreloader.h"
 #include "Components/VerticalBox.h"
 #include "Components/HorizontalBox.h"
 #include "Components/HorizontalBoxSlot.h"
@@ -60,6 +62,8 @@ void USetBonusDisplayWidget::NativeDestruct()
 
 void USetBonusDisplayWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
 {
+	DAWNLIGHT_SCOPE_CYCLE_COUNTER(STAT_DawnlightHUDTick);
+
 	Super::NativeTick(MyGeometry, InDeltaTime);
 
 	// 自動更新
@@ -294,13 +298,20 @@ UWidget* USetBonusDisplayWidget::CreateSingleBonusItemWidget(ESoulType SoulType)
 	{
 		if (const TSoftObjectPtr<UTexture2D>* IconPtr = SoulTypeIcons.Find(SoulType))
 		{
-			if (IconPtr->IsValid() || !IconPtr->IsNull())
+			if (!IconPtr->IsNull())
 			{
-				UTexture2D* IconTexture = IconPtr->LoadSynchronous();
-				if (IconTexture)
-				{
-					IconImage->SetBrushFromTexture(IconTexture);
-				}
+				// 未ロードの場合はロード完了後に設定（ゲームスレッドをブロックしない）
+				TWeakObjectPtr<UImage> WeakIconImage(IconImage);
+				UDawnlightAssetPreloader::RequestSoftPath(this, IconPtr->ToSoftObjectPath(), TEXT("SetBonusDisplay"),
+					[WeakIconImage](UObject* LoadedObject)
+					{
+						UImage* Image = WeakIconImage.Get();
+						UTexture2D* IconTexture = Cast<UTexture2D>(LoadedObject);
+						if (Image && IconTexture)
+						{
+							Image->SetBrushFromTexture(IconTexture);
+						}
+					});
 			}
 		}
 		IconImage->SetColorAndOpacity(TypeColor);
@@ -3,6 +3,7 @@
 
 #include "SoulParticleWidget.h"
 #include "Dawnlight.h"
+#include "DawnlightStats.h"
 #include "Rendering/DrawElements.h"
 
 USoulParticleWidget::USoulParticleWidget(const FObjectInitializer& ObjectInitializer)
@@ -42,6 +43,8 @@ void USoulParticleWidget::NativeConstruct()
 
 void USoulParticleWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
 {
+	DAWNLIGHT_SCOPE_CYCLE_COUNTER(STAT_DawnlightHUDTick);
+
 	Super::NativeTick(MyGeometry, InDeltaTime);
 
 	TotalTime += InDeltaTime;
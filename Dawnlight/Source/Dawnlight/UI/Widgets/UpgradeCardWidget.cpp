@@ -4,6 +4,7 @@
 #include "UpgradeCardWidget.h"
 #include "Dawnlight.h"
 #include "Data/UpgradeDataAsset.h"
+#include "Subsystems/DawnlightAssetPreloader.h"
 #include "Components/Image.h"
 #include "Components/TextBlock.h"
 #include "Components/Button.h"
@@ -121,17 +122,30 @@ void UUpgradeCardWidget::UpdateUI()
 	// アイコンを設定
 	if (UpgradeIcon)
 	{
-		if (UpgradeData->Icon.IsValid() || !UpgradeData->Icon.IsNull())
+		if (!UpgradeData->Icon.IsNull())
 		{
-			UTexture2D* IconTexture = UpgradeData->Icon.LoadSynchronous();
-			if (IconTexture)
-			{
-				UpgradeIcon->SetBrushFromTexture(IconTexture);
-			}
-			else if (DefaultIcon)
+			// プリロード済みなら即座に、未ロードならロード完了後に設定
+			if (DefaultIcon)
 			{
 				UpgradeIcon->SetBrushFromTexture(DefaultIcon);
 			}
+
+			TWeakObjectPtr<UUpgradeCardWidget> WeakThis(this);
+			const TSoftObjectPtr<UTexture2D> RequestedIcon = UpgradeData->Icon;
+			UDawnlightAssetPreloader::RequestSoftPath(this, RequestedIcon.ToSoftObjectPath(), TEXT("UpgradeCard"),
+				[WeakThis, RequestedIcon](UObject* LoadedObject)
+				{
+					UUpgradeCardWidget* Widget = WeakThis.Get();
+					if (!Widget || !Widget->UpgradeIcon || !Widget->UpgradeData || Widget->UpgradeData->Icon != RequestedIcon)
+					{
+						return;
+					}
+
+					if (UTexture2D* IconTexture = Cast<UTexture2D>(LoadedObject))
+					{
+						Widget->UpgradeIcon->SetBrushFromTexture(IconTexture);
+					}
+				});
 		}
 		else if (DefaultIcon)
 		{
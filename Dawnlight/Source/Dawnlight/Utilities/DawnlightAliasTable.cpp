@@ -0,0 +1,109 @@
+// Soul Reaper - Dawnlight Project
+// Copyright (c) 2025. All Rights Reserved.
+
+#include "DawnlightAliasTable.h"
+
+void FDawnlightAliasTable::Build(TConstArrayView<float> Weights)
+{
+	Reset();
+
+	const int32 Count = Weights.Num();
+	double TotalWeight = 0.0;
+	for (const float Weight : Weights)
+	{
+		TotalWeight += FMath::Max(Weight, 0.0f);
+	}
+
+	if (Count == 0 || TotalWeight <= 0.0)
+	{
+		return;
+	}
+
+	Probabilities.SetNumUninitialized(Count);
+	Aliases.SetNumUninitialized(Count);
+
+	// 平均が1になるよう正規化し、1未満（Small）と1以上（Large）に振り分ける
+	TArray<double> Scaled;
+	Scaled.SetNumUninitialized(Count);
+
+	TArray<int32> Small;
+	TArray<int32> Large;
+	Small.Reserve(Count);
+	Large.Reserve(Count);
+
+	for (int32 i = 0; i < Count; ++i)
+	{
+		Scaled[i] = FMath::Max(Weights[i], 0.0f) * Count / TotalWeight;
+		Aliases[i] = i;
+
+		if (Scaled[i] < 1.0)
+		{
+			Small.Add(i);
+		}
+		else
+		{
+			Large.Add(i);
+		}
+	}
+
+	// Small の不足分を Large で埋める
+	while (Small.Num() > 0 && Large.Num() > 0)
+	{
+		const int32 SmallIndex = Small.Pop(EAllowShrinking::No);
+		const int32 LargeIndex = Large.Pop(EAllowShrinking::No);
+
+		Probabilities[SmallIndex] = static_cast<float>(Scaled[SmallIndex]);
+		Aliases[SmallIndex] = LargeIndex;
+
+		Scaled[LargeIndex] = (Scaled[LargeIndex] + Scaled[SmallIndex]) - 1.0;
+		if (Scaled[LargeIndex] < 1.0)
+		{
+			Small.Add(LargeIndex);
+		}
+		else
+		{
+			Large.Add(LargeIndex);
+		}
+	}
+
+	// 残りは丸め誤差のみなので確定採択
+	for (const int32 Index : Large)
+	{
+		Probabilities[Index] = 1.0f;
+	}
+	for (const int32 Index : Small)
+	{
+		Probabilities[Index] = 1.0f;
+	}
+}
+
+int32 FDawnlightAliasTable::Sample() const
+{
+	if (!IsValid())
+	{
+		return INDEX_NONE;
+	}
+
+	return Resolve(FMath::RandRange(0, Probabilities.Num() - 1), FMath::FRand());
+}
+
+int32 FDawnlightAliasTable::Sample(const FRandomStream& RandomStream) const
+{
+	if (!IsValid())
+	{
+		return INDEX_NONE;
+	}
+
+	return Resolve(RandomStream.RandRange(0, Probabilities.Num() - 1), RandomStream.FRand());
+}
+
+void FDawnlightAliasTable::Reset()
+{
+	Probabilities.Reset();
+	Aliases.Reset();
+}
+
+int32 FDawnlightAliasTable::Resolve(int32 Column, float Roll) const
+{
+	return Roll < Probabilities[Column] ? Column : Aliases[Column];
+}
@@ -0,0 +1,44 @@
+// Soul Reaper - Dawnlight Project
+// Copyright (c) 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * エイリアス法（Walker/Vose）による重み付き抽選テーブル
+ *
+ * 構築は O(N)、抽選は乱数2回の O(1)
+ * 重みが変わらない候補群から何度も抽選する場合に使用する
+ */
+class DAWNLIGHT_API FDawnlightAliasTable
+{
+public:
+	/** 重み配列からテーブルを構築（負の重みは0扱い） */
+	void Build(TConstArrayView<float> Weights);
+
+	/** 1件抽選してインデックスを返す（空・重み合計0の場合は INDEX_NONE） */
+	int32 Sample() const;
+
+	/** 乱数ストリームを指定して抽選 */
+	int32 Sample(const FRandomStream& RandomStream) const;
+
+	/** 抽選可能か */
+	bool IsValid() const { return Probabilities.Num() > 0; }
+
+	/** 要素数 */
+	int32 Num() const { return Probabilities.Num(); }
+
+	/** 全て削除 */
+	void Reset();
+
+private:
+	/** 一様に選んだ列を採択する確率 */
+	TArray<float> Probabilities;
+
+	/** 不採択時の代替インデックス */
+	TArray<int32> Aliases;
+
+	/** 列と採択判定用の乱数2つから結果を決定 */
+	int32 Resolve(int32 Column, float Roll) const;
+};
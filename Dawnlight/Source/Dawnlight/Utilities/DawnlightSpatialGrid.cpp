@@ -0,0 +1,282 @@
+// Soul Reaper - Dawnlight Project
+// Copyright (c) 2025. All Rights Reserved.
+
+#include "DawnlightSpatialGrid.h"
+#include "GameFramework/Actor.h"
+
+FDawnlightSpatialGrid::FDawnlightSpatialGrid(float InCellSize)
+	: CellSize(FMath::Max(InCellSize, 1.0f))
+{
+}
+
+// ========================================================================
+// 登録
+// ========================================================================
+
+void FDawnlightSpatialGrid::Add(AActor* Actor, const FVector& Location, uint8 CategoryMask)
+{
+	if (!Actor)
+	{
+		return;
+	}
+
+	if (const int32* ExistingIndex = ItemIndexByActor.Find(Actor))
+	{
+		Items[*ExistingIndex].CategoryMask = CategoryMask;
+		UpdateItem(*ExistingIndex, Location);
+		return;
+	}
+
+	FItem& Item = Items.AddDefaulted_GetRef();
+	Item.Actor = Actor;
+	Item.ActorKey = FObjectKey(Actor);
+	Item.Location = Location;
+	Item.Cell = ToCell(Location);
+	Item.CategoryMask = CategoryMask;
+
+	const int32 ItemIndex = Items.Num() - 1;
+	ItemIndexByActor.Add(Item.ActorKey, ItemIndex);
+	Cells.FindOrAdd(Item.Cell).Add(ItemIndex);
+}
+
+bool FDawnlightSpatialGrid::Remove(const AActor* Actor)
+{
+	const int32* ItemIndex = ItemIndexByActor.Find(Actor);
+	if (!ItemIndex)
+	{
+		return false;
+	}
+
+	RemoveItemAt(*ItemIndex);
+	return true;
+}
+
+void FDawnlightSpatialGrid::Update(const AActor* Actor, const FVector& Location)
+{
+	if (const int32* ItemIndex = ItemIndexByActor.Find(Actor))
+	{
+		UpdateItem(*ItemIndex, Location);
+	}
+}
+
+void FDawnlightSpatialGrid::RefreshFromActors()
+{
+	// 削除で末尾と入れ替わるため後ろから走査
+	for (int32 i = Items.Num() - 1; i >= 0; --i)
+	{
+		if (const AActor* Actor = Items[i].Actor.Get())
+		{
+			UpdateItem(i, Actor->GetActorLocation());
+		}
+		else
+		{
+			RemoveItemAt(i);
+		}
+	}
+}
+
+void FDawnlightSpatialGrid::Reset()
+{
+	Items.Empty();
+	ItemIndexByActor.Empty();
+	Cells.Empty();
+}
+
+// ========================================================================
+// クエリ
+// ========================================================================
+
+void FDawnlightSpatialGrid::QueryRadius(const FVector& Center, float Radius, uint8 CategoryMask, TArray<AActor*>& OutActors) const
+{
+	ForEachInRadius(Center, Radius, CategoryMask, [&OutActors](AActor* Actor)
+	{
+		OutActors.Add(Actor);
+	});
+}
+
+void FDawnlightSpatialGrid::QueryNearest(const FVector& Center, int32 MaxCount, float MaxRadius, uint8 CategoryMask, TArray<AActor*>& OutActors) const
+{
+	if (MaxCount <= 0 || MaxRadius <= 0.0f)
+	{
+		return;
+	}
+
+	struct FCandidate
+	{
+		AActor* Actor;
+		float DistanceSq;
+	};
+
+	TArray<FCandidate, TInlineAllocator<32>> Candidates;
+	const float MaxRadiusSq = FMath::Square(MaxRadius);
+	const FIntPoint CenterCell = ToCell(Center);
+	const int32 MaxRing = FMath::CeilToInt(MaxRadius / CellSize);
+
+	// 中心セルから外側へリングを広げ、これ以上近い候補が出ない時点で打ち切る
+	for (int32 Ring = 0; Ring <= MaxRing; ++Ring)
+	{
+		// リング上のセル内の点までの距離の下限
+		const float RingMinDistance = FMath::Max(0, Ring - 1) * CellSize;
+		if (Candidates.Num() >= MaxCount && FMath::Square(RingMinDistance) > Candidates[MaxCount - 1].DistanceSq)
+		{
+			break;
+		}
+
+		for (int32 X = CenterCell.X - Ring; X <= CenterCell.X + Ring; ++X)
+		{
+			for (int32 Y = CenterCell.Y - Ring; Y <= CenterCell.Y + Ring; ++Y)
+			{
+				// リングの外周セルのみ
+				if (FMath::Max(FMath::Abs(X - CenterCell.X), FMath::Abs(Y - CenterCell.Y)) != Ring)
+				{
+					continue;
+				}
+
+				const TArray<int32>* Bucket = Cells.Find(FIntPoint(X, Y));
+				if (!Bucket)
+				{
+					continue;
+				}
+
+				for (const int32 ItemIndex : *Bucket)
+				{
+					const FItem& Item = Items[ItemIndex];
+					if ((Item.CategoryMask & CategoryMask) == 0)
+					{
+						continue;
+					}
+
+					AActor* Actor = Item.Actor.Get();
+					const float DistanceSq = FVector::DistSquared(Center, Item.Location);
+					if (Actor && DistanceSq <= MaxRadiusSq)
+					{
+						Candidates.Add({ Actor, DistanceSq });
+					}
+				}
+			}
+		}
+
+		Candidates.Sort([](const FCandidate& A, const FCandidate& B) { return A.DistanceSq < B.DistanceSq; });
+	}
+
+	const int32 ResultCount = FMath::Min(MaxCount, Candidates.Num());
+	OutActors.Reserve(OutActors.Num() + ResultCount);
+	for (int32 i = 0; i < ResultCount; ++i)
+	{
+		OutActors.Add(Candidates[i].Actor);
+	}
+}
+
+AActor* FDawnlightSpatialGrid::FindNearest(const FVector& Center, float MaxRadius, uint8 CategoryMask, float* OutDistanceSq) const
+{
+	AActor* Nearest = nullptr;
+	float NearestDistanceSq = FMath::Square(MaxRadius);
+
+	ForEachItemInBounds(Center, MaxRadius, CategoryMask, [&](const FItem& Item)
+	{
+		const float DistanceSq = FVector::DistSquared(Center, Item.Location);
+		if (DistanceSq <= NearestDistanceSq)
+		{
+			Nearest = Item.Actor.Get();
+			NearestDistanceSq = DistanceSq;
+		}
+	});
+
+	if (OutDistanceSq)
+	{
+		*OutDistanceSq = Nearest ? NearestDistanceSq : MAX_FLT;
+	}
+	return Nearest;
+}
+
+void FDawnlightSpatialGrid::QueryCone(const FVector& Origin, const FVector& Direction, float Radius, float HalfAngleDegrees, uint8 CategoryMask, TArray<AActor*>& OutActors) const
+{
+	const FVector Forward = Direction.GetSafeNormal();
+	if (Forward.IsNearlyZero())
+	{
+		return;
+	}
+
+	const float RadiusSq = FMath::Square(Radius);
+	const float CosHalfAngle = FMath::Cos(FMath::DegreesToRadians(FMath::Clamp(HalfAngleDegrees, 0.0f, 180.0f)));
+
+	ForEachItemInBounds(Origin, Radius, CategoryMask, [&](const FItem& Item)
+	{
+		const FVector ToItem = Item.Location - Origin;
+		const float DistanceSq = ToItem.SizeSquared();
+		if (DistanceSq > RadiusSq)
+		{
+			return;
+		}
+
+		// 原点と同じ位置のアクターは扇形内とみなす
+		if (DistanceSq <= KINDA_SMALL_NUMBER || FVector::DotProduct(ToItem / FMath::Sqrt(DistanceSq), Forward) >= CosHalfAngle)
+		{
+			OutActors.Add(Item.Actor.Get());
+		}
+	});
+}
+
+// ========================================================================
+// 内部処理
+// ========================================================================
+
+FIntPoint FDawnlightSpatialGrid::ToCell(const FVector& Location) const
+{
+	return FIntPoint(
+		FMath::FloorToInt(Location.X / CellSize),
+		FMath::FloorToInt(Location.Y / CellSize)
+	);
+}
+
+void FDawnlightSpatialGrid::UpdateItem(int32 ItemIndex, const FVector& Location)
+{
+	FItem& Item = Items[ItemIndex];
+	Item.Location = Location;
+
+	const FIntPoint NewCell = ToCell(Location);
+	if (NewCell == Item.Cell)
+	{
+		return;
+	}
+
+	RemoveFromCell(Item.Cell, ItemIndex);
+	Item.Cell = NewCell;
+	Cells.FindOrAdd(NewCell).Add(ItemIndex);
+}
+
+void FDawnlightSpatialGrid::RemoveItemAt(int32 ItemIndex)
+{
+	RemoveFromCell(Items[ItemIndex].Cell, ItemIndex);
+	ItemIndexByActor.Remove(Items[ItemIndex].ActorKey);
+
+	// 末尾のアイテムをこのインデックスに移動し、参照を張り替える
+	const int32 LastIndex = Items.Num() - 1;
+	if (ItemIndex != LastIndex)
+	{
+		const FItem& LastItem = Items[LastIndex];
+		if (TArray<int32>* Bucket = Cells.Find(LastItem.Cell))
+		{
+			const int32 BucketSlot = Bucket->Find(LastIndex);
+			if (BucketSlot != INDEX_NONE)
+			{
+				(*Bucket)[BucketSlot] = ItemIndex;
+			}
+		}
+		ItemIndexByActor.Add(LastItem.ActorKey, ItemIndex);
+	}
+
+	Items.RemoveAtSwap(ItemIndex, EAllowShrinking::No);
+}
+
+void FDawnlightSpatialGrid::RemoveFromCell(const FIntPoint& Cell, int32 ItemIndex)
+{
+	if (TArray<int32>* Bucket = Cells.Find(Cell))
+	{
+		Bucket->RemoveSingleSwap(ItemIndex, EAllowShrinking::No);
+		if (Bucket->Num() == 0)
+		{
+			Cells.Remove(Cell);
+		}
+	}
+}
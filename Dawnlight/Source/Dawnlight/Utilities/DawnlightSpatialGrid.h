@@ -0,0 +1,171 @@
+// Soul Reaper - Dawnlight Project
+// Copyright (c) 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+#include "DawnlightSpatialGrid.generated.h"
+
+/**
+ * 空間グリッドで管理するアクターの種類（ビットマスク）
+ */
+UENUM(BlueprintType, meta = (Bitflags, UseEnumValuesAsMaskValuesInEditor = "true"))
+enum class EDawnlightSpatialCategory : uint8
+{
+	None		= 0 UMETA(Hidden),
+	Enemy		= 1 << 0 UMETA(DisplayName = "敵"),
+	Animal		= 1 << 1 UMETA(DisplayName = "動物"),
+	Player		= 1 << 2 UMETA(DisplayName = "プレイヤー")
+};
+ENUM_CLASS_FLAGS(EDawnlightSpatialCategory);
+
+/** 全カテゴリを対象にするマスク */
+static constexpr uint8 DawnlightSpatialCategory_All = 0xFF;
+
+/**
+ * 均一グリッドによる空間ハッシュ
+ *
+ * アクターをXY平面のセル単位で管理し、近接クエリを線形探索なしで返す
+ * - セルをまたいだ時だけバケットを移動する差分更新
+ * - 半径・最近傍N件・扇形クエリ
+ * - 距離判定は3D（FVector::Dist と同じ結果）
+ */
+class DAWNLIGHT_API FDawnlightSpatialGrid
+{
+public:
+	explicit FDawnlightSpatialGrid(float InCellSize = 500.0f);
+
+	// ========================================================================
+	// 登録
+	// ========================================================================
+
+	/** アクターを追加（登録済みの場合は位置とカテゴリを更新） */
+	void Add(AActor* Actor, const FVector& Location, uint8 CategoryMask);
+
+	/** アクターを削除 */
+	bool Remove(const AActor* Actor);
+
+	/** アクターの位置を更新（セルが変わった場合のみバケットを移動） */
+	void Update(const AActor* Actor, const FVector& Location);
+
+	/** 全アクターの位置をアクターから再取得（破棄されたアクターは削除） */
+	void RefreshFromActors();
+
+	/** 登録済みかどうか */
+	bool Contains(const AActor* Actor) const { return ItemIndexByActor.Contains(Actor); }
+
+	/** 登録数 */
+	int32 Num() const { return Items.Num(); }
+
+	/** 全て削除 */
+	void Reset();
+
+	// ========================================================================
+	// クエリ
+	// ========================================================================
+
+	/** 半径内のアクターを取得（順不同） */
+	void QueryRadius(const FVector& Center, float Radius, uint8 CategoryMask, TArray<AActor*>& OutActors) const;
+
+	/** 半径内の各アクターに対して Func(AActor*) を呼ぶ（順不同、出力配列を使わないのでワーカースレッドからの大量のクエリ向け） */
+	template<typename FuncType>
+	void ForEachInRadius(const FVector& Center, float Radius, uint8 CategoryMask, FuncType&& Func) const;
+
+	/** 半径内で近い順に最大 MaxCount 件を取得 */
+	void QueryNearest(const FVector& Center, int32 MaxCount, float MaxRadius, uint8 CategoryMask, TArray<AActor*>& OutActors) const;
+
+	/**
+	 * 半径内の最も近いアクターを1件取得（出力配列を使わない、見つからない場合は nullptr）
+	 * @param OutDistanceSq 見つかったアクターまでの距離の2乗（見つからない場合は MAX_FLT）
+	 */
+	AActor* FindNearest(const FVector& Center, float MaxRadius, uint8 CategoryMask, float* OutDistanceSq = nullptr) const;
+
+	/** 扇形（Origin から Direction 方向、半角 HalfAngleDegrees）内のアクターを取得（順不同） */
+	void QueryCone(const FVector& Origin, const FVector& Direction, float Radius, float HalfAngleDegrees, uint8 CategoryMask, TArray<AActor*>& OutActors) const;
+
+private:
+	struct FItem
+	{
+		TWeakObjectPtr<AActor> Actor;
+		FObjectKey ActorKey;
+		FVector Location = FVector::ZeroVector;
+		FIntPoint Cell = FIntPoint::ZeroValue;
+		uint8 CategoryMask = 0;
+	};
+
+	/** セルの一辺の長さ */
+	float CellSize;
+
+	/** 登録アイテム（削除時は末尾と入れ替え） */
+	TArray<FItem> Items;
+
+	/** アクター → アイテムインデックス */
+	TMap<FObjectKey, int32> ItemIndexByActor;
+
+	/** セル → アイテムインデックス */
+	TMap<FIntPoint, TArray<int32>> Cells;
+
+	/** 位置からセル座標を求める */
+	FIntPoint ToCell(const FVector& Location) const;
+
+	/** アイテムの位置を更新 */
+	void UpdateItem(int32 ItemIndex, const FVector& Location);
+
+	/** インデックスのアイテムを削除 */
+	void RemoveItemAt(int32 ItemIndex);
+
+	/** セルのバケットからアイテムを外す */
+	void RemoveFromCell(const FIntPoint& Cell, int32 ItemIndex);
+
+	/** 半径を覆うセル範囲の各アイテムに対して Func を呼ぶ */
+	template<typename FuncType>
+	void ForEachItemInBounds(const FVector& Center, float Radius, uint8 CategoryMask, FuncType&& Func) const;
+};
+
+template<typename FuncType>
+void FDawnlightSpatialGrid::ForEachInRadius(const FVector& Center, float Radius, uint8 CategoryMask, FuncType&& Func) const
+{
+	const float RadiusSq = FMath::Square(Radius);
+
+	ForEachItemInBounds(Center, Radius, CategoryMask, [&](const FItem& Item)
+	{
+		if (FVector::DistSquared(Center, Item.Location) <= RadiusSq)
+		{
+			Func(Item.Actor.Get());
+		}
+	});
+}
+
+template<typename FuncType>
+void FDawnlightSpatialGrid::ForEachItemInBounds(const FVector& Center, float Radius, uint8 CategoryMask, FuncType&& Func) const
+{
+	if (Radius < 0.0f)
+	{
+		return;
+	}
+
+	const FIntPoint MinCell = ToCell(Center - FVector(Radius, Radius, 0.0f));
+	const FIntPoint MaxCell = ToCell(Center + FVector(Radius, Radius, 0.0f));
+
+	for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+	{
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+		{
+			const TArray<int32>* Bucket = Cells.Find(FIntPoint(X, Y));
+			if (!Bucket)
+			{
+				continue;
+			}
+
+			for (const int32 ItemIndex : *Bucket)
+			{
+				const FItem& Item = Items[ItemIndex];
+				if ((Item.CategoryMask & CategoryMask) != 0 && Item.Actor.IsValid())
+				{
+					Func(Item);
+				}
+			}
+		}
+	}
+}
@@ -140,3 +140,19 @@ UE_DEFINE_GAMEPLAY_TAG(Animal_Type_Kitty, "Animal.Type.Kitty");
 
 /** Penguin */
 UE_DEFINE_GAMEPLAY_TAG(Animal_Type_Penguin, "Animal.Type.Penguin");
+
+// ========================================================================
+// ダメージタグ (Damage / Data)
+// ========================================================================
+
+/** 近接攻撃ダメージ */
+UE_DEFINE_GAMEPLAY_TAG(Damage_Type_Melee, "Damage.Type.Melee");
+
+/** 範囲攻撃ダメージ */
+UE_DEFINE_GAMEPLAY_TAG(Damage_Type_Area, "Damage.Type.Area");
+
+/** SetByCaller: ダメージ量 */
+UE_DEFINE_GAMEPLAY_TAG(Data_Damage, "Data.Damage");
+
+/** SetByCaller: 魂バフの1スタックあたりの効果量 */
+UE_DEFINE_GAMEPLAY_TAG(Data_SoulBuff, "Data.SoulBuff");
@@ -150,6 +150,22 @@ UE_DECLARE_GAMEPLAY_TAG_EXTERN(Animal_Type_Kitty);
 /** Penguin */
 UE_DECLARE_GAMEPLAY_TAG_EXTERN(Animal_Type_Penguin);
 
+// ========================================================================
+// ダメージタグ (Damage / Data)
+// ========================================================================
+
+/** 近接攻撃ダメージ */
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(Damage_Type_Melee);
+
+/** 範囲攻撃ダメージ */
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(Damage_Type_Area);
+
+/** SetByCaller: ダメージ量 */
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(Data_Damage);
+
+/** SetByCaller: 魂バフの1スタックあたりの効果量 */
+UE_DECLARE_GAMEPLAY_TAG_EXTERN(Data_SoulBuff);
+
 // ========================================================================
 // SoulReaperTags 名前空間（便利なアクセス用）
 // ========================================================================
@@ -205,6 +221,12 @@ namespace SoulReaperTags
 	static const FGameplayTag& Animal_Type_Deer = ::Animal_Type_Deer;
 	static const FGameplayTag& Animal_Type_Kitty = ::Animal_Type_Kitty;
 	static const FGameplayTag& Animal_Type_Penguin = ::Animal_Type_Penguin;
+
+	// ダメージタグ
+	static const FGameplayTag& Damage_Type_Melee = ::Damage_Type_Melee;
+	static const FGameplayTag& Damage_Type_Area = ::Damage_Type_Area;
+	static const FGameplayTag& Data_Damage = ::Data_Damage;
+	static const FGameplayTag& Data_SoulBuff = ::Data_SoulBuff;
 }
 
 // 旧タグの後方互換性（コンパイル通す用、後で削除可能）
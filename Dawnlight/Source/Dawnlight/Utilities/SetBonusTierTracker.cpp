@@ -0,0 +1,84 @@
+// Soul Reaper - Dawnlight Project
+// Copyright (c) 2025. All Rights Reserved.
+
+#include "SetBonusTierTracker.h"
+
+void FSetBonusTierTracker::SetThresholds(int32 Slot, TConstArrayView<int32> RequiredCounts)
+{
+	if (Slot < 0)
+	{
+		return;
+	}
+
+	if (!Tracks.IsValidIndex(Slot))
+	{
+		Tracks.SetNum(Slot + 1);
+	}
+
+	FTrack& Track = Tracks[Slot];
+	Track.Thresholds.Reset();
+	Track.Thresholds.Append(RequiredCounts.GetData(), RequiredCounts.Num());
+	Track.Thresholds.Sort();
+
+	// 登録前から集めていた分は通知しない
+	Track.Tier = 0;
+	while (Track.Tier < Track.Thresholds.Num() && Track.Count >= Track.Thresholds[Track.Tier])
+	{
+		++Track.Tier;
+	}
+}
+
+int32 FSetBonusTierTracker::UpdateCount(int32 Slot, int32 NewCount, FOnTierReached OnTierReached)
+{
+	if (!Tracks.IsValidIndex(Slot))
+	{
+		return 0;
+	}
+
+	FTrack& Track = Tracks[Slot];
+	Track.Count = NewCount;
+
+	// 減った場合は通知せずに下げる
+	while (Track.Tier > 0 && NewCount < Track.Thresholds[Track.Tier - 1])
+	{
+		--Track.Tier;
+	}
+
+	// 増えた場合は跨いだ段階を順に通知
+	while (Track.Tier < Track.Thresholds.Num() && NewCount >= Track.Thresholds[Track.Tier])
+	{
+		++Track.Tier;
+		OnTierReached(Slot, Track.Tier);
+	}
+
+	return Track.Tier;
+}
+
+int32 FSetBonusTierTracker::GetTier(int32 Slot) const
+{
+	return Tracks.IsValidIndex(Slot) ? Tracks[Slot].Tier : 0;
+}
+
+int32 FSetBonusTierTracker::GetCount(int32 Slot) const
+{
+	return Tracks.IsValidIndex(Slot) ? Tracks[Slot].Count : 0;
+}
+
+bool FSetBonusTierTracker::HasThresholds(int32 Slot) const
+{
+	return Tracks.IsValidIndex(Slot) && Tracks[Slot].Thresholds.Num() > 0;
+}
+
+void FSetBonusTierTracker::ResetCounts()
+{
+	for (FTrack& Track : Tracks)
+	{
+		Track.Count = 0;
+		Track.Tier = 0;
+	}
+}
+
+void FSetBonusTierTracker::Reset()
+{
+	Tracks.Reset();
+}
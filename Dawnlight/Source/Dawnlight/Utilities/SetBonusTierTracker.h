@@ -0,0 +1,62 @@
+// Soul Reaper - Dawnlight Project
+// Copyright (c) 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * セットボーナスの段階トラッカー
+ *
+ * スロット（ESoulType など）ごとに昇順の閾値配列と現在の段階を持つ
+ * 収集数が変わった時は段階のインデックスを進めるだけで、到達した段階を通知する
+ * 閾値の登録時以外はメモリを確保しない
+ */
+class DAWNLIGHT_API FSetBonusTierTracker
+{
+public:
+	/** 段階到達時のコールバック（Slot, 1から始まる段階番号） */
+	using FOnTierReached = TFunctionRef<void(int32 Slot, int32 Tier)>;
+
+	/** スロットの閾値を登録（昇順に並べ替えて保持、現在の収集数から段階を通知なしで再計算） */
+	void SetThresholds(int32 Slot, TConstArrayView<int32> RequiredCounts);
+
+	/**
+	 * 収集数を更新
+	 * 新しく到達した段階ごとに OnTierReached を呼ぶ（収集数が減った場合は通知せずに段階を下げる）
+	 * @return 更新後の段階（0 = 未到達）
+	 */
+	int32 UpdateCount(int32 Slot, int32 NewCount, FOnTierReached OnTierReached);
+
+	/** 現在の段階（0 = 未到達、未登録のスロットも 0） */
+	int32 GetTier(int32 Slot) const;
+
+	/** 現在の収集数 */
+	int32 GetCount(int32 Slot) const;
+
+	/** 閾値が登録されているか */
+	bool HasThresholds(int32 Slot) const;
+
+	/** 全スロットの収集数と段階を0に戻す（閾値は保持） */
+	void ResetCounts();
+
+	/** 全て削除 */
+	void Reset();
+
+private:
+	/** スロットごとの状態 */
+	struct FTrack
+	{
+		/** 昇順の閾値 */
+		TArray<int32> Thresholds;
+
+		/** 現在の収集数 */
+		int32 Count = 0;
+
+		/** 到達済みの閾値の数 */
+		int32 Tier = 0;
+	};
+
+	/** スロット番号で引く状態 */
+	TArray<FTrack> Tracks;
+};